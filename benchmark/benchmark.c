@@ -0,0 +1,192 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <seagrass.h>
+
+#include "benchmark.h"
+
+#define REPETITIONS 5
+#define MINIMUM_TIME_MS 10
+
+static const struct benchmark_suite *const suites[] = {
+        &benchmark_integer_suite,
+        &benchmark_floating_suite,
+        &benchmark_uintmax_t_suite,
+        &benchmark_float_array_suite,
+        &benchmark_aggregate_suite
+};
+
+struct options {
+    const char *filter;
+    uintmax_t repetitions;
+    uint64_t minimum_time;
+    int list;
+};
+
+struct measurement {
+    double ns;
+    double cycles;
+    double failure_rate;
+};
+
+/* Number of calls needed for a single run to last at least minimum_time. */
+static uintmax_t calibrate(uintmax_t (*const loop)(uintmax_t),
+                           const uint64_t minimum_time) {
+    uintmax_t count = 16;
+    for (;;) {
+        const uint64_t start = benchmark_now();
+        loop(count);
+        const uint64_t elapsed = benchmark_now() - start;
+        if (elapsed >= minimum_time || count > UINTMAX_MAX / 16) {
+            return count;
+        }
+        count *= elapsed < minimum_time / 16 ? 16 : 2;
+    }
+}
+
+/* Best of the repetitions, which is the least disturbed by other work. */
+static void measure(uintmax_t (*const loop)(uintmax_t),
+                    const struct options *const options,
+                    struct measurement *const out) {
+    const uintmax_t count = calibrate(loop, options->minimum_time);
+    uint64_t ns = UINT64_MAX;
+    uint64_t cycles = UINT64_MAX;
+    uintmax_t failures = 0;
+    for (uintmax_t r = 0; r < options->repetitions; r++) {
+        const uint64_t start = benchmark_now();
+        const uint64_t start_cycles = benchmark_cycles();
+        failures = loop(count);
+        const uint64_t end_cycles = benchmark_cycles();
+        const uint64_t end = benchmark_now();
+        if (end - start < ns) {
+            ns = end - start;
+        }
+        if (end_cycles - start_cycles < cycles) {
+            cycles = end_cycles - start_cycles;
+        }
+    }
+    out->ns = (double) ns / (double) count;
+    out->cycles = (double) cycles / (double) count;
+    out->failure_rate = (double) failures / (double) count;
+}
+
+static void print_cycles(const char *const name, const double cycles) {
+    if (BENCHMARK_HAS_CYCLES) {
+        printf(", \"%s\": %.3f", name, cycles);
+    } else {
+        printf(", \"%s\": null", name);
+    }
+}
+
+static void run(const struct benchmark_suite *const suite,
+                const struct benchmark_case *const item,
+                const struct options *const options,
+                const int first) {
+    struct measurement measurement;
+    measure(item->loop, options, &measurement);
+    printf("%s\n    {\"suite\": \"%s\", \"function\": \"%s\", "
+           "\"path\": \"%s\", \"items\": %ju, \"ns_per_op\": %.3f, "
+           "\"ns_per_item\": %.3f",
+           first ? "" : ",", suite->name, item->function, item->path,
+           item->items, measurement.ns,
+           measurement.ns / (double) item->items);
+    print_cycles("cycles_per_op", measurement.cycles);
+    printf(", \"failure_rate\": %.3f", measurement.failure_rate);
+    if (item->baseline_loop) {
+        struct measurement baseline;
+        measure(item->baseline_loop, options, &baseline);
+        printf(", \"baseline\": \"%s\", \"baseline_ns_per_op\": %.3f",
+               item->baseline, baseline.ns);
+        print_cycles("baseline_cycles_per_op", baseline.cycles);
+    } else {
+        printf(", \"baseline\": null");
+    }
+    printf("}");
+    fflush(stdout);
+}
+
+static int matches(const struct benchmark_case *const item,
+                   const struct options *const options) {
+    return !options->filter || strstr(item->function, options->filter);
+}
+
+static int usage(const char *const name) {
+    fprintf(stderr, "usage: %s [--filter <text>] [--repetitions <count>] "
+                    "[--min-time-ms <milliseconds>] [--list]\n", name);
+    return EXIT_FAILURE;
+}
+
+static int parse(const int argc, char *argv[], struct options *const out) {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp("--list", argv[i])) {
+            out->list = 1;
+            continue;
+        }
+        if (i + 1 == argc) {
+            return 1;
+        }
+        const char *const value = argv[++i];
+        char *end;
+        if (!strcmp("--filter", argv[i - 1])) {
+            out->filter = value;
+        } else if (!strcmp("--repetitions", argv[i - 1])) {
+            out->repetitions = strtoumax(value, &end, 10);
+            if (*end || !out->repetitions) {
+                return 1;
+            }
+        } else if (!strcmp("--min-time-ms", argv[i - 1])) {
+            const uintmax_t ms = strtoumax(value, &end, 10);
+            if (*end || ms > UINT64_MAX / 1000000) {
+                return 1;
+            }
+            out->minimum_time = ms * 1000000;
+        } else {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    struct options options = {
+            .repetitions = REPETITIONS,
+            .minimum_time = MINIMUM_TIME_MS * 1000000
+    };
+    if (parse(argc, argv, &options)) {
+        return usage(argv[0]);
+    }
+    const size_t count = sizeof(suites) / sizeof(suites[0]);
+    if (options.list) {
+        for (size_t s = 0; s < count; s++) {
+            for (size_t c = 0; c < suites[s]->count; c++) {
+                const struct benchmark_case *const item = &suites[s]->cases[c];
+                if (matches(item, &options)) {
+                    printf("%s %s %s\n", suites[s]->name, item->function,
+                           item->path);
+                }
+            }
+        }
+        return 0;
+    }
+    printf("{\n  \"context\": {\"repetitions\": %ju, \"min_time_ms\": %ju, "
+           "\"inputs\": %u, \"items\": %u, \"cycles\": %s},\n"
+           "  \"benchmarks\": [",
+           options.repetitions, (uintmax_t) (options.minimum_time / 1000000),
+           BENCHMARK_INPUTS, BENCHMARK_ITEMS,
+           BENCHMARK_HAS_CYCLES ? "\"tsc\"" : "null");
+    int first = 1;
+    uint64_t state = 88172645463325252ULL;
+    for (size_t s = 0; s < count; s++) {
+        suites[s]->setup(&state);
+        for (size_t c = 0; c < suites[s]->count; c++) {
+            const struct benchmark_case *const item = &suites[s]->cases[c];
+            if (matches(item, &options)) {
+                run(suites[s], item, &options, first);
+                first = 0;
+            }
+        }
+    }
+    printf("\n  ]\n}\n");
+    return 0;
+}
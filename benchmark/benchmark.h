@@ -0,0 +1,135 @@
+#ifndef _SEAGRASS_BENCHMARK_H_
+#define _SEAGRASS_BENCHMARK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCHMARK_HAS_CYCLES 1
+#else
+#define BENCHMARK_HAS_CYCLES 0
+#endif
+
+/**
+ * @brief Monotonic time in nanoseconds.
+ */
+static inline uint64_t benchmark_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+/**
+ * @brief Timestamp counter ticks, or <i>0</i> if the processor has no such
+ * counter.
+ * <p>On modern x86 processors the counter ticks at a constant rate which is
+ * close to, but not necessarily equal to, the core clock.</p>
+ */
+static inline uint64_t benchmark_cycles(void) {
+#if BENCHMARK_HAS_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Prevent the compiler from optimizing away the computation of value.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define BENCHMARK_KEEP(value) __asm__ volatile("" : : "r,m"(value) : "memory")
+#else
+#define BENCHMARK_KEEP(value) \
+    do { volatile uintmax_t benchmark_sink = (uintmax_t) (value); \
+         (void) benchmark_sink; } while (0)
+#endif
+
+/**
+ * @brief Pseudo random number generator (xorshift64*).
+ */
+static inline uint64_t benchmark_random(uint64_t *const state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief Number of inputs the loops cycle through, a power of two.
+ */
+#define BENCHMARK_INPUTS 1024u
+
+/**
+ * @brief Number of items passed to functions that take arrays.
+ */
+#define BENCHMARK_ITEMS 4096u
+
+/**
+ * @brief Define a loop calling body count times.
+ * <p>Within body, <b>i</b> is the index of the input to use and every call
+ * whose result is not <i>0</i> is added to <b>failures</b>, which is
+ * returned so that the path taken by each case can be verified.</p>
+ */
+#define BENCHMARK_LOOP(name, ...) \
+    static uintmax_t name(const uintmax_t count) { \
+        uintmax_t failures = 0; \
+        for (uintmax_t n = 0; n < count; n++) { \
+            const uintmax_t i = n & (BENCHMARK_INPUTS - 1); \
+            (void) i; \
+            __VA_ARGS__ \
+        } \
+        return failures; \
+    }
+
+struct benchmark_case {
+    /* name of the function measured */
+    const char *function;
+    /* success, or the error or special case the inputs lead to */
+    const char *path;
+    /* items processed per call */
+    uintmax_t items;
+    /* call the function count times, returning the number of failures */
+    uintmax_t (*loop)(uintmax_t count);
+    /* the raw operation the function is compared to, or NULL */
+    const char *baseline;
+    uintmax_t (*baseline_loop)(uintmax_t count);
+};
+
+#define BENCHMARK_CASE(function, path, loop) \
+    {#function, (path), 1, (loop), NULL, NULL}
+
+#define BENCHMARK_CASE_ITEMS(function, path, loop) \
+    {#function, (path), BENCHMARK_ITEMS, (loop), NULL, NULL}
+
+#define BENCHMARK_CASE_BASELINE(function, path, loop, baseline, \
+                                baseline_loop) \
+    {#function, (path), 1, (loop), (baseline), (baseline_loop)}
+
+#define BENCHMARK_CASE_ITEMS_BASELINE(function, path, loop, baseline, \
+                                      baseline_loop) \
+    {#function, (path), BENCHMARK_ITEMS, (loop), (baseline), \
+     (baseline_loop)}
+
+struct benchmark_suite {
+    const char *name;
+    /* fill the inputs of the cases */
+    void (*setup)(uint64_t *state);
+    const struct benchmark_case *cases;
+    size_t count;
+};
+
+#define BENCHMARK_SUITE(name, setup, cases) \
+    const struct benchmark_suite benchmark_ ## name ## _suite = { \
+            #name, (setup), (cases), sizeof(cases) / sizeof((cases)[0]) \
+    }
+
+extern const struct benchmark_suite benchmark_integer_suite;
+extern const struct benchmark_suite benchmark_floating_suite;
+extern const struct benchmark_suite benchmark_uintmax_t_suite;
+extern const struct benchmark_suite benchmark_float_array_suite;
+extern const struct benchmark_suite benchmark_aggregate_suite;
+
+#endif /* _SEAGRASS_BENCHMARK_H_ */
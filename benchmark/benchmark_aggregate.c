@@ -0,0 +1,379 @@
+#include <math.h>
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "benchmark.h"
+
+#define PRECISION 7
+
+static uintmax_t small[BENCHMARK_INPUTS];
+static uintmax_t latencies[BENCHMARK_INPUTS];
+static float samples[BENCHMARK_INPUTS];
+static double percentiles[BENCHMARK_INPUTS];
+static uintmax_t items[BENCHMARK_ITEMS];
+static float float_items[BENCHMARK_ITEMS];
+/* float items with a NaN at the end */
+static float invalid_items[BENCHMARK_ITEMS];
+static struct seagrass_counter counter;
+static struct seagrass_histogram histogram;
+static struct seagrass_histogram other_histogram;
+static struct seagrass_histogram_snapshot snapshot;
+static struct seagrass_histogram_snapshot other_snapshot;
+static struct seagrass_histogram_snapshot empty_snapshot;
+static unsigned char *serialized;
+static uintmax_t serialized_size;
+static struct seagrass_stats stats;
+static struct seagrass_stats single_stats;
+static struct seagrass_stats empty_stats;
+
+static void setup(uint64_t *const state) {
+    seagrass_required_true(!seagrass_counter_init(&counter, 4));
+    seagrass_required_true(!seagrass_histogram_init(&histogram, PRECISION, 4));
+    seagrass_required_true(!seagrass_histogram_init(&other_histogram,
+                                                    PRECISION, 4));
+    seagrass_required_true(!seagrass_stats_init(&stats));
+    seagrass_required_true(!seagrass_stats_init(&single_stats));
+    seagrass_required_true(!seagrass_stats_init(&empty_stats));
+    for (uintmax_t i = 0; i < BENCHMARK_INPUTS; i++) {
+        const uint64_t r = benchmark_random(state);
+        small[i] = 1 + r % 4095;
+        /* roughly log-normal latencies between 1 ns and 1 s */
+        latencies[i] = (uintmax_t) 1 << (r % 30);
+        latencies[i] += (r >> 32) % latencies[i];
+        samples[i] = (float) small[i] / 16;
+        percentiles[i] = (double) (r % 10000) / 100;
+        seagrass_required_true(!seagrass_histogram_record(&other_histogram,
+                                                          latencies[i]));
+        seagrass_required_true(!seagrass_stats_add_float(&stats,
+                                                         samples[i]));
+    }
+    seagrass_required_true(!seagrass_stats_add_float(&single_stats, 1));
+    for (uintmax_t i = 0; i < BENCHMARK_ITEMS; i++) {
+        items[i] = small[i % BENCHMARK_INPUTS];
+        float_items[i] = samples[i % BENCHMARK_INPUTS];
+        invalid_items[i] = float_items[i];
+    }
+    invalid_items[BENCHMARK_ITEMS - 1] = NAN;
+    seagrass_required_true(!seagrass_histogram_snapshot(&other_histogram,
+                                                        &snapshot));
+    seagrass_required_true(!seagrass_histogram_snapshot(&other_histogram,
+                                                        &other_snapshot));
+    seagrass_required_true(!seagrass_histogram_snapshot(&histogram,
+                                                        &empty_snapshot));
+    seagrass_required_true(!seagrass_histogram_snapshot_serialized_size(
+            &snapshot, &serialized_size));
+    serialized = malloc(serialized_size);
+    seagrass_required(serialized);
+    seagrass_required_true(!seagrass_histogram_snapshot_serialize(
+            &snapshot, serialized, serialized_size));
+}
+
+BENCHMARK_LOOP(required,
+    seagrass_required(&small[i]);
+)
+
+BENCHMARK_LOOP(required_true,
+    seagrass_required_true(0 != small[i]);
+)
+
+BENCHMARK_LOOP(void_ptr_compare,
+    BENCHMARK_KEEP(seagrass_void_ptr_compare(&small[i], &latencies[i]));
+)
+
+BENCHMARK_LOOP(void_ptr_compare_baseline,
+    const void *const a = &small[i];
+    const void *const b = &latencies[i];
+    BENCHMARK_KEEP((a > b) - (a < b));
+)
+
+BENCHMARK_LOOP(counter_init,
+    struct seagrass_counter result;
+    failures += 0 != seagrass_counter_init(&result, 4);
+    failures += 0 != seagrass_counter_invalidate(&result);
+)
+
+BENCHMARK_LOOP(counter_init_invalid,
+    struct seagrass_counter result;
+    failures += 0 != seagrass_counter_init(&result, 0);
+)
+
+BENCHMARK_LOOP(counter_add,
+    failures += 0 != seagrass_counter_add(&counter, small[i]);
+)
+
+BENCHMARK_LOOP(counter_add_null,
+    failures += 0 != seagrass_counter_add(NULL, small[i]);
+)
+
+BENCHMARK_LOOP(counter_value,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_counter_value(&counter, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(histogram_init,
+    struct seagrass_histogram result;
+    failures += 0 != seagrass_histogram_init(&result, PRECISION, 4);
+    failures += 0 != seagrass_histogram_invalidate(&result);
+)
+
+BENCHMARK_LOOP(histogram_init_invalid,
+    struct seagrass_histogram result;
+    failures += 0 != seagrass_histogram_init(&result, 0, 4);
+)
+
+BENCHMARK_LOOP(histogram_record,
+    failures += 0 != seagrass_histogram_record(&histogram, latencies[i]);
+)
+
+BENCHMARK_LOOP(histogram_record_null,
+    failures += 0 != seagrass_histogram_record(NULL, latencies[i]);
+)
+
+BENCHMARK_LOOP(histogram_merge,
+    failures += 0 != seagrass_histogram_merge(&histogram, &other_histogram);
+)
+
+BENCHMARK_LOOP(histogram_snapshot,
+    struct seagrass_histogram_snapshot result;
+    failures += 0 != seagrass_histogram_snapshot(&other_histogram, &result);
+    failures += 0 != seagrass_histogram_snapshot_invalidate(&result);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_count,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_histogram_snapshot_count(&snapshot, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_percentile,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_histogram_snapshot_percentile(
+            &snapshot, percentiles[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_percentile_empty,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_histogram_snapshot_percentile(
+            &empty_snapshot, percentiles[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_percentile_invalid,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_histogram_snapshot_percentile(
+            &snapshot, 100 + percentiles[i] + 1, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_merge,
+    failures += 0 != seagrass_histogram_snapshot_merge(&snapshot,
+                                                       &other_snapshot);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_serialized_size,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_histogram_snapshot_serialized_size(
+            &other_snapshot, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_serialize,
+    failures += 0 != seagrass_histogram_snapshot_serialize(
+            &other_snapshot, serialized, serialized_size);
+    BENCHMARK_KEEP(serialized[0]);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_serialize_too_small,
+    failures += 0 != seagrass_histogram_snapshot_serialize(
+            &other_snapshot, serialized, serialized_size - 1);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_deserialize,
+    struct seagrass_histogram_snapshot result;
+    failures += 0 != seagrass_histogram_snapshot_deserialize(
+            &result, serialized, serialized_size);
+    failures += 0 != seagrass_histogram_snapshot_invalidate(&result);
+)
+
+BENCHMARK_LOOP(histogram_snapshot_deserialize_invalid,
+    struct seagrass_histogram_snapshot result;
+    failures += 0 != seagrass_histogram_snapshot_deserialize(
+            &result, serialized, serialized_size - 1);
+)
+
+BENCHMARK_LOOP(stats_init,
+    struct seagrass_stats result;
+    failures += 0 != seagrass_stats_init(&result);
+    BENCHMARK_KEEP(result.count);
+)
+
+BENCHMARK_LOOP(stats_add_uintmax_t,
+    failures += 0 != seagrass_stats_add_uintmax_t(&stats, small[i]);
+)
+
+BENCHMARK_LOOP(stats_add_uintmax_t_n,
+    struct seagrass_stats result;
+    seagrass_stats_init(&result);
+    failures += 0 != seagrass_stats_add_uintmax_t_n(&result, items,
+                                                    BENCHMARK_ITEMS);
+    BENCHMARK_KEEP(result.m2);
+)
+
+BENCHMARK_LOOP(stats_add_float,
+    failures += 0 != seagrass_stats_add_float(&stats, samples[i]);
+)
+
+BENCHMARK_LOOP(stats_add_float_baseline,
+    static double sum;
+    sum += samples[i];
+    BENCHMARK_KEEP(sum);
+)
+
+BENCHMARK_LOOP(stats_add_float_inconsistent,
+    failures += 0 != seagrass_stats_add_float(&stats, NAN);
+)
+
+BENCHMARK_LOOP(stats_add_float_n,
+    struct seagrass_stats result;
+    seagrass_stats_init(&result);
+    failures += 0 != seagrass_stats_add_float_n(&result, float_items,
+                                                BENCHMARK_ITEMS);
+    BENCHMARK_KEEP(result.m2);
+)
+
+BENCHMARK_LOOP(stats_add_float_n_baseline,
+    double sum = 0;
+    double squares = 0;
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        sum += float_items[k];
+        squares += (double) float_items[k] * float_items[k];
+    }
+    BENCHMARK_KEEP(sum);
+    BENCHMARK_KEEP(squares);
+)
+
+BENCHMARK_LOOP(stats_add_float_n_inconsistent,
+    struct seagrass_stats result;
+    seagrass_stats_init(&result);
+    failures += 0 != seagrass_stats_add_float_n(&result, invalid_items,
+                                                BENCHMARK_ITEMS);
+    BENCHMARK_KEEP(result.m2);
+)
+
+BENCHMARK_LOOP(stats_merge,
+    struct seagrass_stats result = single_stats;
+    failures += 0 != seagrass_stats_merge(&result, &stats);
+    BENCHMARK_KEEP(result.m2);
+)
+
+BENCHMARK_LOOP(stats_merge_null,
+    failures += 0 != seagrass_stats_merge(&stats, NULL);
+)
+
+#define STATS_GETTER(name, type) \
+    BENCHMARK_LOOP(stats_ ## name, \
+        type result = 0; \
+        failures += 0 != seagrass_stats_ ## name(&stats, &result); \
+        BENCHMARK_KEEP(result); \
+    ) \
+    BENCHMARK_LOOP(stats_ ## name ## _empty, \
+        type result = 0; \
+        failures += 0 != seagrass_stats_ ## name(&empty_stats, &result); \
+        BENCHMARK_KEEP(result); \
+    )
+
+STATS_GETTER(count, uintmax_t)
+STATS_GETTER(mean, double)
+STATS_GETTER(variance, double)
+STATS_GETTER(sample_variance, double)
+STATS_GETTER(minimum, double)
+STATS_GETTER(maximum, double)
+
+BENCHMARK_LOOP(stats_sample_variance_single,
+    double result = 0;
+    failures += 0 != seagrass_stats_sample_variance(&single_stats, &result);
+    BENCHMARK_KEEP(result);
+)
+
+#define STATS_GETTER_CASES(name) \
+    BENCHMARK_CASE(seagrass_stats_ ## name, "success", stats_ ## name), \
+    BENCHMARK_CASE(seagrass_stats_ ## name, "empty", stats_ ## name ## _empty)
+
+static const struct benchmark_case cases[] = {
+        BENCHMARK_CASE(seagrass_required, "success", required),
+        BENCHMARK_CASE(seagrass_required_true, "success", required_true),
+        BENCHMARK_CASE_BASELINE(seagrass_void_ptr_compare, "success",
+                                void_ptr_compare, "(a > b) - (a < b)",
+                                void_ptr_compare_baseline),
+        BENCHMARK_CASE(seagrass_counter_init, "success", counter_init),
+        BENCHMARK_CASE(seagrass_counter_init, "slots_is_zero",
+                       counter_init_invalid),
+        BENCHMARK_CASE(seagrass_counter_add, "success", counter_add),
+        BENCHMARK_CASE(seagrass_counter_add, "object_is_null",
+                       counter_add_null),
+        BENCHMARK_CASE(seagrass_counter_value, "success", counter_value),
+        BENCHMARK_CASE(seagrass_histogram_init, "success", histogram_init),
+        BENCHMARK_CASE(seagrass_histogram_init, "precision_is_invalid",
+                       histogram_init_invalid),
+        BENCHMARK_CASE(seagrass_histogram_record, "success",
+                       histogram_record),
+        BENCHMARK_CASE(seagrass_histogram_record, "object_is_null",
+                       histogram_record_null),
+        BENCHMARK_CASE(seagrass_histogram_merge, "success", histogram_merge),
+        BENCHMARK_CASE(seagrass_histogram_snapshot, "success",
+                       histogram_snapshot),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_count, "success",
+                       histogram_snapshot_count),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_percentile, "success",
+                       histogram_snapshot_percentile),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_percentile, "is_empty",
+                       histogram_snapshot_percentile_empty),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_percentile,
+                       "percentile_is_invalid",
+                       histogram_snapshot_percentile_invalid),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_merge, "success",
+                       histogram_snapshot_merge),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_serialized_size, "success",
+                       histogram_snapshot_serialized_size),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_serialize, "success",
+                       histogram_snapshot_serialize),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_serialize,
+                       "size_is_too_small",
+                       histogram_snapshot_serialize_too_small),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_deserialize, "success",
+                       histogram_snapshot_deserialize),
+        BENCHMARK_CASE(seagrass_histogram_snapshot_deserialize,
+                       "data_is_invalid",
+                       histogram_snapshot_deserialize_invalid),
+        BENCHMARK_CASE(seagrass_stats_init, "success", stats_init),
+        BENCHMARK_CASE(seagrass_stats_add_uintmax_t, "success",
+                       stats_add_uintmax_t),
+        BENCHMARK_CASE_ITEMS(seagrass_stats_add_uintmax_t_n, "success",
+                             stats_add_uintmax_t_n),
+        BENCHMARK_CASE_BASELINE(seagrass_stats_add_float, "success",
+                                stats_add_float, "s += a",
+                                stats_add_float_baseline),
+        BENCHMARK_CASE(seagrass_stats_add_float, "inconsistent",
+                       stats_add_float_inconsistent),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_stats_add_float_n, "success",
+                                      stats_add_float_n,
+                                      "s += a[k], q += a[k] * a[k]",
+                                      stats_add_float_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_stats_add_float_n, "inconsistent",
+                             stats_add_float_n_inconsistent),
+        BENCHMARK_CASE(seagrass_stats_merge, "success", stats_merge),
+        BENCHMARK_CASE(seagrass_stats_merge, "other_is_null",
+                       stats_merge_null),
+        STATS_GETTER_CASES(count),
+        STATS_GETTER_CASES(mean),
+        STATS_GETTER_CASES(variance),
+        STATS_GETTER_CASES(sample_variance),
+        BENCHMARK_CASE(seagrass_stats_sample_variance, "single",
+                       stats_sample_variance_single),
+        STATS_GETTER_CASES(minimum),
+        STATS_GETTER_CASES(maximum)
+};
+
+BENCHMARK_SUITE(aggregate, setup, cases);
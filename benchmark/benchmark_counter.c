@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <seagrass.h>
+
+#include "benchmark.h"
+
+#define COUNT (1u << 22)
+
+enum variant {
+    FETCH_ADD,
+    ATOMIC_ADD,
+    COUNTER
+};
+
+struct job {
+    enum variant variant;
+    pthread_barrier_t barrier;
+    atomic_uintmax_t shared;
+    struct seagrass_counter counter;
+};
+
+static void *work(void *const argument) {
+    struct job *const job = argument;
+    pthread_barrier_wait(&job->barrier);
+    switch (job->variant) {
+        case FETCH_ADD: {
+            for (uintmax_t i = 0; i < COUNT; i++) {
+                atomic_fetch_add_explicit(&job->shared, 1,
+                                          memory_order_relaxed);
+            }
+            break;
+        }
+        case ATOMIC_ADD: {
+            for (uintmax_t i = 0; i < COUNT; i++) {
+                seagrass_required_true(!seagrass_uintmax_t_atomic_add(
+                        &job->shared, 1, NULL));
+            }
+            break;
+        }
+        case COUNTER: {
+            for (uintmax_t i = 0; i < COUNT; i++) {
+                seagrass_required_true(!seagrass_counter_add(&job->counter,
+                                                             1));
+            }
+            break;
+        }
+    }
+    return NULL;
+}
+
+/* Nanoseconds per increment across all threads. */
+static double run(const enum variant variant, const unsigned int threads) {
+    struct job job = {.variant = variant};
+    atomic_init(&job.shared, 0);
+    seagrass_required_true(!seagrass_counter_init(&job.counter, threads));
+    seagrass_required_true(!pthread_barrier_init(&job.barrier, NULL,
+                                                 threads + 1));
+    pthread_t *const handles = malloc(threads * sizeof(pthread_t));
+    seagrass_required(handles);
+    for (unsigned int i = 0; i < threads; i++) {
+        seagrass_required_true(!pthread_create(&handles[i], NULL, work,
+                                               &job));
+    }
+    pthread_barrier_wait(&job.barrier);
+    const uint64_t start = benchmark_now();
+    for (unsigned int i = 0; i < threads; i++) {
+        seagrass_required_true(!pthread_join(handles[i], NULL));
+    }
+    const uint64_t elapsed = benchmark_now() - start;
+    uintmax_t value = atomic_load(&job.shared);
+    if (COUNTER == variant) {
+        seagrass_required_true(!seagrass_counter_value(&job.counter,
+                                                       &value));
+    }
+    seagrass_required_true(value == (uintmax_t) COUNT * threads);
+    free(handles);
+    seagrass_required_true(!pthread_barrier_destroy(&job.barrier));
+    seagrass_required_true(!seagrass_counter_invalidate(&job.counter));
+    return (double) elapsed / ((double) COUNT * threads);
+}
+
+int main(int argc, char *argv[]) {
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    if (processors < 1) {
+        processors = 1;
+    }
+    printf("%8s %12s %12s %12s\n", "threads", "fetch_add", "atomic_add",
+           "counter");
+    printf("%8s %12s %12s %12s\n", "", "(ns/op)", "(ns/op)", "(ns/op)");
+    /* powers of two up to twice the processors, oversubscribed last */
+    for (unsigned int threads = 1; threads <= 2 * processors; threads *= 2) {
+        printf("%8u %12.3f %12.3f %12.3f\n", threads,
+               run(FETCH_ADD, threads), run(ATOMIC_ADD, threads),
+               run(COUNTER, threads));
+    }
+    return 0;
+}
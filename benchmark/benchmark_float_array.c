@@ -0,0 +1,607 @@
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "benchmark.h"
+
+#define WORDS ((BENCHMARK_ITEMS + 63) / 64)
+
+static float values[BENCHMARK_ITEMS];
+/* values with a NaN at the end */
+static float invalid[BENCHMARK_ITEMS];
+/* values close to one so that their product stays finite */
+static float factors[BENCHMARK_ITEMS];
+static float other[BENCHMARK_ITEMS];
+/* values scaled into the subnormal range */
+static float subnormal[BENCHMARK_ITEMS];
+/* updated by axpy and gemv */
+static float updated[BENCHMARK_ITEMS];
+static uint64_t mask[WORDS];
+/* magnitudes of the values, which are within the domain of sqrt and log */
+static float positive[BENCHMARK_ITEMS];
+static float results[BENCHMARK_ITEMS];
+static struct seagrass_float_tolerance absolute;
+static struct seagrass_float_tolerance relative;
+static struct seagrass_float_tolerance ulp;
+
+static void setup(uint64_t *const state) {
+    for (uintmax_t i = 0; i < BENCHMARK_ITEMS; i++) {
+        const uint64_t r = benchmark_random(state);
+        values[i] = (float) (r >> 40) / (float) (1 << 20) - 8.0f;
+        invalid[i] = values[i];
+        factors[i] = 1.0f + (float) ((r >> 8) & 0xff) / (1 << 20);
+        other[i] = (r & 1) ? values[i] : nextafterf(values[i], INFINITY);
+        subnormal[i] = values[i] * (FLT_MIN / 16);
+        updated[i] = values[i];
+        positive[i] = fabsf(values[i]) + FLT_MIN;
+    }
+    invalid[BENCHMARK_ITEMS - 1] = NAN;
+    seagrass_required_true(!seagrass_float_tolerance_init_absolute(
+            &absolute, 1e-6f));
+    seagrass_required_true(!seagrass_float_tolerance_init_relative(
+            &relative, 1e-6f));
+    seagrass_required_true(!seagrass_float_tolerance_init_ulp(&ulp, 4));
+}
+
+#define SUM_N(name, array, summation) \
+    BENCHMARK_LOOP(name, \
+        float result = 0; \
+        float error = 0; \
+        failures += 0 != seagrass_float_sum_n((array), BENCHMARK_ITEMS, \
+                                              (summation), &result, &error); \
+        BENCHMARK_KEEP(result); \
+        BENCHMARK_KEEP(error); \
+    )
+
+SUM_N(sum_n_compensated, values, SEAGRASS_FLOAT_SUMMATION_COMPENSATED)
+SUM_N(sum_n_pairwise, values, SEAGRASS_FLOAT_SUMMATION_PAIRWISE)
+SUM_N(sum_n_double, values, SEAGRASS_FLOAT_SUMMATION_DOUBLE)
+SUM_N(sum_n_compensated_subnormal, subnormal,
+      SEAGRASS_FLOAT_SUMMATION_COMPENSATED)
+SUM_N(sum_n_compensated_fast_denormals, subnormal,
+      SEAGRASS_FLOAT_SUMMATION_COMPENSATED
+      | SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS)
+SUM_N(sum_n_pairwise_subnormal, subnormal,
+      SEAGRASS_FLOAT_SUMMATION_PAIRWISE)
+SUM_N(sum_n_pairwise_fast_denormals, subnormal,
+      SEAGRASS_FLOAT_SUMMATION_PAIRWISE
+      | SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS)
+
+/* products of subnormal values and factors just above one stay subnormal */
+BENCHMARK_LOOP(multiply_subnormal,
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        float result = 0;
+        failures += 0 != seagrass_float_multiply_exact(subnormal[k],
+                                                       factors[k], &result);
+        BENCHMARK_KEEP(result);
+    }
+)
+
+BENCHMARK_LOOP(multiply_fast_denormals,
+    struct seagrass_float_fast_denormals scope;
+    seagrass_required_true(!seagrass_float_fast_denormals_begin(&scope));
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        float result = 0;
+        failures += 0 != seagrass_float_multiply_exact(subnormal[k],
+                                                       factors[k], &result);
+        BENCHMARK_KEEP(result);
+    }
+    seagrass_required_true(!seagrass_float_fast_denormals_end(&scope));
+)
+
+BENCHMARK_LOOP(multiply_normal,
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        float result = 0;
+        failures += 0 != seagrass_float_multiply_exact(values[k],
+                                                       factors[k], &result);
+        BENCHMARK_KEEP(result);
+    }
+)
+
+BENCHMARK_LOOP(sum_n_baseline,
+    float result = 0;
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        result += values[k];
+    }
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(sum_n_inconsistent,
+    float result = 0;
+    failures += 0 != seagrass_float_sum_n(
+            invalid, BENCHMARK_ITEMS, SEAGRASS_FLOAT_SUMMATION_PAIRWISE,
+            &result, NULL);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(sum_n_null,
+    float result = 0;
+    failures += 0 != seagrass_float_sum_n(
+            NULL, BENCHMARK_ITEMS, SEAGRASS_FLOAT_SUMMATION_PAIRWISE,
+            &result, NULL);
+)
+
+BENCHMARK_LOOP(minimum_n,
+    float result = 0;
+    uintmax_t index = 0;
+    failures += 0 != seagrass_float_minimum_n(values, BENCHMARK_ITEMS,
+                                              &result, &index);
+    BENCHMARK_KEEP(result);
+    BENCHMARK_KEEP(index);
+)
+
+BENCHMARK_LOOP(minimum_n_baseline,
+    float result = values[0];
+    for (uintmax_t k = 1; k < BENCHMARK_ITEMS; k++) {
+        result = values[k] < result ? values[k] : result;
+    }
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(minimum_n_inconsistent,
+    float result = 0;
+    failures += 0 != seagrass_float_minimum_n(invalid, BENCHMARK_ITEMS,
+                                              &result, NULL);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(maximum_n,
+    float result = 0;
+    uintmax_t index = 0;
+    failures += 0 != seagrass_float_maximum_n(values, BENCHMARK_ITEMS,
+                                              &result, &index);
+    BENCHMARK_KEEP(result);
+    BENCHMARK_KEEP(index);
+)
+
+BENCHMARK_LOOP(maximum_n_baseline,
+    float result = values[0];
+    for (uintmax_t k = 1; k < BENCHMARK_ITEMS; k++) {
+        result = values[k] > result ? values[k] : result;
+    }
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(minmax_n,
+    float minimum = 0;
+    float maximum = 0;
+    failures += 0 != seagrass_float_minmax_n(values, BENCHMARK_ITEMS,
+                                             &minimum, NULL, &maximum, NULL);
+    BENCHMARK_KEEP(minimum);
+    BENCHMARK_KEEP(maximum);
+)
+
+BENCHMARK_LOOP(minmax_n_null,
+    float maximum = 0;
+    failures += 0 != seagrass_float_minmax_n(values, BENCHMARK_ITEMS,
+                                             NULL, NULL, &maximum, NULL);
+)
+
+/* The matrix of gemv is the values as GEMV_ROWS rows of GEMV_COLUMNS. */
+#define GEMV_ROWS 64u
+#define GEMV_COLUMNS (BENCHMARK_ITEMS / GEMV_ROWS)
+
+BENCHMARK_LOOP(dot,
+    float result = 0;
+    failures += 0 != seagrass_float_dot(values, factors, BENCHMARK_ITEMS,
+                                        &result, NULL);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(dot_error,
+    float result = 0;
+    float error = 0;
+    failures += 0 != seagrass_float_dot(values, factors, BENCHMARK_ITEMS,
+                                        &result, &error);
+    BENCHMARK_KEEP(result);
+    BENCHMARK_KEEP(error);
+)
+
+BENCHMARK_LOOP(dot_baseline,
+    float result = 0;
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        result += values[k] * factors[k];
+    }
+    BENCHMARK_KEEP(result);
+)
+
+/* the sign alternates so that the updated values stay bounded */
+BENCHMARK_LOOP(axpy,
+    const float alpha = (i & 1) ? 1e-3f : -1e-3f;
+    failures += 0 != seagrass_float_axpy(alpha, values, BENCHMARK_ITEMS,
+                                         updated, NULL);
+    BENCHMARK_KEEP(updated[0]);
+)
+
+BENCHMARK_LOOP(axpy_calls,
+    const float alpha = (i & 1) ? 1e-3f : -1e-3f;
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        float product;
+        failures += 0 != seagrass_float_multiply(alpha, values[k], &product);
+        failures += 0 != seagrass_float_add(product, updated[k],
+                                            &updated[k]);
+    }
+    BENCHMARK_KEEP(updated[0]);
+)
+
+BENCHMARK_LOOP(gemv,
+    float result[GEMV_ROWS];
+    failures += 0 != seagrass_float_gemv(1, values, GEMV_ROWS, GEMV_COLUMNS,
+                                         factors, 0, result, NULL);
+    BENCHMARK_KEEP(result[0]);
+)
+
+BENCHMARK_LOOP(gemv_update,
+    const float beta = (i & 1) ? 0.5f : 2.0f;
+    failures += 0 != seagrass_float_gemv(1e-3f, values, GEMV_ROWS,
+                                         GEMV_COLUMNS, factors, beta,
+                                         updated, NULL);
+    BENCHMARK_KEEP(updated[0]);
+)
+
+BENCHMARK_LOOP(gemv_baseline,
+    float result[GEMV_ROWS];
+    for (uintmax_t r = 0; r < GEMV_ROWS; r++) {
+        float sum = 0;
+        for (uintmax_t c = 0; c < GEMV_COLUMNS; c++) {
+            sum += values[r * GEMV_COLUMNS + c] * factors[c];
+        }
+        result[r] = sum;
+    }
+    BENCHMARK_KEEP(result[0]);
+)
+
+#define RULES (SEAGRASS_FLOAT_RULE_FINITE | SEAGRASS_FLOAT_RULE_RANGE)
+
+BENCHMARK_LOOP(find_invalid_n,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_float_find_invalid_n(
+            values, BENCHMARK_ITEMS, RULES, -8, 8, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(find_invalid_n_baseline,
+    uintmax_t k = 0;
+    for (; k < BENCHMARK_ITEMS; k++) {
+        if (!isfinite(values[k]) || values[k] < -8 || values[k] > 8) {
+            break;
+        }
+    }
+    BENCHMARK_KEEP(k);
+)
+
+BENCHMARK_LOOP(find_invalid_n_last,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_float_find_invalid_n(
+            invalid, BENCHMARK_ITEMS, RULES, -8, 8, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(invalid_mask_n,
+    failures += 0 != seagrass_float_invalid_mask_n(
+            values, BENCHMARK_ITEMS, RULES, -8, 8, mask);
+    BENCHMARK_KEEP(mask[0]);
+)
+
+#define MATH(name, array) \
+    BENCHMARK_LOOP(float_ ## name, \
+        float result = 0; \
+        failures += 0 != seagrass_float_ ## name((array)[i], &result); \
+        BENCHMARK_KEEP(result); \
+    ) \
+    BENCHMARK_LOOP(float_ ## name ## _errno, \
+        errno = 0; \
+        const float result = name ## f((array)[i]); \
+        failures += 0 != errno; \
+        BENCHMARK_KEEP(result); \
+    ) \
+    BENCHMARK_LOOP(name ## _n, \
+        failures += 0 != seagrass_float_ ## name ## _n( \
+                (array), BENCHMARK_ITEMS, results, NULL); \
+        BENCHMARK_KEEP(results[0]); \
+    ) \
+    BENCHMARK_LOOP(name ## _n_errno, \
+        errno = 0; \
+        for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) { \
+            results[k] = name ## f((array)[k]); \
+        } \
+        failures += 0 != errno; \
+        BENCHMARK_KEEP(results[0]); \
+    )
+
+MATH(sqrt, positive)
+MATH(log, positive)
+MATH(exp, values)
+
+BENCHMARK_LOOP(float_pow,
+    float result = 0;
+    failures += 0 != seagrass_float_pow(positive[i], values[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(float_pow_errno,
+    errno = 0;
+    const float result = powf(positive[i], values[i]);
+    failures += 0 != errno;
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(pow_n,
+    failures += 0 != seagrass_float_pow_n(positive, values, BENCHMARK_ITEMS,
+                                          results, NULL);
+    BENCHMARK_KEEP(results[0]);
+)
+
+BENCHMARK_LOOP(pow_n_errno,
+    errno = 0;
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        results[k] = powf(positive[k], values[k]);
+    }
+    failures += 0 != errno;
+    BENCHMARK_KEEP(results[0]);
+)
+
+BENCHMARK_LOOP(tolerance_init_absolute,
+    struct seagrass_float_tolerance result;
+    failures += 0 != seagrass_float_tolerance_init_absolute(
+            &result, fabsf(values[i]));
+    BENCHMARK_KEEP(result.epsilon);
+)
+
+BENCHMARK_LOOP(tolerance_init_absolute_invalid,
+    struct seagrass_float_tolerance result;
+    failures += 0 != seagrass_float_tolerance_init_absolute(&result, NAN);
+)
+
+BENCHMARK_LOOP(tolerance_init_relative,
+    struct seagrass_float_tolerance result;
+    failures += 0 != seagrass_float_tolerance_init_relative(
+            &result, fabsf(values[i]));
+    BENCHMARK_KEEP(result.epsilon);
+)
+
+BENCHMARK_LOOP(tolerance_init_ulp,
+    struct seagrass_float_tolerance result;
+    failures += 0 != seagrass_float_tolerance_init_ulp(&result,
+                                                       (uint32_t) i);
+    BENCHMARK_KEEP(result.ulps);
+)
+
+#define TOLERANCE(name, object) \
+    BENCHMARK_LOOP(name ## _is_equal, \
+        bool result = false; \
+        failures += 0 != seagrass_float_tolerance_is_equal( \
+                &(object), values[i], other[i], &result); \
+        BENCHMARK_KEEP(result); \
+    ) \
+    BENCHMARK_LOOP(name ## _is_less_than, \
+        bool result = false; \
+        failures += 0 != seagrass_float_tolerance_is_less_than( \
+                &(object), values[i], other[i], &result); \
+        BENCHMARK_KEEP(result); \
+    ) \
+    BENCHMARK_LOOP(name ## _is_greater_than, \
+        bool result = false; \
+        failures += 0 != seagrass_float_tolerance_is_greater_than( \
+                &(object), values[i], other[i], &result); \
+        BENCHMARK_KEEP(result); \
+    ) \
+    BENCHMARK_LOOP(name ## _is_equal_n, \
+        failures += 0 != seagrass_float_tolerance_is_equal_n( \
+                &(object), values, other, BENCHMARK_ITEMS, mask); \
+        BENCHMARK_KEEP(mask[0]); \
+    ) \
+    BENCHMARK_LOOP(name ## _is_less_than_n, \
+        failures += 0 != seagrass_float_tolerance_is_less_than_n( \
+                &(object), values, other, BENCHMARK_ITEMS, mask); \
+        BENCHMARK_KEEP(mask[0]); \
+    ) \
+    BENCHMARK_LOOP(name ## _is_greater_than_n, \
+        failures += 0 != seagrass_float_tolerance_is_greater_than_n( \
+                &(object), values, other, BENCHMARK_ITEMS, mask); \
+        BENCHMARK_KEEP(mask[0]); \
+    )
+
+#define TOLERANCE_CASES(name) \
+    BENCHMARK_CASE_BASELINE(seagrass_float_tolerance_is_equal, #name, \
+                            name ## _is_equal, "fabsf(a - b) <= e", \
+                            tolerance_is_equal_baseline), \
+    BENCHMARK_CASE(seagrass_float_tolerance_is_less_than, #name, \
+                   name ## _is_less_than), \
+    BENCHMARK_CASE(seagrass_float_tolerance_is_greater_than, #name, \
+                   name ## _is_greater_than), \
+    BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_tolerance_is_equal_n, \
+                                  #name, name ## _is_equal_n, \
+                                  "m |= (fabsf(a[k] - b[k]) <= e) << k", \
+                                  tolerance_is_equal_n_baseline), \
+    BENCHMARK_CASE_ITEMS(seagrass_float_tolerance_is_less_than_n, #name, \
+                         name ## _is_less_than_n), \
+    BENCHMARK_CASE_ITEMS(seagrass_float_tolerance_is_greater_than_n, #name, \
+                         name ## _is_greater_than_n)
+
+TOLERANCE(absolute, absolute)
+TOLERANCE(relative, relative)
+TOLERANCE(ulp, ulp)
+
+BENCHMARK_LOOP(tolerance_is_equal_baseline,
+    BENCHMARK_KEEP(fabsf(values[i] - other[i]) <= 1e-6f);
+)
+
+BENCHMARK_LOOP(tolerance_is_equal_n_baseline,
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k += 64) {
+        uint64_t word = 0;
+        for (uintmax_t b = 0; b < 64; b++) {
+            word |= (uint64_t) (fabsf(values[k + b] - other[k + b]) <= 1e-6f)
+                    << b;
+        }
+        mask[k / 64] = word;
+    }
+    BENCHMARK_KEEP(mask[0]);
+)
+
+BENCHMARK_LOOP(tolerance_is_equal_null,
+    failures += 0 != seagrass_float_tolerance_is_equal(
+            &absolute, values[i], other[i], NULL);
+)
+
+BENCHMARK_LOOP(parallel_sum,
+    float result = 0;
+    failures += 0 != seagrass_parallel_float_sum(
+            values, BENCHMARK_ITEMS, SEAGRASS_FLOAT_SUMMATION_PAIRWISE,
+            &result, NULL);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_sum_inconsistent,
+    float result = 0;
+    failures += 0 != seagrass_parallel_float_sum(
+            invalid, BENCHMARK_ITEMS, SEAGRASS_FLOAT_SUMMATION_PAIRWISE,
+            &result, NULL);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_product,
+    float result = 0;
+    failures += 0 != seagrass_parallel_float_product(
+            factors, BENCHMARK_ITEMS, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_product_baseline,
+    float result = 1;
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        result *= factors[k];
+    }
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_minimum,
+    float result = 0;
+    failures += 0 != seagrass_parallel_float_minimum(
+            values, BENCHMARK_ITEMS, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_maximum,
+    float result = 0;
+    failures += 0 != seagrass_parallel_float_maximum(
+            values, BENCHMARK_ITEMS, &result);
+    BENCHMARK_KEEP(result);
+)
+
+static const struct benchmark_case cases[] = {
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_sum_n, "compensated",
+                                      sum_n_compensated, "s += a[k]",
+                                      sum_n_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_sum_n, "pairwise",
+                                      sum_n_pairwise, "s += a[k]",
+                                      sum_n_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_sum_n, "double",
+                                      sum_n_double, "s += a[k]",
+                                      sum_n_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_sum_n,
+                                      "compensated_subnormal",
+                                      sum_n_compensated_subnormal,
+                                      "s += a[k]", sum_n_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_sum_n,
+                                      "compensated_fast_denormals",
+                                      sum_n_compensated_fast_denormals,
+                                      "s += a[k]", sum_n_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_sum_n,
+                                      "pairwise_subnormal",
+                                      sum_n_pairwise_subnormal,
+                                      "s += a[k]", sum_n_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_sum_n,
+                                      "pairwise_fast_denormals",
+                                      sum_n_pairwise_fast_denormals,
+                                      "s += a[k]", sum_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_float_sum_n, "inconsistent",
+                             sum_n_inconsistent),
+        BENCHMARK_CASE_ITEMS(seagrass_float_sum_n, "values_is_null",
+                             sum_n_null),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_multiply_exact,
+                                      "subnormal", multiply_subnormal,
+                                      "normal operands", multiply_normal),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_multiply_exact,
+                                      "subnormal_fast_denormals",
+                                      multiply_fast_denormals,
+                                      "normal operands", multiply_normal),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_minimum_n, "success",
+                                      minimum_n, "a[k] < m ? a[k] : m",
+                                      minimum_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_float_minimum_n, "inconsistent",
+                             minimum_n_inconsistent),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_maximum_n, "success",
+                                      maximum_n, "a[k] > m ? a[k] : m",
+                                      maximum_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_float_minmax_n, "success", minmax_n),
+        BENCHMARK_CASE_ITEMS(seagrass_float_minmax_n, "out_is_null",
+                             minmax_n_null),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_dot, "success", dot,
+                                      "s += a[k] * b[k]", dot_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_dot, "error", dot_error,
+                                      "s += a[k] * b[k]", dot_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_axpy, "success", axpy,
+                                      "seagrass_float_multiply, "
+                                      "seagrass_float_add", axpy_calls),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_gemv, "success", gemv,
+                                      "y[r] = sum(m[r][c] * x[c])",
+                                      gemv_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_float_gemv, "update", gemv_update),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_find_invalid_n, "success",
+                                      find_invalid_n,
+                                      "!isfinite(a[k]) || a[k] < lo || ...",
+                                      find_invalid_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_float_find_invalid_n, "last",
+                             find_invalid_n_last),
+        BENCHMARK_CASE_ITEMS(seagrass_float_invalid_mask_n, "success",
+                             invalid_mask_n),
+        BENCHMARK_CASE_BASELINE(seagrass_float_sqrt, "success", float_sqrt,
+                                "sqrtf, errno", float_sqrt_errno),
+        BENCHMARK_CASE_BASELINE(seagrass_float_log, "success", float_log,
+                                "logf, errno", float_log_errno),
+        BENCHMARK_CASE_BASELINE(seagrass_float_exp, "success", float_exp,
+                                "expf, errno", float_exp_errno),
+        BENCHMARK_CASE_BASELINE(seagrass_float_pow, "success", float_pow,
+                                "powf, errno", float_pow_errno),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_sqrt_n, "success", sqrt_n,
+                                      "b[k] = sqrtf(a[k]), errno",
+                                      sqrt_n_errno),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_log_n, "success", log_n,
+                                      "b[k] = logf(a[k]), errno",
+                                      log_n_errno),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_exp_n, "success", exp_n,
+                                      "b[k] = expf(a[k]), errno",
+                                      exp_n_errno),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_float_pow_n, "success", pow_n,
+                                      "c[k] = powf(a[k], b[k]), errno",
+                                      pow_n_errno),
+        BENCHMARK_CASE(seagrass_float_tolerance_init_absolute, "success",
+                       tolerance_init_absolute),
+        BENCHMARK_CASE(seagrass_float_tolerance_init_absolute,
+                       "value_is_invalid", tolerance_init_absolute_invalid),
+        BENCHMARK_CASE(seagrass_float_tolerance_init_relative, "success",
+                       tolerance_init_relative),
+        BENCHMARK_CASE(seagrass_float_tolerance_init_ulp, "success",
+                       tolerance_init_ulp),
+        BENCHMARK_CASE(seagrass_float_tolerance_is_equal, "out_is_null",
+                       tolerance_is_equal_null),
+        TOLERANCE_CASES(absolute),
+        TOLERANCE_CASES(relative),
+        TOLERANCE_CASES(ulp),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_parallel_float_sum, "success",
+                                      parallel_sum, "s += a[k]",
+                                      sum_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_parallel_float_sum, "inconsistent",
+                             parallel_sum_inconsistent),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_parallel_float_product,
+                                      "success", parallel_product,
+                                      "p *= a[k]", parallel_product_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_parallel_float_minimum, "success",
+                             parallel_minimum),
+        BENCHMARK_CASE_ITEMS(seagrass_parallel_float_maximum, "success",
+                             parallel_maximum)
+};
+
+BENCHMARK_SUITE(float_array, setup, cases);
@@ -0,0 +1,327 @@
+#include <float.h>
+#include <seagrass.h>
+
+#include "benchmark.h"
+
+/*
+ * The floating point types share their interface so their cases are
+ * generated. Normal values lie in [1, 2) with few significant bits so that
+ * sums, differences and products of two of them and the square divided by
+ * either are exact. Tiny values are below half an epsilon of the normal ones
+ * so adding them leaves the result unchanged and huge values overflow when
+ * added to or multiplied by one another.
+ */
+#define FLOATING(T, MAX, EPSILON) \
+    static T T ## _normal[BENCHMARK_INPUTS]; \
+    static T T ## _other[BENCHMARK_INPUTS]; \
+    static T T ## _square[BENCHMARK_INPUTS]; \
+    static T T ## _tiny[BENCHMARK_INPUTS]; \
+    static T T ## _huge[BENCHMARK_INPUTS]; \
+    static void T ## _setup(uint64_t *const state) { \
+        for (uintmax_t i = 0; i < BENCHMARK_INPUTS; i++) { \
+            const uint64_t r = benchmark_random(state); \
+            T ## _normal[i] = (T) 1 + (T) (r & 1023) / 1024; \
+            T ## _other[i] = (T) 1 + (T) ((r >> 10) & 1023) / 1024; \
+            T ## _square[i] = T ## _normal[i] * T ## _normal[i]; \
+            T ## _tiny[i] = T ## _normal[i] * (EPSILON) / 4; \
+            T ## _huge[i] = (MAX) / 2 + T ## _normal[i] * ((MAX) / 4); \
+        } \
+    } \
+    BENCHMARK_LOOP(T ## _ptr_compare, \
+        BENCHMARK_KEEP(seagrass_ ## T ## _ptr_compare( \
+                &T ## _normal[i], &T ## _other[i])); \
+    ) \
+    BENCHMARK_LOOP(T ## _ptr_compare_baseline, \
+        const T *const a = &T ## _normal[i]; \
+        const T *const b = &T ## _other[i]; \
+        BENCHMARK_KEEP((*a > *b) - (*a < *b)); \
+    ) \
+    BENCHMARK_LOOP(T ## _compare, \
+        BENCHMARK_KEEP(seagrass_ ## T ## _compare( \
+                T ## _normal[i], T ## _other[i])); \
+    ) \
+    BENCHMARK_LOOP(T ## _compare_baseline, \
+        const T a = T ## _normal[i]; \
+        const T b = T ## _other[i]; \
+        BENCHMARK_KEEP((a > b) - (a < b)); \
+    ) \
+    BENCHMARK_LOOP(T ## _minimum, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _minimum( \
+                T ## _normal[i], T ## _other[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _minimum_baseline, \
+        const T a = T ## _normal[i]; \
+        const T b = T ## _other[i]; \
+        BENCHMARK_KEEP(a < b ? a : b); \
+    ) \
+    BENCHMARK_LOOP(T ## _minimum_null, \
+        failures += 0 != seagrass_ ## T ## _minimum( \
+                T ## _normal[i], T ## _other[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _maximum, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _maximum( \
+                T ## _normal[i], T ## _other[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _maximum_baseline, \
+        const T a = T ## _normal[i]; \
+        const T b = T ## _other[i]; \
+        BENCHMARK_KEEP(a > b ? a : b); \
+    ) \
+    BENCHMARK_LOOP(T ## _maximum_null, \
+        failures += 0 != seagrass_ ## T ## _maximum( \
+                T ## _normal[i], T ## _other[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _add, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _add( \
+                T ## _normal[i], T ## _other[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _add_baseline, \
+        BENCHMARK_KEEP(T ## _normal[i] + T ## _other[i]); \
+    ) \
+    BENCHMARK_LOOP(T ## _add_unchanged, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _add( \
+                T ## _normal[i], T ## _tiny[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _add_inconsistent, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _add( \
+                T ## _huge[i], T ## _huge[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _add_null, \
+        failures += 0 != seagrass_ ## T ## _add( \
+                T ## _normal[i], T ## _other[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _subtract, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _subtract( \
+                T ## _normal[i], T ## _other[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _subtract_baseline, \
+        BENCHMARK_KEEP(T ## _normal[i] - T ## _other[i]); \
+    ) \
+    BENCHMARK_LOOP(T ## _subtract_unchanged, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _subtract( \
+                T ## _normal[i], T ## _tiny[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _subtract_inconsistent, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _subtract( \
+                T ## _huge[i], -T ## _huge[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _subtract_null, \
+        failures += 0 != seagrass_ ## T ## _subtract( \
+                T ## _normal[i], T ## _other[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _multiply, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _multiply( \
+                T ## _normal[i], T ## _other[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _multiply_baseline, \
+        BENCHMARK_KEEP(T ## _normal[i] * T ## _other[i]); \
+    ) \
+    BENCHMARK_LOOP(T ## _multiply_inconsistent, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _multiply( \
+                T ## _huge[i], T ## _huge[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _multiply_null, \
+        failures += 0 != seagrass_ ## T ## _multiply( \
+                T ## _normal[i], T ## _other[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _divide, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _divide( \
+                T ## _square[i], T ## _normal[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _divide_baseline, \
+        BENCHMARK_KEEP(T ## _square[i] / T ## _normal[i]); \
+    ) \
+    BENCHMARK_LOOP(T ## _divide_inconsistent, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _divide( \
+                T ## _huge[i], T ## _tiny[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _divide_by_zero, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _divide( \
+                T ## _normal[i], 0, &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _divide_null, \
+        failures += 0 != seagrass_ ## T ## _divide( \
+                T ## _square[i], T ## _normal[i], NULL); \
+    ) \
+    EXACT(T, add, T ## _normal, T ## _other, T ## _huge, T ## _huge) \
+    EXACT(T, subtract, T ## _normal, T ## _other, T ## _huge, -T ## _huge) \
+    EXACT(T, multiply, T ## _normal, T ## _other, T ## _huge, T ## _huge) \
+    EXACT(T, divide, T ## _square, T ## _normal, T ## _huge, T ## _tiny) \
+    COMPARISON(T, is_equal, (a - b) == 0) \
+    COMPARISON(T, is_greater_than, a > b) \
+    COMPARISON(T, is_less_than, a < b) \
+    COMPARISON(T, is_greater_or_equal, a >= b) \
+    COMPARISON(T, is_less_or_equal, a <= b) \
+    BENCHMARK_LOOP(T ## _to_uintmax_t, \
+        uintmax_t out = 0; \
+        failures += 0 != seagrass_ ## T ## _to_uintmax_t( \
+                T ## _normal[i] * 1024, SEAGRASS_FLOAT_ROUNDING_MODE_NEAREST, \
+                &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _to_uintmax_t_baseline, \
+        BENCHMARK_KEEP((uintmax_t) (T ## _normal[i] * 1024)); \
+    ) \
+    BENCHMARK_LOOP(T ## _to_uintmax_t_negative, \
+        uintmax_t out = 0; \
+        failures += 0 != seagrass_ ## T ## _to_uintmax_t( \
+                -T ## _normal[i], SEAGRASS_FLOAT_ROUNDING_MODE_NEAREST, \
+                &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _to_uintmax_t_too_large, \
+        uintmax_t out = 0; \
+        failures += 0 != seagrass_ ## T ## _to_uintmax_t( \
+                T ## _huge[i], SEAGRASS_FLOAT_ROUNDING_MODE_NEAREST, &out); \
+        BENCHMARK_KEEP(out); \
+    )
+
+#define COMPARISON(T, name, expression) \
+    BENCHMARK_LOOP(T ## _ ## name, \
+        bool out = false; \
+        failures += 0 != seagrass_ ## T ## _ ## name( \
+                T ## _normal[i], T ## _other[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _ ## name ## _baseline, \
+        const T a = T ## _normal[i]; \
+        const T b = T ## _other[i]; \
+        BENCHMARK_KEEP(expression); \
+    ) \
+    BENCHMARK_LOOP(T ## _ ## name ## _null, \
+        failures += 0 != seagrass_ ## T ## _ ## name( \
+                T ## _normal[i], T ## _other[i], NULL); \
+    )
+
+#define EXACT(T, name, a, b, inconsistent_a, inconsistent_b) \
+    BENCHMARK_LOOP(T ## _ ## name ## _exact, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _ ## name ## _exact( \
+                a[i], b[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _ ## name ## _exact_inconsistent, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _ ## name ## _exact( \
+                inconsistent_a[i], inconsistent_b[i], &out); \
+        BENCHMARK_KEEP(out); \
+    )
+
+#define EXACT_CASES(T, name, expression) \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _ ## name ## _exact, \
+                            "success", T ## _ ## name ## _exact, expression, \
+                            T ## _ ## name ## _baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _ ## name ## _exact, "inconsistent", \
+                   T ## _ ## name ## _exact_inconsistent)
+
+#define COMPARISON_CASES(T, name, expression) \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _ ## name, "success", \
+                            T ## _ ## name, expression, \
+                            T ## _ ## name ## _baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _ ## name, "out_is_null", \
+                   T ## _ ## name ## _null)
+
+#define FLOATING_CASES(T) \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _ptr_compare, "success", \
+                            T ## _ptr_compare, "(*a > *b) - (*a < *b)", \
+                            T ## _ptr_compare_baseline), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _compare, "success", \
+                            T ## _compare, "(a > b) - (a < b)", \
+                            T ## _compare_baseline), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _minimum, "success", \
+                            T ## _minimum, "a < b ? a : b", \
+                            T ## _minimum_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _minimum, "out_is_null", \
+                   T ## _minimum_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _maximum, "success", \
+                            T ## _maximum, "a > b ? a : b", \
+                            T ## _maximum_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _maximum, "out_is_null", \
+                   T ## _maximum_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _add, "success", \
+                            T ## _add, "a + b", T ## _add_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _add, "unchanged", T ## _add_unchanged), \
+    BENCHMARK_CASE(seagrass_ ## T ## _add, "inconsistent", \
+                   T ## _add_inconsistent), \
+    BENCHMARK_CASE(seagrass_ ## T ## _add, "out_is_null", T ## _add_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _subtract, "success", \
+                            T ## _subtract, "a - b", \
+                            T ## _subtract_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _subtract, "unchanged", \
+                   T ## _subtract_unchanged), \
+    BENCHMARK_CASE(seagrass_ ## T ## _subtract, "inconsistent", \
+                   T ## _subtract_inconsistent), \
+    BENCHMARK_CASE(seagrass_ ## T ## _subtract, "out_is_null", \
+                   T ## _subtract_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _multiply, "success", \
+                            T ## _multiply, "a * b", \
+                            T ## _multiply_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _multiply, "inconsistent", \
+                   T ## _multiply_inconsistent), \
+    BENCHMARK_CASE(seagrass_ ## T ## _multiply, "out_is_null", \
+                   T ## _multiply_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _divide, "success", \
+                            T ## _divide, "a / b", T ## _divide_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _divide, "inconsistent", \
+                   T ## _divide_inconsistent), \
+    BENCHMARK_CASE(seagrass_ ## T ## _divide, "divide_by_zero", \
+                   T ## _divide_by_zero), \
+    BENCHMARK_CASE(seagrass_ ## T ## _divide, "out_is_null", \
+                   T ## _divide_null), \
+    EXACT_CASES(T, add, "a + b"), \
+    EXACT_CASES(T, subtract, "a - b"), \
+    EXACT_CASES(T, multiply, "a * b"), \
+    EXACT_CASES(T, divide, "a / b"), \
+    COMPARISON_CASES(T, is_equal, "a - b == 0"), \
+    COMPARISON_CASES(T, is_greater_than, "a > b"), \
+    COMPARISON_CASES(T, is_less_than, "a < b"), \
+    COMPARISON_CASES(T, is_greater_or_equal, "a >= b"), \
+    COMPARISON_CASES(T, is_less_or_equal, "a <= b"), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _to_uintmax_t, "success", \
+                            T ## _to_uintmax_t, "(uintmax_t) a", \
+                            T ## _to_uintmax_t_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _to_uintmax_t, "value_is_negative", \
+                   T ## _to_uintmax_t_negative), \
+    BENCHMARK_CASE(seagrass_ ## T ## _to_uintmax_t, "value_too_large", \
+                   T ## _to_uintmax_t_too_large)
+
+FLOATING(float, FLT_MAX, FLT_EPSILON)
+FLOATING(double, DBL_MAX, DBL_EPSILON)
+
+static void setup(uint64_t *const state) {
+    float_setup(state);
+    double_setup(state);
+}
+
+static const struct benchmark_case cases[] = {
+        FLOATING_CASES(float),
+        FLOATING_CASES(double)
+};
+
+BENCHMARK_SUITE(floating, setup, cases);
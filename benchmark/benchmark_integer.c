@@ -0,0 +1,218 @@
+#include <seagrass.h>
+
+#include "benchmark.h"
+
+/*
+ * The integer types share their interface so their cases are generated.
+ * Small values keep every operation in range, big values are above half the
+ * maximum so adding or multiplying two of them overflows, and low values are
+ * small for unsigned types and the negated big values for signed ones so
+ * that subtracting a big value from them overflows.
+ */
+#define INTEGER(T, MIN, MAX) \
+    static T T ## _small[BENCHMARK_INPUTS]; \
+    static T T ## _big[BENCHMARK_INPUTS]; \
+    static T T ## _low[BENCHMARK_INPUTS]; \
+    static void T ## _setup(uint64_t *const state) { \
+        for (uintmax_t i = 0; i < BENCHMARK_INPUTS; i++) { \
+            const uint64_t r = benchmark_random(state); \
+            T ## _small[i] = (T) (1 + r % 4095); \
+            T ## _big[i] = (T) ((MAX) / 2 + 1 + r % ((MAX) / 2)); \
+            T ## _low[i] = (MIN) ? (T) -T ## _big[i] : T ## _small[i]; \
+        } \
+    } \
+    BENCHMARK_LOOP(T ## _ptr_compare, \
+        BENCHMARK_KEEP(seagrass_ ## T ## _ptr_compare( \
+                &T ## _small[i], &T ## _big[i])); \
+    ) \
+    BENCHMARK_LOOP(T ## _ptr_compare_baseline, \
+        const T *const a = &T ## _small[i]; \
+        const T *const b = &T ## _big[i]; \
+        BENCHMARK_KEEP((*a > *b) - (*a < *b)); \
+    ) \
+    BENCHMARK_LOOP(T ## _compare, \
+        BENCHMARK_KEEP(seagrass_ ## T ## _compare( \
+                T ## _small[i], T ## _big[i])); \
+    ) \
+    BENCHMARK_LOOP(T ## _compare_baseline, \
+        const T a = T ## _small[i]; \
+        const T b = T ## _big[i]; \
+        BENCHMARK_KEEP((a > b) - (a < b)); \
+    ) \
+    BENCHMARK_LOOP(T ## _minimum, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _minimum( \
+                T ## _small[i], T ## _low[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _minimum_baseline, \
+        const T a = T ## _small[i]; \
+        const T b = T ## _low[i]; \
+        BENCHMARK_KEEP(a < b ? a : b); \
+    ) \
+    BENCHMARK_LOOP(T ## _minimum_null, \
+        failures += 0 != seagrass_ ## T ## _minimum( \
+                T ## _small[i], T ## _low[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _maximum, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _maximum( \
+                T ## _small[i], T ## _low[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _maximum_baseline, \
+        const T a = T ## _small[i]; \
+        const T b = T ## _low[i]; \
+        BENCHMARK_KEEP(a > b ? a : b); \
+    ) \
+    BENCHMARK_LOOP(T ## _maximum_null, \
+        failures += 0 != seagrass_ ## T ## _maximum( \
+                T ## _small[i], T ## _low[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _add, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _add( \
+                T ## _small[i], T ## _big[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _add_baseline, \
+        BENCHMARK_KEEP((T) (T ## _small[i] + T ## _big[i])); \
+    ) \
+    BENCHMARK_LOOP(T ## _add_inconsistent, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _add( \
+                T ## _big[i], T ## _big[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _add_null, \
+        failures += 0 != seagrass_ ## T ## _add( \
+                T ## _small[i], T ## _big[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _subtract, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _subtract( \
+                T ## _big[i], T ## _small[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _subtract_baseline, \
+        BENCHMARK_KEEP((T) (T ## _big[i] - T ## _small[i])); \
+    ) \
+    BENCHMARK_LOOP(T ## _subtract_inconsistent, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _subtract( \
+                T ## _low[i], T ## _big[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _subtract_null, \
+        failures += 0 != seagrass_ ## T ## _subtract( \
+                T ## _big[i], T ## _small[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _multiply, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _multiply( \
+                T ## _small[i], T ## _small[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _multiply_baseline, \
+        BENCHMARK_KEEP((T) (T ## _small[i] * T ## _small[i])); \
+    ) \
+    BENCHMARK_LOOP(T ## _multiply_inconsistent, \
+        T out = 0; \
+        failures += 0 != seagrass_ ## T ## _multiply( \
+                T ## _big[i], T ## _big[i], &out); \
+        BENCHMARK_KEEP(out); \
+    ) \
+    BENCHMARK_LOOP(T ## _multiply_null, \
+        failures += 0 != seagrass_ ## T ## _multiply( \
+                T ## _small[i], T ## _small[i], NULL); \
+    ) \
+    BENCHMARK_LOOP(T ## _divide, \
+        T quotient = 0; \
+        T remainder = 0; \
+        failures += 0 != seagrass_ ## T ## _divide( \
+                T ## _big[i], T ## _small[i], &quotient, &remainder); \
+        BENCHMARK_KEEP(quotient); \
+        BENCHMARK_KEEP(remainder); \
+    ) \
+    BENCHMARK_LOOP(T ## _divide_baseline, \
+        BENCHMARK_KEEP((T) (T ## _big[i] / T ## _small[i])); \
+        BENCHMARK_KEEP((T) (T ## _big[i] % T ## _small[i])); \
+    ) \
+    BENCHMARK_LOOP(T ## _divide_by_zero, \
+        T quotient = 0; \
+        failures += 0 != seagrass_ ## T ## _divide( \
+                T ## _big[i], 0, &quotient, NULL); \
+        BENCHMARK_KEEP(quotient); \
+    ) \
+    BENCHMARK_LOOP(T ## _divide_null, \
+        failures += 0 != seagrass_ ## T ## _divide( \
+                T ## _big[i], T ## _small[i], NULL, NULL); \
+    )
+
+#define INTEGER_CASES(T) \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _ptr_compare, "success", \
+                            T ## _ptr_compare, "(*a > *b) - (*a < *b)", \
+                            T ## _ptr_compare_baseline), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _compare, "success", \
+                            T ## _compare, "(a > b) - (a < b)", \
+                            T ## _compare_baseline), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _minimum, "success", \
+                            T ## _minimum, "a < b ? a : b", \
+                            T ## _minimum_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _minimum, "out_is_null", \
+                   T ## _minimum_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _maximum, "success", \
+                            T ## _maximum, "a > b ? a : b", \
+                            T ## _maximum_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _maximum, "out_is_null", \
+                   T ## _maximum_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _add, "success", \
+                            T ## _add, "a + b", T ## _add_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _add, "inconsistent", \
+                   T ## _add_inconsistent), \
+    BENCHMARK_CASE(seagrass_ ## T ## _add, "out_is_null", T ## _add_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _subtract, "success", \
+                            T ## _subtract, "a - b", \
+                            T ## _subtract_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _subtract, "inconsistent", \
+                   T ## _subtract_inconsistent), \
+    BENCHMARK_CASE(seagrass_ ## T ## _subtract, "out_is_null", \
+                   T ## _subtract_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _multiply, "success", \
+                            T ## _multiply, "a * b", \
+                            T ## _multiply_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _multiply, "inconsistent", \
+                   T ## _multiply_inconsistent), \
+    BENCHMARK_CASE(seagrass_ ## T ## _multiply, "out_is_null", \
+                   T ## _multiply_null), \
+    BENCHMARK_CASE_BASELINE(seagrass_ ## T ## _divide, "success", \
+                            T ## _divide, "a / b, a % b", \
+                            T ## _divide_baseline), \
+    BENCHMARK_CASE(seagrass_ ## T ## _divide, "divide_by_zero", \
+                   T ## _divide_by_zero), \
+    BENCHMARK_CASE(seagrass_ ## T ## _divide, "quotient_is_null", \
+                   T ## _divide_null)
+
+INTEGER(int32_t, INT32_MIN, INT32_MAX)
+INTEGER(int64_t, INT64_MIN, INT64_MAX)
+INTEGER(uint32_t, 0, UINT32_MAX)
+INTEGER(size_t, 0, SIZE_MAX)
+INTEGER(uintmax_t, 0, UINTMAX_MAX)
+
+static void setup(uint64_t *const state) {
+    int32_t_setup(state);
+    int64_t_setup(state);
+    uint32_t_setup(state);
+    size_t_setup(state);
+    uintmax_t_setup(state);
+}
+
+static const struct benchmark_case cases[] = {
+        INTEGER_CASES(int32_t),
+        INTEGER_CASES(int64_t),
+        INTEGER_CASES(uint32_t),
+        INTEGER_CASES(size_t),
+        INTEGER_CASES(uintmax_t)
+};
+
+BENCHMARK_SUITE(integer, setup, cases);
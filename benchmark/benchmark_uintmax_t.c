@@ -0,0 +1,796 @@
+#include <seagrass.h>
+
+#include "benchmark.h"
+
+static uintmax_t small[BENCHMARK_INPUTS];
+static uintmax_t big[BENCHMARK_INPUTS];
+static uintmax_t alignment[BENCHMARK_INPUTS];
+static struct seagrass_uintmax_t_wide wide[BENCHMARK_INPUTS];
+static struct seagrass_uintmax_t_wide wide_big[BENCHMARK_INPUTS];
+static uintmax_t items[BENCHMARK_ITEMS];
+static uintmax_t big_items[BENCHMARK_ITEMS];
+/* mostly ones so that their product does not overflow */
+static uintmax_t factors[BENCHMARK_ITEMS];
+static uintmax_t out[BENCHMARK_ITEMS];
+static uintmax_t other_out[BENCHMARK_ITEMS];
+static uint64_t mask[(BENCHMARK_ITEMS + 63) / 64];
+static struct seagrass_uintmax_t_divider divider;
+static uintmax_t divisor;
+static atomic_uintmax_t shared;
+
+static void setup(uint64_t *const state) {
+    for (uintmax_t i = 0; i < BENCHMARK_INPUTS; i++) {
+        const uint64_t r = benchmark_random(state);
+        small[i] = 1 + r % 4095;
+        big[i] = UINTMAX_MAX / 2 + 1 + r % (UINTMAX_MAX / 2);
+        alignment[i] = (uintmax_t) 1 << (r % 12);
+        wide[i] = (struct seagrass_uintmax_t_wide) {small[i], big[i]};
+        wide_big[i] = (struct seagrass_uintmax_t_wide) {big[i], big[i]};
+    }
+    for (uintmax_t i = 0; i < BENCHMARK_ITEMS; i++) {
+        items[i] = small[i % BENCHMARK_INPUTS] * (i + 1);
+        big_items[i] = big[i % BENCHMARK_INPUTS];
+        factors[i] = i % 128 ? 1 : 2;
+    }
+    divisor = 1000000007;
+    seagrass_required_true(!seagrass_uintmax_t_divider_init(&divider,
+                                                             divisor));
+}
+
+BENCHMARK_LOOP(times_and_a_half_even,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_times_and_a_half_even(
+            small[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(times_and_a_half_even_large,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_times_and_a_half_even(
+            big[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(minimum_n,
+    uintmax_t result = 0;
+    uintmax_t index = 0;
+    failures += 0 != seagrass_uintmax_t_minimum_n(
+            items, BENCHMARK_ITEMS, &result, &index);
+    BENCHMARK_KEEP(result);
+    BENCHMARK_KEEP(index);
+)
+
+BENCHMARK_LOOP(minimum_n_baseline,
+    uintmax_t result = items[0];
+    for (uintmax_t k = 1; k < BENCHMARK_ITEMS; k++) {
+        result = items[k] < result ? items[k] : result;
+    }
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(minimum_n_null,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_minimum_n(
+            NULL, BENCHMARK_ITEMS, &result, NULL);
+)
+
+BENCHMARK_LOOP(maximum_n,
+    uintmax_t result = 0;
+    uintmax_t index = 0;
+    failures += 0 != seagrass_uintmax_t_maximum_n(
+            items, BENCHMARK_ITEMS, &result, &index);
+    BENCHMARK_KEEP(result);
+    BENCHMARK_KEEP(index);
+)
+
+BENCHMARK_LOOP(maximum_n_baseline,
+    uintmax_t result = items[0];
+    for (uintmax_t k = 1; k < BENCHMARK_ITEMS; k++) {
+        result = items[k] > result ? items[k] : result;
+    }
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(minmax_n,
+    uintmax_t minimum = 0;
+    uintmax_t maximum = 0;
+    failures += 0 != seagrass_uintmax_t_minmax_n(
+            items, BENCHMARK_ITEMS, &minimum, NULL, &maximum, NULL);
+    BENCHMARK_KEEP(minimum);
+    BENCHMARK_KEEP(maximum);
+)
+
+BENCHMARK_LOOP(find_out_of_range_n,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_find_out_of_range_n(
+            items, BENCHMARK_ITEMS, 1, (uintmax_t) 1 << 24, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(find_out_of_range_n_baseline,
+    uintmax_t k = 0;
+    for (; k < BENCHMARK_ITEMS; k++) {
+        if (items[k] < 1 || items[k] > (uintmax_t) 1 << 24) {
+            break;
+        }
+    }
+    BENCHMARK_KEEP(k);
+)
+
+BENCHMARK_LOOP(out_of_range_mask_n,
+    failures += 0 != seagrass_uintmax_t_out_of_range_mask_n(
+            items, BENCHMARK_ITEMS, 1, (uintmax_t) 1 << 24, mask);
+    BENCHMARK_KEEP(mask[0]);
+)
+
+BENCHMARK_LOOP(is_power_of_two,
+    bool result = false;
+    failures += 0 != seagrass_uintmax_t_is_power_of_two(
+            alignment[i] + (small[i] & 1), &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(is_power_of_two_baseline,
+    const uintmax_t a = alignment[i] + (small[i] & 1);
+    BENCHMARK_KEEP(a && !(a & (a - 1)));
+)
+
+BENCHMARK_LOOP(is_power_of_two_null,
+    failures += 0 != seagrass_uintmax_t_is_power_of_two(small[i], NULL);
+)
+
+BENCHMARK_LOOP(next_power_of_two,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_next_power_of_two(small[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(next_power_of_two_inconsistent,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_next_power_of_two(big[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(floor_log2,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_floor_log2(small[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(floor_log2_zero,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_floor_log2(small[i] >> 12, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(ceil_log2,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_ceil_log2(small[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(ceil_log2_zero,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_ceil_log2(small[i] >> 12, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(popcount,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_popcount(big[i], &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(count_leading_zeros,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_count_leading_zeros(small[i],
+                                                            &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(count_trailing_zeros,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_count_trailing_zeros(small[i],
+                                                             &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(align_up,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_align_up(small[i], alignment[i],
+                                                 &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(align_up_baseline,
+    const uintmax_t a = alignment[i];
+    BENCHMARK_KEEP((small[i] + a - 1) & ~(a - 1));
+)
+
+BENCHMARK_LOOP(align_up_inconsistent,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_align_up(UINTMAX_MAX - small[i],
+                                                 8192, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(align_up_invalid,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_align_up(small[i], 3, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(align_down,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_align_down(small[i], alignment[i],
+                                                   &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(align_down_baseline,
+    BENCHMARK_KEEP(small[i] & ~(alignment[i] - 1));
+)
+
+BENCHMARK_LOOP(power,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_power(small[i], 3, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(power_baseline,
+    BENCHMARK_KEEP(small[i] * small[i] * small[i]);
+)
+
+BENCHMARK_LOOP(power_inconsistent,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_power(big[i], 3, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(multiply_wide,
+    struct seagrass_uintmax_t_wide result = {0};
+    failures += 0 != seagrass_uintmax_t_multiply_wide(big[i], small[i],
+                                                      &result);
+    BENCHMARK_KEEP(result.hi);
+    BENCHMARK_KEEP(result.lo);
+)
+
+BENCHMARK_LOOP(muldiv,
+    uintmax_t quotient = 0;
+    uintmax_t remainder = 0;
+    failures += 0 != seagrass_uintmax_t_muldiv(big[i], small[i], big[i],
+                                               &quotient, &remainder);
+    BENCHMARK_KEEP(quotient);
+    BENCHMARK_KEEP(remainder);
+)
+
+BENCHMARK_LOOP(muldiv_inconsistent,
+    uintmax_t quotient = 0;
+    failures += 0 != seagrass_uintmax_t_muldiv(big[i], big[i], small[i],
+                                               &quotient, NULL);
+    BENCHMARK_KEEP(quotient);
+)
+
+BENCHMARK_LOOP(muldiv_by_zero,
+    uintmax_t quotient = 0;
+    failures += 0 != seagrass_uintmax_t_muldiv(big[i], small[i], 0,
+                                               &quotient, NULL);
+    BENCHMARK_KEEP(quotient);
+)
+
+BENCHMARK_LOOP(wide_compare,
+    BENCHMARK_KEEP(seagrass_uintmax_t_wide_compare(
+            wide[i], wide[(i + 1) & (BENCHMARK_INPUTS - 1)]));
+)
+
+BENCHMARK_LOOP(wide_add,
+    struct seagrass_uintmax_t_wide result = {0};
+    failures += 0 != seagrass_uintmax_t_wide_add(wide[i], wide[i], &result);
+    BENCHMARK_KEEP(result.hi);
+    BENCHMARK_KEEP(result.lo);
+)
+
+BENCHMARK_LOOP(wide_add_inconsistent,
+    struct seagrass_uintmax_t_wide result = {0};
+    failures += 0 != seagrass_uintmax_t_wide_add(wide_big[i], wide_big[i],
+                                                 &result);
+    BENCHMARK_KEEP(result.hi);
+)
+
+BENCHMARK_LOOP(wide_subtract,
+    struct seagrass_uintmax_t_wide result = {0};
+    failures += 0 != seagrass_uintmax_t_wide_subtract(wide_big[i], wide[i],
+                                                      &result);
+    BENCHMARK_KEEP(result.hi);
+    BENCHMARK_KEEP(result.lo);
+)
+
+BENCHMARK_LOOP(wide_subtract_inconsistent,
+    struct seagrass_uintmax_t_wide result = {0};
+    failures += 0 != seagrass_uintmax_t_wide_subtract(wide[i], wide_big[i],
+                                                      &result);
+    BENCHMARK_KEEP(result.hi);
+)
+
+BENCHMARK_LOOP(saturating_add,
+    BENCHMARK_KEEP(seagrass_uintmax_t_saturating_add(big[i], big[i]));
+)
+
+BENCHMARK_LOOP(saturating_add_baseline,
+    BENCHMARK_KEEP(big[i] + big[i]);
+)
+
+BENCHMARK_LOOP(saturating_subtract,
+    BENCHMARK_KEEP(seagrass_uintmax_t_saturating_subtract(small[i], big[i]));
+)
+
+BENCHMARK_LOOP(saturating_subtract_baseline,
+    BENCHMARK_KEEP(small[i] - big[i]);
+)
+
+BENCHMARK_LOOP(saturating_multiply,
+    BENCHMARK_KEEP(seagrass_uintmax_t_saturating_multiply(big[i], small[i]));
+)
+
+BENCHMARK_LOOP(saturating_multiply_baseline,
+    BENCHMARK_KEEP(big[i] * small[i]);
+)
+
+BENCHMARK_LOOP(saturating_add_n,
+    failures += 0 != seagrass_uintmax_t_saturating_add_n(
+            items, big_items, BENCHMARK_ITEMS, out);
+    BENCHMARK_KEEP(out[i]);
+)
+
+BENCHMARK_LOOP(saturating_add_n_baseline,
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        out[k] = items[k] + big_items[k];
+    }
+    BENCHMARK_KEEP(out[i]);
+)
+
+BENCHMARK_LOOP(saturating_add_n_null,
+    failures += 0 != seagrass_uintmax_t_saturating_add_n(
+            NULL, big_items, BENCHMARK_ITEMS, out);
+)
+
+BENCHMARK_LOOP(saturating_subtract_n,
+    failures += 0 != seagrass_uintmax_t_saturating_subtract_n(
+            items, big_items, BENCHMARK_ITEMS, out);
+    BENCHMARK_KEEP(out[i]);
+)
+
+BENCHMARK_LOOP(saturating_multiply_n,
+    failures += 0 != seagrass_uintmax_t_saturating_multiply_n(
+            items, big_items, BENCHMARK_ITEMS, out);
+    BENCHMARK_KEEP(out[i]);
+)
+
+BENCHMARK_LOOP(checked_add,
+    struct seagrass_uintmax_t_checked checked;
+    seagrass_uintmax_t_checked_init(&checked, small[i]);
+    seagrass_uintmax_t_checked_add(&checked, big[i]);
+    seagrass_uintmax_t_checked_subtract(&checked, small[i]);
+    seagrass_uintmax_t_checked_multiply(&checked, 1);
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_checked_get(&checked, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(checked_add_baseline,
+    BENCHMARK_KEEP((small[i] + big[i] - small[i]) * 1);
+)
+
+BENCHMARK_LOOP(checked_add_inconsistent,
+    struct seagrass_uintmax_t_checked checked;
+    seagrass_uintmax_t_checked_init(&checked, big[i]);
+    seagrass_uintmax_t_checked_add(&checked, big[i]);
+    seagrass_uintmax_t_checked_subtract(&checked, small[i]);
+    seagrass_uintmax_t_checked_multiply(&checked, 1);
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_checked_get(&checked, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(checked_merge,
+    struct seagrass_uintmax_t_checked checked;
+    struct seagrass_uintmax_t_checked other;
+    seagrass_uintmax_t_checked_init(&checked, small[i]);
+    seagrass_uintmax_t_checked_init(&other, big[i]);
+    seagrass_uintmax_t_checked_merge(&checked, &other);
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_checked_get(&checked, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(checked_get_null,
+    failures += 0 != seagrass_uintmax_t_checked_get(NULL, out);
+)
+
+BENCHMARK_LOOP(checked_sum,
+    struct seagrass_uintmax_t_checked checked;
+    seagrass_uintmax_t_checked_init(&checked, 0);
+    failures += 0 != seagrass_uintmax_t_checked_sum(&checked, items,
+                                                    BENCHMARK_ITEMS);
+    BENCHMARK_KEEP(checked.value);
+)
+
+BENCHMARK_LOOP(checked_sum_baseline,
+    uintmax_t sum = 0;
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        sum += items[k];
+    }
+    BENCHMARK_KEEP(sum);
+)
+
+BENCHMARK_LOOP(checked_sum_inconsistent,
+    struct seagrass_uintmax_t_checked checked;
+    seagrass_uintmax_t_checked_init(&checked, 0);
+    seagrass_uintmax_t_checked_sum(&checked, big_items, BENCHMARK_ITEMS);
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_checked_get(&checked, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(checked_product,
+    struct seagrass_uintmax_t_checked checked;
+    seagrass_uintmax_t_checked_init(&checked, 1);
+    failures += 0 != seagrass_uintmax_t_checked_product(&checked, factors,
+                                                        BENCHMARK_ITEMS);
+    BENCHMARK_KEEP(checked.value);
+)
+
+BENCHMARK_LOOP(checked_product_baseline,
+    uintmax_t product = 1;
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        product *= factors[k];
+    }
+    BENCHMARK_KEEP(product);
+)
+
+BENCHMARK_LOOP(divider_init,
+    struct seagrass_uintmax_t_divider result;
+    failures += 0 != seagrass_uintmax_t_divider_init(&result, small[i]);
+    BENCHMARK_KEEP(result.magic);
+)
+
+BENCHMARK_LOOP(divider_init_by_zero,
+    struct seagrass_uintmax_t_divider result;
+    failures += 0 != seagrass_uintmax_t_divider_init(&result, 0);
+)
+
+BENCHMARK_LOOP(divider_divide,
+    uintmax_t quotient = 0;
+    uintmax_t remainder = 0;
+    failures += 0 != seagrass_uintmax_t_divider_divide(&divider, big[i],
+                                                       &quotient, &remainder);
+    BENCHMARK_KEEP(quotient);
+    BENCHMARK_KEEP(remainder);
+)
+
+BENCHMARK_LOOP(divider_divide_baseline,
+    BENCHMARK_KEEP(big[i] / divisor);
+    BENCHMARK_KEEP(big[i] % divisor);
+)
+
+BENCHMARK_LOOP(divider_divide_null,
+    failures += 0 != seagrass_uintmax_t_divider_divide(&divider, big[i],
+                                                       NULL, NULL);
+)
+
+BENCHMARK_LOOP(divider_modulo,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_uintmax_t_divider_modulo(&divider, big[i],
+                                                       &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(divider_modulo_baseline,
+    BENCHMARK_KEEP(big[i] % divisor);
+)
+
+BENCHMARK_LOOP(divider_divide_n,
+    failures += 0 != seagrass_uintmax_t_divider_divide_n(
+            &divider, big_items, BENCHMARK_ITEMS, out, other_out);
+    BENCHMARK_KEEP(out[i]);
+)
+
+BENCHMARK_LOOP(divider_divide_n_baseline,
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        out[k] = big_items[k] / divisor;
+        other_out[k] = big_items[k] % divisor;
+    }
+    BENCHMARK_KEEP(out[i]);
+)
+
+BENCHMARK_LOOP(prefix_sum_inclusive,
+    failures += 0 != seagrass_uintmax_t_prefix_sum(
+            items, BENCHMARK_ITEMS, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE,
+            out, NULL);
+    BENCHMARK_KEEP(out[i]);
+)
+
+BENCHMARK_LOOP(prefix_sum_baseline,
+    uintmax_t sum = 0;
+    for (uintmax_t k = 0; k < BENCHMARK_ITEMS; k++) {
+        sum += items[k];
+        out[k] = sum;
+    }
+    BENCHMARK_KEEP(out[i]);
+)
+
+BENCHMARK_LOOP(prefix_sum_exclusive,
+    failures += 0 != seagrass_uintmax_t_prefix_sum(
+            items, BENCHMARK_ITEMS, SEAGRASS_UINTMAX_T_PREFIX_SUM_EXCLUSIVE,
+            out, NULL);
+    BENCHMARK_KEEP(out[i]);
+)
+
+BENCHMARK_LOOP(prefix_sum_inconsistent,
+    uintmax_t index = 0;
+    failures += 0 != seagrass_uintmax_t_prefix_sum(
+            big_items, BENCHMARK_ITEMS,
+            SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE, out, &index);
+    BENCHMARK_KEEP(index);
+)
+
+BENCHMARK_LOOP(prefix_sum_null,
+    failures += 0 != seagrass_uintmax_t_prefix_sum(
+            NULL, BENCHMARK_ITEMS, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE,
+            out, NULL);
+)
+
+BENCHMARK_LOOP(atomic_add,
+    failures += 0 != seagrass_uintmax_t_atomic_add(&shared, small[i], NULL);
+)
+
+BENCHMARK_LOOP(atomic_add_baseline,
+    atomic_fetch_add_explicit(&shared, small[i], memory_order_relaxed);
+)
+
+BENCHMARK_LOOP(atomic_add_inconsistent,
+    atomic_store_explicit(&shared, big[i], memory_order_relaxed);
+    failures += 0 != seagrass_uintmax_t_atomic_add(&shared, big[i], NULL);
+)
+
+BENCHMARK_LOOP(atomic_add_null,
+    failures += 0 != seagrass_uintmax_t_atomic_add(NULL, small[i], NULL);
+)
+
+BENCHMARK_LOOP(atomic_subtract,
+    atomic_store_explicit(&shared, big[i], memory_order_relaxed);
+    failures += 0 != seagrass_uintmax_t_atomic_subtract(&shared, small[i],
+                                                        NULL);
+)
+
+BENCHMARK_LOOP(atomic_subtract_baseline,
+    atomic_store_explicit(&shared, big[i], memory_order_relaxed);
+    atomic_fetch_sub_explicit(&shared, small[i], memory_order_relaxed);
+)
+
+BENCHMARK_LOOP(atomic_subtract_inconsistent,
+    atomic_store_explicit(&shared, small[i], memory_order_relaxed);
+    failures += 0 != seagrass_uintmax_t_atomic_subtract(&shared, big[i],
+                                                        NULL);
+)
+
+BENCHMARK_LOOP(atomic_multiply,
+    atomic_store_explicit(&shared, small[i], memory_order_relaxed);
+    failures += 0 != seagrass_uintmax_t_atomic_multiply(&shared, small[i],
+                                                        NULL);
+)
+
+BENCHMARK_LOOP(atomic_multiply_inconsistent,
+    atomic_store_explicit(&shared, big[i], memory_order_relaxed);
+    failures += 0 != seagrass_uintmax_t_atomic_multiply(&shared, big[i],
+                                                        NULL);
+)
+
+BENCHMARK_LOOP(parallel_sum,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_parallel_uintmax_t_sum(items, BENCHMARK_ITEMS,
+                                                     &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_sum_inconsistent,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_parallel_uintmax_t_sum(
+            big_items, BENCHMARK_ITEMS, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_product,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_parallel_uintmax_t_product(
+            factors, BENCHMARK_ITEMS, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_product_inconsistent,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_parallel_uintmax_t_product(
+            big_items, BENCHMARK_ITEMS, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_minimum,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_parallel_uintmax_t_minimum(
+            items, BENCHMARK_ITEMS, &result);
+    BENCHMARK_KEEP(result);
+)
+
+BENCHMARK_LOOP(parallel_maximum,
+    uintmax_t result = 0;
+    failures += 0 != seagrass_parallel_uintmax_t_maximum(
+            items, BENCHMARK_ITEMS, &result);
+    BENCHMARK_KEEP(result);
+)
+
+static const struct benchmark_case cases[] = {
+        BENCHMARK_CASE(seagrass_uintmax_t_times_and_a_half_even, "success",
+                       times_and_a_half_even),
+        BENCHMARK_CASE(seagrass_uintmax_t_times_and_a_half_even, "large",
+                       times_and_a_half_even_large),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_uintmax_t_minimum_n, "success",
+                                      minimum_n, "a[k] < m ? a[k] : m",
+                                      minimum_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_minimum_n, "values_is_null",
+                             minimum_n_null),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_uintmax_t_maximum_n, "success",
+                                      maximum_n, "a[k] > m ? a[k] : m",
+                                      maximum_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_minmax_n, "success",
+                             minmax_n),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_uintmax_t_find_out_of_range_n,
+                                      "success", find_out_of_range_n,
+                                      "a[k] < lo || a[k] > hi",
+                                      find_out_of_range_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_out_of_range_mask_n,
+                             "success", out_of_range_mask_n),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_is_power_of_two,
+                                "success", is_power_of_two,
+                                "a && !(a & (a - 1))",
+                                is_power_of_two_baseline),
+        BENCHMARK_CASE(seagrass_uintmax_t_is_power_of_two, "out_is_null",
+                       is_power_of_two_null),
+        BENCHMARK_CASE(seagrass_uintmax_t_next_power_of_two, "success",
+                       next_power_of_two),
+        BENCHMARK_CASE(seagrass_uintmax_t_next_power_of_two, "inconsistent",
+                       next_power_of_two_inconsistent),
+        BENCHMARK_CASE(seagrass_uintmax_t_floor_log2, "success", floor_log2),
+        BENCHMARK_CASE(seagrass_uintmax_t_floor_log2, "value_is_invalid",
+                       floor_log2_zero),
+        BENCHMARK_CASE(seagrass_uintmax_t_ceil_log2, "success", ceil_log2),
+        BENCHMARK_CASE(seagrass_uintmax_t_ceil_log2, "value_is_invalid",
+                       ceil_log2_zero),
+        BENCHMARK_CASE(seagrass_uintmax_t_popcount, "success", popcount),
+        BENCHMARK_CASE(seagrass_uintmax_t_count_leading_zeros, "success",
+                       count_leading_zeros),
+        BENCHMARK_CASE(seagrass_uintmax_t_count_trailing_zeros, "success",
+                       count_trailing_zeros),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_align_up, "success",
+                                align_up, "(a + m - 1) & ~(m - 1)",
+                                align_up_baseline),
+        BENCHMARK_CASE(seagrass_uintmax_t_align_up, "inconsistent",
+                       align_up_inconsistent),
+        BENCHMARK_CASE(seagrass_uintmax_t_align_up, "value_is_invalid",
+                       align_up_invalid),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_align_down, "success",
+                                align_down, "a & ~(m - 1)",
+                                align_down_baseline),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_power, "success", power,
+                                "a * a * a", power_baseline),
+        BENCHMARK_CASE(seagrass_uintmax_t_power, "inconsistent",
+                       power_inconsistent),
+        BENCHMARK_CASE(seagrass_uintmax_t_multiply_wide, "success",
+                       multiply_wide),
+        BENCHMARK_CASE(seagrass_uintmax_t_muldiv, "success", muldiv),
+        BENCHMARK_CASE(seagrass_uintmax_t_muldiv, "inconsistent",
+                       muldiv_inconsistent),
+        BENCHMARK_CASE(seagrass_uintmax_t_muldiv, "divide_by_zero",
+                       muldiv_by_zero),
+        BENCHMARK_CASE(seagrass_uintmax_t_wide_compare, "success",
+                       wide_compare),
+        BENCHMARK_CASE(seagrass_uintmax_t_wide_add, "success", wide_add),
+        BENCHMARK_CASE(seagrass_uintmax_t_wide_add, "inconsistent",
+                       wide_add_inconsistent),
+        BENCHMARK_CASE(seagrass_uintmax_t_wide_subtract, "success",
+                       wide_subtract),
+        BENCHMARK_CASE(seagrass_uintmax_t_wide_subtract, "inconsistent",
+                       wide_subtract_inconsistent),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_saturating_add,
+                                "saturated", saturating_add, "a + b",
+                                saturating_add_baseline),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_saturating_subtract,
+                                "saturated", saturating_subtract, "a - b",
+                                saturating_subtract_baseline),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_saturating_multiply,
+                                "saturated", saturating_multiply, "a * b",
+                                saturating_multiply_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_uintmax_t_saturating_add_n,
+                                      "success", saturating_add_n,
+                                      "c[k] = a[k] + b[k]",
+                                      saturating_add_n_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_saturating_add_n,
+                             "values_is_null", saturating_add_n_null),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_saturating_subtract_n,
+                             "success", saturating_subtract_n),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_saturating_multiply_n,
+                             "success", saturating_multiply_n),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_checked_add, "success",
+                                checked_add, "(a + b - a) * 1",
+                                checked_add_baseline),
+        BENCHMARK_CASE(seagrass_uintmax_t_checked_add, "inconsistent",
+                       checked_add_inconsistent),
+        BENCHMARK_CASE(seagrass_uintmax_t_checked_merge, "success",
+                       checked_merge),
+        BENCHMARK_CASE(seagrass_uintmax_t_checked_get, "object_is_null",
+                       checked_get_null),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_uintmax_t_checked_sum,
+                                      "success", checked_sum, "s += a[k]",
+                                      checked_sum_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_checked_sum, "inconsistent",
+                             checked_sum_inconsistent),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_uintmax_t_checked_product,
+                                      "success", checked_product,
+                                      "p *= a[k]", checked_product_baseline),
+        BENCHMARK_CASE(seagrass_uintmax_t_divider_init, "success",
+                       divider_init),
+        BENCHMARK_CASE(seagrass_uintmax_t_divider_init, "divide_by_zero",
+                       divider_init_by_zero),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_divider_divide, "success",
+                                divider_divide, "a / d, a % d",
+                                divider_divide_baseline),
+        BENCHMARK_CASE(seagrass_uintmax_t_divider_divide, "quotient_is_null",
+                       divider_divide_null),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_divider_modulo, "success",
+                                divider_modulo, "a % d",
+                                divider_modulo_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_uintmax_t_divider_divide_n,
+                                      "success", divider_divide_n,
+                                      "q[k] = a[k] / d, r[k] = a[k] % d",
+                                      divider_divide_n_baseline),
+        BENCHMARK_CASE_ITEMS_BASELINE(seagrass_uintmax_t_prefix_sum,
+                                      "inclusive", prefix_sum_inclusive,
+                                      "s += a[k], b[k] = s",
+                                      prefix_sum_baseline),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_prefix_sum, "exclusive",
+                             prefix_sum_exclusive),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_prefix_sum, "inconsistent",
+                             prefix_sum_inconsistent),
+        BENCHMARK_CASE_ITEMS(seagrass_uintmax_t_prefix_sum, "values_is_null",
+                             prefix_sum_null),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_atomic_add, "success",
+                                atomic_add, "atomic_fetch_add(a, b)",
+                                atomic_add_baseline),
+        BENCHMARK_CASE(seagrass_uintmax_t_atomic_add, "inconsistent",
+                       atomic_add_inconsistent),
+        BENCHMARK_CASE(seagrass_uintmax_t_atomic_add, "object_is_null",
+                       atomic_add_null),
+        BENCHMARK_CASE_BASELINE(seagrass_uintmax_t_atomic_subtract,
+                                "success", atomic_subtract,
+                                "atomic_store(a, c), atomic_fetch_sub(a, b)",
+                                atomic_subtract_baseline),
+        BENCHMARK_CASE(seagrass_uintmax_t_atomic_subtract, "inconsistent",
+                       atomic_subtract_inconsistent),
+        BENCHMARK_CASE(seagrass_uintmax_t_atomic_multiply, "success",
+                       atomic_multiply),
+        BENCHMARK_CASE(seagrass_uintmax_t_atomic_multiply, "inconsistent",
+                       atomic_multiply_inconsistent),
+        BENCHMARK_CASE_ITEMS(seagrass_parallel_uintmax_t_sum, "success",
+                             parallel_sum),
+        BENCHMARK_CASE_ITEMS(seagrass_parallel_uintmax_t_sum, "inconsistent",
+                             parallel_sum_inconsistent),
+        BENCHMARK_CASE_ITEMS(seagrass_parallel_uintmax_t_product, "success",
+                             parallel_product),
+        BENCHMARK_CASE_ITEMS(seagrass_parallel_uintmax_t_product,
+                             "inconsistent", parallel_product_inconsistent),
+        BENCHMARK_CASE_ITEMS(seagrass_parallel_uintmax_t_minimum, "success",
+                             parallel_minimum),
+        BENCHMARK_CASE_ITEMS(seagrass_parallel_uintmax_t_maximum, "success",
+                             parallel_maximum)
+};
+
+BENCHMARK_SUITE(uintmax_t, setup, cases);
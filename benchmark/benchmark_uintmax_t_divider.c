@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "benchmark.h"
+
+#define COUNT (1u << 20)
+#define ROUNDS 16
+
+static void run(const uintmax_t *const values, uintmax_t *const out,
+                const uintmax_t divisor) {
+    struct seagrass_uintmax_t_divider divider;
+    seagrass_required_true(!seagrass_uintmax_t_divider_init(&divider,
+                                                             divisor));
+    uint64_t start = benchmark_now();
+    for (unsigned int r = 0; r < ROUNDS; r++) {
+        for (uintmax_t i = 0; i < COUNT; i++) {
+            seagrass_required_true(!seagrass_uintmax_t_divide(
+                    values[i], divisor, &out[i], NULL));
+        }
+        BENCHMARK_KEEP(out[r]);
+    }
+    const double divide = (double) (benchmark_now() - start)
+                          / ((double) COUNT * ROUNDS);
+    start = benchmark_now();
+    for (unsigned int r = 0; r < ROUNDS; r++) {
+        for (uintmax_t i = 0; i < COUNT; i++) {
+            seagrass_required_true(!seagrass_uintmax_t_divider_divide(
+                    &divider, values[i], &out[i], NULL));
+        }
+        BENCHMARK_KEEP(out[r]);
+    }
+    const double divider_divide = (double) (benchmark_now() - start)
+                                  / ((double) COUNT * ROUNDS);
+    start = benchmark_now();
+    for (unsigned int r = 0; r < ROUNDS; r++) {
+        seagrass_required_true(!seagrass_uintmax_t_divider_divide_n(
+                &divider, values, COUNT, out, NULL));
+        BENCHMARK_KEEP(out[r]);
+    }
+    const double divider_divide_n = (double) (benchmark_now() - start)
+                                    / ((double) COUNT * ROUNDS);
+    printf("%20ju %12.3f %12.3f %12.3f\n", divisor, divide, divider_divide,
+           divider_divide_n);
+}
+
+int main(int argc, char *argv[]) {
+    uintmax_t *values = malloc(COUNT * sizeof(uintmax_t));
+    uintmax_t *out = malloc(COUNT * sizeof(uintmax_t));
+    if (!values || !out) {
+        perror("malloc");
+        return EXIT_FAILURE;
+    }
+    uint64_t state = 88172645463325252ULL;
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = benchmark_random(&state);
+    }
+    printf("%20s %12s %12s %12s\n", "divisor", "divide",
+           "divider", "divider_n");
+    printf("%20s %12s %12s %12s\n", "", "(ns/op)", "(ns/op)", "(ns/op)");
+    const uintmax_t divisors[] = {
+            3, 7, 10, 64, 1000, 1000000007, UINTMAX_MAX / 3
+    };
+    for (size_t i = 0; i < sizeof(divisors) / sizeof(divisors[0]); i++) {
+        run(values, out, divisors[i]);
+    }
+    free(values);
+    free(out);
+    return 0;
+}
@@ -5,8 +5,73 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include <seagrass/counter.h>
+#include <seagrass/double.h>
 #include <seagrass/float.h>
+#include <seagrass/float_tolerance.h>
+#include <seagrass/histogram.h>
+#include <seagrass/instrumentation.h>
+#include <seagrass/int32_t.h>
+#include <seagrass/int64_t.h>
+#include <seagrass/parallel.h>
+#include <seagrass/size_t.h>
+#include <seagrass/stats.h>
+#include <seagrass/uint32_t.h>
 #include <seagrass/uintmax_t.h>
+#include <seagrass/uintmax_t_atomic.h>
+#include <seagrass/uintmax_t_bits.h>
+#include <seagrass/uintmax_t_checked.h>
+#include <seagrass/uintmax_t_divider.h>
+#include <seagrass/uintmax_t_prefix_sum.h>
+#include <seagrass/uintmax_t_saturating.h>
+#include <seagrass/uintmax_t_wide.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SEAGRASS_LIKELY(x) __builtin_expect(!!(x), 1)
+#define SEAGRASS_COLD __attribute__((cold, noinline))
+#else
+#define SEAGRASS_LIKELY(x) (x)
+#define SEAGRASS_COLD
+#endif
+
+/* abort(3) is overridden to return in the unit tests, which the Debug build
+ * of the library compiles with SEAGRASS_TEST */
+#ifdef SEAGRASS_TEST
+#define SEAGRASS_NORETURN
+#else
+#define SEAGRASS_NORETURN _Noreturn
+#endif
+
+/**
+ * @brief Hook called when a requirement fails.
+ * @param [in] file source file of the requirement or <i>NULL</i> if it was
+ * checked by the seagrass_required or seagrass_required_true function rather
+ * than the macro.
+ * @param [in] line of the requirement in file or <i>0</i>.
+ * @param [in] expression that failed.
+ * @note abort(3) is called once the hook returns.
+ */
+typedef void (*seagrass_required_handler)(const char *file, int line,
+                                          const char *expression);
+
+/**
+ * @brief Install the hook called when a requirement fails.
+ * @param [in] handler hook to install or <i>NULL</i> for the default which
+ * writes the failed requirement to stderr.
+ * @return the hook that was installed before.
+ */
+seagrass_required_handler seagrass_required_set_handler(
+        seagrass_required_handler handler);
+
+/**
+ * @brief Report a failed requirement to the hook and abort.
+ * @param [in] file source file of the requirement.
+ * @param [in] line of the requirement in file.
+ * @param [in] expression that failed.
+ * @note abort(3) once the hook returns.
+ */
+SEAGRASS_NORETURN void seagrass_required_failed(
+        const char *file, int line, const char *expression) SEAGRASS_COLD;
 
 /**
  * @brief Require that object be non-<i>NULL</i>.
@@ -22,6 +87,21 @@ void seagrass_required(const void *object);
  */
 void seagrass_required_true(int check);
 
+/*
+ * The macros below inline the checks of the functions above with the
+ * failure branch marked as unlikely, so only a failed requirement calls out
+ * of line. The functions remain available as (seagrass_required)(object) and
+ * (seagrass_required_true)(check).
+ */
+
+#define seagrass_required(object) \
+    (SEAGRASS_LIKELY(NULL != (object)) ? (void) 0 \
+     : seagrass_required_failed(__FILE__, __LINE__, #object " is NULL"))
+
+#define seagrass_required_true(check) \
+    (SEAGRASS_LIKELY(check) ? (void) 0 \
+     : seagrass_required_failed(__FILE__, __LINE__, #check))
+
 /**
  * @brief Comparison function for void*.
  * @param [in] a first void*.
@@ -32,4 +112,149 @@ void seagrass_required_true(int check);
  */
 int seagrass_void_ptr_compare(const void *a, const void *b);
 
+/* size_t is selected by the default association, as it is the same type as
+ * uint32_t or uintmax_t on some targets and a type of its own on others,
+ * which the preprocessor cannot tell apart. */
+#define SEAGRASS_GENERIC(x, type, name) \
+    _Generic((x), \
+        uint32_t type: seagrass_uint32_t_ ## name, \
+        int32_t type: seagrass_int32_t_ ## name, \
+        int64_t type: seagrass_int64_t_ ## name, \
+        uintmax_t type: seagrass_uintmax_t_ ## name, \
+        float type: seagrass_float_ ## name, \
+        double type: seagrass_double_ ## name, \
+        default: _Generic((x), \
+            size_t type: seagrass_size_t_ ## name, \
+            default: (void) 0))
+
+#define SEAGRASS_GENERIC_IS_FLOATING(x) \
+    _Generic((x), \
+        float: 1, \
+        double: 1, \
+        long double: 1, \
+        default: 0)
+
+#define SEAGRASS_GENERIC_IS_ARITHMETIC(x) \
+    _Generic((x), \
+        _Bool: 1, \
+        char: 1, \
+        signed char: 1, \
+        unsigned char: 1, \
+        short: 1, \
+        unsigned short: 1, \
+        int: 1, \
+        unsigned int: 1, \
+        long: 1, \
+        unsigned long: 1, \
+        long long: 1, \
+        unsigned long long: 1, \
+        default: SEAGRASS_GENERIC_IS_FLOATING(x))
+
+/**
+ * @brief Check at compile time whether <b>a</b> converts to the type of
+ * <b>x</b> without narrowing.
+ * @param [in] a value to convert.
+ * @param [in] x value of the type converted to.
+ * @return <i>1</i> if <b>a</b> is of an arithmetic type that is no wider
+ * than the type of <b>x</b> and not a floating type if <b>x</b> is an
+ * integer, otherwise <i>0</i>.
+ */
+#define SEAGRASS_GENERIC_FITS(a, x) \
+    (SEAGRASS_GENERIC_IS_ARITHMETIC(a) \
+     && sizeof(a) <= sizeof(x) \
+     && (SEAGRASS_GENERIC_IS_FLOATING(x) \
+         || !SEAGRASS_GENERIC_IS_FLOATING(a)))
+
+#define SEAGRASS_GENERIC_REQUIRED(a, b, x) \
+    ((void) sizeof(struct { \
+        _Static_assert(SEAGRASS_GENERIC_FITS(a, x) \
+                       && SEAGRASS_GENERIC_FITS(b, x), \
+                       "operands must not be narrowed to the result type"); \
+        int unused; \
+    }))
+
+/**
+ * @brief Type generic comparison.
+ * @param [in] a first value.
+ * @param [in] b second value.
+ * @return <i>-1</i> if <b>a</b> is <u>less than</u> <b>b</b>,
+ * <i>0</i> if <b>a</b> is <u>equal to</u> <b>b</b> or <i>1</i> if <b>a</b> is
+ * <u>greater than</u> <b>b</b>.
+ * @note The typed function is selected at compile time from the type of
+ * <b>a</b>, compilation fails if <b>b</b> would be narrowed to it.
+ */
+#define seagrass_compare(a, b) \
+    (SEAGRASS_GENERIC_REQUIRED((a), (b), (a)), \
+     SEAGRASS_GENERIC((a), , compare)((a), (b)))
+
+/**
+ * @brief Type generic minimum.
+ * @param [in] a first value.
+ * @param [in] b second value.
+ * @param [out] out receive the minimum.
+ * @return On success <i>0</i>, otherwise the typed error code.
+ * @note The typed function is selected at compile time from the type of
+ * <b>out</b>, compilation fails if <b>a</b> or <b>b</b> would be narrowed
+ * to it.
+ */
+#define seagrass_minimum(a, b, out) \
+    (SEAGRASS_GENERIC_REQUIRED((a), (b), *(out)), \
+     SEAGRASS_GENERIC((out), *, minimum)((a), (b), (out)))
+
+/**
+ * @brief Type generic maximum.
+ * @param [in] a first value.
+ * @param [in] b second value.
+ * @param [out] out receive the maximum.
+ * @return On success <i>0</i>, otherwise the typed error code.
+ * @note The typed function is selected at compile time from the type of
+ * <b>out</b>, compilation fails if <b>a</b> or <b>b</b> would be narrowed
+ * to it.
+ */
+#define seagrass_maximum(a, b, out) \
+    (SEAGRASS_GENERIC_REQUIRED((a), (b), *(out)), \
+     SEAGRASS_GENERIC((out), *, maximum)((a), (b), (out)))
+
+/**
+ * @brief Type generic addition.
+ * @param [in] a first value.
+ * @param [in] b second value.
+ * @param [out] out receive the sum.
+ * @return On success <i>0</i>, otherwise the typed error code.
+ * @note The typed function is selected at compile time from the type of
+ * <b>out</b>, compilation fails if <b>a</b> or <b>b</b> would be narrowed
+ * to it.
+ */
+#define seagrass_add(a, b, out) \
+    (SEAGRASS_GENERIC_REQUIRED((a), (b), *(out)), \
+     SEAGRASS_GENERIC((out), *, add)((a), (b), (out)))
+
+/**
+ * @brief Type generic subtraction.
+ * @param [in] a first value.
+ * @param [in] b second value.
+ * @param [out] out receive the difference.
+ * @return On success <i>0</i>, otherwise the typed error code.
+ * @note The typed function is selected at compile time from the type of
+ * <b>out</b>, compilation fails if <b>a</b> or <b>b</b> would be narrowed
+ * to it.
+ */
+#define seagrass_subtract(a, b, out) \
+    (SEAGRASS_GENERIC_REQUIRED((a), (b), *(out)), \
+     SEAGRASS_GENERIC((out), *, subtract)((a), (b), (out)))
+
+/**
+ * @brief Type generic multiplication.
+ * @param [in] a first value.
+ * @param [in] b second value.
+ * @param [out] out receive the product.
+ * @return On success <i>0</i>, otherwise the typed error code.
+ * @note The typed function is selected at compile time from the type of
+ * <b>out</b>, compilation fails if <b>a</b> or <b>b</b> would be narrowed
+ * to it.
+ */
+#define seagrass_multiply(a, b, out) \
+    (SEAGRASS_GENERIC_REQUIRED((a), (b), *(out)), \
+     SEAGRASS_GENERIC((out), *, multiply)((a), (b), (out)))
+
 #endif /* _SEAGRASS_SEAGRASS_H_ */
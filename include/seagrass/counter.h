@@ -0,0 +1,84 @@
+#ifndef _SEAGRASS_COUNTER_H_
+#define _SEAGRASS_COUNTER_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL \
+    SEA_URCHIN_ERROR_OBJECT_IS_NULL
+#define SEAGRASS_COUNTER_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_COUNTER_ERROR_SLOTS_IS_ZERO \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_COUNTER_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+#define SEAGRASS_COUNTER_ERROR_MEMORY_ALLOCATION_FAILED \
+    SEA_URCHIN_ERROR_MEMORY_ALLOCATION_FAILED
+
+/**
+ * @brief Counter that threads add to without contending.
+ * <p>Each slot of the counter fills a cache line of its own. A thread owns
+ * the slot of its identity, a small number it is handed on its first add and
+ * gives back when it exits, and adds to it with a relaxed atomic load and
+ * store. Threads without a slot of their own share an extra slot which they
+ * add to with seagrass_uintmax_t_atomic_add(). Reading the counter adds up
+ * the slots.</p>
+ */
+struct seagrass_counter {
+    uintmax_t slots;
+    _Atomic(uintmax_t) *counts;
+};
+
+/**
+ * @brief Initialize counter to zero.
+ * @param [in] object instance to be initialized.
+ * @param [in] slots number of slots, one per thread adding at once avoids
+ * contention. Threads past the first 1024 running at once add to the shared
+ * slot whatever the number of slots.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_COUNTER_ERROR_SLOTS_IS_ZERO if slots is zero.
+ * @throws SEAGRASS_COUNTER_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the slots.
+ */
+int seagrass_counter_init(struct seagrass_counter *object, uintmax_t slots);
+
+/**
+ * @brief Invalidate counter, releasing its slots.
+ * @param [in] object instance to be invalidated.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ */
+int seagrass_counter_invalidate(struct seagrass_counter *object);
+
+/**
+ * @brief Add to the counter.
+ * @param [in] object counter.
+ * @param [in] value to be added.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_COUNTER_ERROR_RESULT_IS_INCONSISTENT if the slot of the
+ * calling thread would overflow, in which case it is unchanged.
+ * @note Safe to call from any number of threads at once.
+ */
+int seagrass_counter_add(struct seagrass_counter *object, uintmax_t value);
+
+/**
+ * @brief Retrieve the value of the counter.
+ * @param [in] object counter.
+ * @param [out] out receive the sum of the slots.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_COUNTER_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_COUNTER_ERROR_RESULT_IS_INCONSISTENT if the sum of the
+ * slots overflows, just as seagrass_uintmax_t_add() would have.
+ * @note Additions made while the value is retrieved may or may not be part
+ * of it.
+ */
+int seagrass_counter_value(const struct seagrass_counter *object,
+                           uintmax_t *out);
+
+#endif /* _SEAGRASS_COUNTER_H_ */
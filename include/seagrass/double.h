@@ -0,0 +1,260 @@
+#ifndef _SEAGRASS_DOUBLE_H_
+#define _SEAGRASS_DOUBLE_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+#include <seagrass/float.h>
+
+#define SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_DOUBLE_ERROR_ROUNDING_MODE_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_DOUBLE_ERROR_FLOAT_VALUE_TOO_LARGE \
+    SEA_URCHIN_ERROR_VALUE_IS_TOO_LARGE
+#define SEAGRASS_DOUBLE_ERROR_FLOAT_VALUE_IS_NEGATIVE \
+    SEA_URCHIN_ERROR_VALUE_IS_NEGATIVE
+#define SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+#define SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED \
+    SEA_URCHIN_ERROR_RESULT_IS_UNCHANGED
+#define SEAGRASS_DOUBLE_ERROR_DIVIDE_BY_ZERO \
+    SEA_URCHIN_ERROR_DIVIDE_BY_ZERO
+
+/**
+ * @brief Comparison function for double*.
+ * @param [in] a first double*.
+ * @param [in] b second double*.
+ * @return <i>-1</i> if <b>a</b> is <u>less than</u> <b>b</b>,
+ * <i>0</i> if <b>a</b> is <u>equal to</u> <b>b</b> or <i>1</i> if <b>a</b> is
+ * <u>greater than</u> <b>b</b>.
+ * @note If <b>a</b> and <b>b</b> is <i>NULL</i> then abort(3) is called.
+ */
+int seagrass_double_ptr_compare(const double *a, const double *b);
+
+/**
+ * @brief Comparison function for double.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @return <i>-1</i> if <b>a</b> is <u>less than</u> <b>b</b>,
+ * <i>0</i> if <b>a</b> is <u>equal to</u> <b>b</b> or <i>1</i> if <b>a</b> is
+ * <u>greater than</u> <b>b</b>.
+ */
+int seagrass_double_compare(double a, double b);
+
+/**
+ * @brief Return the smaller double value.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the smaller between the first or second values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_double_minimum(double a, double b, double *out);
+
+/**
+ * @brief Return the larger double value.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the larger between the first or second values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_double_maximum(double a, double b, double *out);
+
+/**
+ * @brief Add two double values together.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the result of the two added values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT if the added values'
+ * result is not consistent.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED if there is expected to be
+ * a change in the result, but there was none.
+ */
+int seagrass_double_add(double a, double b, double *out);
+
+/**
+ * @brief Subtract the second value from the first.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the result of the two subtracted values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT if the subtracted
+ * values' result is not consistent.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED if there is expected to be
+ * a change in the result, but there was none.
+ */
+int seagrass_double_subtract(double a, double b, double *out);
+
+/**
+ * @brief Multiply two double values together.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the result of the two multiplied values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT if the multiplied
+ * values' result is not consistent.
+ */
+int seagrass_double_multiply(double a, double b, double *out);
+
+/**
+ * @brief Divide the first value by the second.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the result of the division operation.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_DOUBLE_ERROR_DIVIDE_BY_ZERO if b is zero.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT if the divided value
+ * result is not consistent.
+ */
+int seagrass_double_divide(double a, double b, double *out);
+
+/*
+ * The exact variants below only accept a result equal to the exact result
+ * of the operation, where the functions above allow a tolerance. They
+ * measure the rounding error, with TwoSum for sums and the residual of the
+ * product with fma() for products and quotients, which costs a few
+ * operations on doubles.
+ */
+
+/**
+ * @brief Add two double values together, checking the result exactly.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the result of the two added values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT if the result is not
+ * finite or not exact.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED if a non-zero value was
+ * added but the result equals the other value.
+ */
+int seagrass_double_add_exact(double a, double b, double *out);
+
+/**
+ * @brief Subtract the second value from the first, checking the result
+ * exactly.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the result of the two subtracted values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT if the result is not
+ * finite or not exact.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED if a non-zero value was
+ * subtracted but the result equals the first value, or the result equals
+ * <i>-b</i> although a is non-zero.
+ */
+int seagrass_double_subtract_exact(double a, double b, double *out);
+
+/**
+ * @brief Multiply two double values together, checking the result exactly.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the result of the two multiplied values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT if the result is not
+ * finite or not exact, e.g. rounded to a subnormal number or to zero.
+ */
+int seagrass_double_multiply_exact(double a, double b, double *out);
+
+/**
+ * @brief Divide the first value by the second, checking the result exactly.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out receive the result of the division operation.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_DOUBLE_ERROR_DIVIDE_BY_ZERO if b is zero.
+ * @throws SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT if the result is not
+ * finite or not exact, e.g. rounded to a subnormal number or to zero.
+ */
+int seagrass_double_divide_exact(double a, double b, double *out);
+
+/**
+ * @brief Are the two double values considered equal.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out true if they are considered equal, false otherwise.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if the out is <i>NULL</i>.
+ */
+int seagrass_double_is_equal(double a, double b, bool *out);
+
+/**
+ * @brief Is the first value considered greater than the second value.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out true if <b>a</b> is considered greater than <b>b</b>,
+ * false otherwise.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_double_is_greater_than(double a, double b, bool *out);
+
+/**
+ * @brief Is the first value considered less than the second value.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out true if <b>a</b> is considered less than <b>b</b>,
+ * false otherwise.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_double_is_less_than(double a, double b, bool *out);
+
+/**
+ * @brief Is the first value considered greater than or equal to the second
+ * value.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out true if <b>a</b> is considered greater than or
+ * equal to <b>b</b>, false otherwise.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_double_is_greater_or_equal(double a, double b, bool *out);
+
+/**
+ * @brief Is the first value considered less than or equal to the second
+ * value.
+ * @param [in] a first double.
+ * @param [in] b second double.
+ * @param [out] out true if <b>a</b> is considered less than or equal to
+ * <b>b</b>, false otherwise.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_double_is_less_or_equal(double a, double b, bool *out);
+
+/**
+ * @brief Convert the double value to a uintmax_t value.
+ * @param [in] a double value.
+ * @param [in] mode rounding to apply to double in order to convert it to a
+ * uintmax_t.
+ * @param [out] out receive the uintmax_t value of the double.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_DOUBLE_ERROR_FLOAT_VALUE_IS_NEGATIVE if a is negative.
+ * @throws SEAGRASS_DOUBLE_ERROR_ROUNDING_MODE_IS_INVALID if mode is not one of
+ * rounding modes.
+ * @throws SEAGRASS_DOUBLE_ERROR_FLOAT_VALUE_TOO_LARGE if a is too large to be
+ * stored in a uintmax_t.
+ * @see SEAGRASS_FLOAT_ROUNDING_MODE_NEAREST
+ * @see SEAGRASS_FLOAT_ROUNDING_MODE_DOWNWARD
+ * @see SEAGRASS_FLOAT_ROUNDING_MODE_UPWARD
+ * @see SEAGRASS_FLOAT_ROUNDING_MODE_TOWARDS_ZERO
+ */
+int seagrass_double_to_uintmax_t(double a,
+                                 enum seagrass_float_rounding_mode mode,
+                                 uintmax_t *out);
+
+#endif /* _SEAGRASS_DOUBLE_H_ */
@@ -6,6 +6,8 @@
 #include <stdint.h>
 #include <sea-urchin.h>
 
+#define SEAGRASS_FLOAT_ERROR_OBJECT_IS_NULL \
+    SEA_URCHIN_ERROR_OBJECT_IS_NULL
 #define SEAGRASS_FLOAT_ERROR_OUT_IS_NULL \
     SEA_URCHIN_ERROR_OUT_IS_NULL
 #define SEAGRASS_FLOAT_ERROR_ROUNDING_MODE_IS_INVALID \
@@ -20,6 +22,18 @@
     SEA_URCHIN_ERROR_RESULT_IS_UNCHANGED
 #define SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO \
     SEA_URCHIN_ERROR_DIVIDE_BY_ZERO
+#define SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_FLOAT_ERROR_SUMMATION_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_FLOAT_ERROR_RULES_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_FLOAT_ERROR_RANGE_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
 
 /**
  * @brief Comparison function for float*.
@@ -115,6 +129,129 @@ int seagrass_float_multiply(float a, float b, float *out);
  */
 int seagrass_float_divide(float a, float b, float *out);
 
+/*
+ * The exact variants below only accept a result equal to the exact result
+ * of the operation, where the functions above allow a tolerance. They
+ * measure the rounding error, with TwoSum for sums and the residual of the
+ * product of two floats in double for products and quotients, which costs a few
+ * operations on floats.
+ */
+
+/**
+ * @brief Add two float values together, checking the result exactly.
+ * @param [in] a first float.
+ * @param [in] b second float.
+ * @param [out] out receive the result of the two added values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if the result is not
+ * finite or not exact.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED if a non-zero value was
+ * added but the result equals the other value.
+ */
+int seagrass_float_add_exact(float a, float b, float *out);
+
+/**
+ * @brief Subtract the second value from the first, checking the result
+ * exactly.
+ * @param [in] a first float.
+ * @param [in] b second float.
+ * @param [out] out receive the result of the two subtracted values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if the result is not
+ * finite or not exact.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED if a non-zero value was
+ * subtracted but the result equals the first value, or the result equals
+ * <i>-b</i> although a is non-zero.
+ */
+int seagrass_float_subtract_exact(float a, float b, float *out);
+
+/**
+ * @brief Multiply two float values together, checking the result exactly.
+ * @param [in] a first float.
+ * @param [in] b second float.
+ * @param [out] out receive the result of the two multiplied values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if the result is not
+ * finite or not exact, e.g. rounded to a subnormal number or to zero.
+ */
+int seagrass_float_multiply_exact(float a, float b, float *out);
+
+/**
+ * @brief Divide the first value by the second, checking the result exactly.
+ * @param [in] a first float.
+ * @param [in] b second float.
+ * @param [out] out receive the result of the division operation.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO if b is zero.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if the result is not
+ * finite or not exact, e.g. rounded to a subnormal number or to zero.
+ */
+int seagrass_float_divide_exact(float a, float b, float *out);
+
+/**
+ * @brief Square root of the value.
+ * <p>Domain and range errors are reported by error code, errno is left
+ * alone.</p>
+ * @param [in] a float value.
+ * @param [out] out receive the correctly rounded square root.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID if a is not finite.
+ * @throws SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE if a is less than
+ * zero, while <i>-0.0</i> gives <i>-0.0</i>.
+ */
+int seagrass_float_sqrt(float a, float *out);
+
+/**
+ * @brief Natural logarithm of the value.
+ * @param [in] a float value.
+ * @param [out] out receive the logarithm.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID if a is not finite.
+ * @throws SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO if a is zero.
+ * @throws SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE if a is less than
+ * zero.
+ */
+int seagrass_float_log(float a, float *out);
+
+/**
+ * @brief Exponential of the value.
+ * <p>Results too small to be represented are zero rather than an
+ * error. The result is that of seagrass_float_exp_n().</p>
+ * @param [in] a float value.
+ * @param [out] out receive e to the power of <b>a</b>.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID if a is not finite.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if the result
+ * overflows, i.e. a is greater than about 88.72.
+ */
+int seagrass_float_exp(float a, float *out);
+
+/**
+ * @brief First value to the power of the second.
+ * <p>A negative base is only valid with an integer power, and zero to the
+ * power of zero is one. The result is that of seagrass_float_pow_n().</p>
+ * @param [in] a base.
+ * @param [in] b power.
+ * @param [out] out receive <b>a</b> to the power of <b>b</b>.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID if a or b is not finite.
+ * @throws SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO if a is zero and b is less
+ * than zero.
+ * @throws SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE if a is less than
+ * zero and b is not an integer.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if the result
+ * overflows.
+ */
+int seagrass_float_pow(float a, float b, float *out);
+
 /**
  * @brief Are the two float values considered equal.
  * @param [in] a first float.
@@ -223,4 +360,428 @@ enum seagrass_float_rounding_mode {
 int seagrass_float_to_uintmax_t(float a, enum seagrass_float_rounding_mode mode,
                                 uintmax_t *out);
 
+enum seagrass_float_summation {
+/**
+ * Neumaier's improved Kahan compensated summation. The error is independent
+ * of the number of values to first order.
+ */
+    SEAGRASS_FLOAT_SUMMATION_COMPENSATED = 0,
+/**
+ * Pairwise summation whose error grows with the logarithm of the number of
+ * values.
+ */
+    SEAGRASS_FLOAT_SUMMATION_PAIRWISE = 1,
+/**
+ * Accumulate in double and round once at the end.
+ */
+    SEAGRASS_FLOAT_SUMMATION_DOUBLE = 2,
+/**
+ * Flag which may be combined with one of the algorithms above, e.g.
+ * SEAGRASS_FLOAT_SUMMATION_PAIRWISE | SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS,
+ * to sum with subnormal numbers flushed to zero, see
+ * seagrass_float_fast_denormals_begin().
+ */
+    SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS = 0x100,
+};
+
+/**
+ * @brief Sum an array of floats.
+ * <p>Unlike repeated seagrass_float_add() the summation keeps going when a
+ * value is small relative to the running sum.</p>
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [in] summation algorithm used to sum the values.
+ * @param [out] out receive the sum.
+ * @param [out] error optional, receive an upper bound of the absolute error
+ * of <b>out</b> relative to the exact sum of the values. With
+ * SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS the bound also covers the
+ * subnormal values and partial sums that were flushed to zero.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if values is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_SUMMATION_IS_INVALID if summation is not one of
+ * the summation algorithms.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if a value is not finite
+ * or the sum overflows.
+ * @see SEAGRASS_FLOAT_SUMMATION_COMPENSATED
+ * @see SEAGRASS_FLOAT_SUMMATION_PAIRWISE
+ * @see SEAGRASS_FLOAT_SUMMATION_DOUBLE
+ * @see SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS
+ */
+int seagrass_float_sum_n(const float *values, uintmax_t count,
+                         enum seagrass_float_summation summation,
+                         float *out, float *error);
+
+/*
+ * The array extremes order the values exactly, unlike seagrass_float_compare()
+ * which treats values within FLT_EPSILON of each other as equal. A tolerance
+ * is not transitive and would make the result depend on the order in which
+ * the values are visited. <i>-0.0</i> is ordered before <i>+0.0</i>.
+ */
+
+/**
+ * @brief Smallest value of an array and its index.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [out] out receive the smallest value.
+ * @param [out] index optional, receive the index of the first occurrence of
+ * the smallest value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if a value is
+ * <i>NaN</i>.
+ */
+int seagrass_float_minimum_n(const float *values, uintmax_t count,
+                             float *out, uintmax_t *index);
+
+/**
+ * @brief Largest value of an array and its index.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [out] out receive the largest value.
+ * @param [out] index optional, receive the index of the first occurrence of
+ * the largest value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if a value is
+ * <i>NaN</i>.
+ */
+int seagrass_float_maximum_n(const float *values, uintmax_t count,
+                             float *out, uintmax_t *index);
+
+/**
+ * @brief Smallest and largest values of an array in a single pass.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [out] minimum receive the smallest value.
+ * @param [out] minimum_index optional, receive the index of the first
+ * occurrence of the smallest value.
+ * @param [out] maximum receive the largest value.
+ * @param [out] maximum_index optional, receive the index of the first
+ * occurrence of the largest value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if minimum or maximum is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if a value is
+ * <i>NaN</i>.
+ */
+int seagrass_float_minmax_n(const float *values, uintmax_t count,
+                            float *minimum, uintmax_t *minimum_index,
+                            float *maximum, uintmax_t *maximum_index);
+
+/**
+ * Rules checked by seagrass_float_find_invalid_n() and
+ * seagrass_float_invalid_mask_n(), which may be combined with bitwise or.
+ * NaN is only invalid under SEAGRASS_FLOAT_RULE_NOT_NAN and
+ * SEAGRASS_FLOAT_RULE_FINITE, as it is neither negative nor out of range.
+ */
+enum seagrass_float_rule {
+/**
+ * NaN is invalid.
+ */
+    SEAGRASS_FLOAT_RULE_NOT_NAN = 0x1,
+/**
+ * NaN and infinities are invalid.
+ */
+    SEAGRASS_FLOAT_RULE_FINITE = 0x2,
+/**
+ * Values less than zero are invalid, while <i>-0.0</i> is valid.
+ */
+    SEAGRASS_FLOAT_RULE_NON_NEGATIVE = 0x4,
+/**
+ * Values less than minimum or greater than maximum are invalid.
+ */
+    SEAGRASS_FLOAT_RULE_RANGE = 0x8,
+};
+
+/**
+ * @brief Index of the first value of an array that breaks a rule.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [in] rules combination of seagrass_float_rule values.
+ * @param [in] minimum smallest valid value under SEAGRASS_FLOAT_RULE_RANGE.
+ * @param [in] maximum largest valid value under SEAGRASS_FLOAT_RULE_RANGE.
+ * @param [out] out receive the index of the first invalid value, or
+ * <b>count</b> if every value is valid.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if values is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_RULES_IS_INVALID if rules has bits other than
+ * those of seagrass_float_rule.
+ * @throws SEAGRASS_FLOAT_ERROR_RANGE_IS_INVALID if rules has
+ * SEAGRASS_FLOAT_RULE_RANGE and minimum or maximum is NaN or minimum is
+ * greater than maximum.
+ */
+int seagrass_float_find_invalid_n(const float *values, uintmax_t count,
+                                  unsigned int rules, float minimum,
+                                  float maximum, uintmax_t *out);
+
+/**
+ * @brief Values of an array that break a rule as a bitmask.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [in] rules combination of seagrass_float_rule values.
+ * @param [in] minimum smallest valid value under SEAGRASS_FLOAT_RULE_RANGE.
+ * @param [in] maximum largest valid value under SEAGRASS_FLOAT_RULE_RANGE.
+ * @param [out] out receive (count + 63) / 64 words where bit (i % 64) of
+ * word (i / 64) is set if values[i] is invalid.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if values is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i> while count
+ * is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_RULES_IS_INVALID if rules has bits other than
+ * those of seagrass_float_rule.
+ * @throws SEAGRASS_FLOAT_ERROR_RANGE_IS_INVALID if rules has
+ * SEAGRASS_FLOAT_RULE_RANGE and minimum or maximum is NaN or minimum is
+ * greater than maximum.
+ * @note Unused bits of the last word are cleared.
+ */
+int seagrass_float_invalid_mask_n(const float *values, uintmax_t count,
+                                  unsigned int rules, float minimum,
+                                  float maximum, uint64_t *out);
+
+/*
+ * The linear algebra kernels use fused multiply add where the processor
+ * provides it and report RESULT_IS_INCONSISTENT for an overflow or a
+ * non-finite value instead of checking every operation the way
+ * seagrass_float_multiply() and seagrass_float_add() do.
+ */
+
+/**
+ * @brief Dot product of two arrays of floats.
+ * @param [in] a array of count floats.
+ * @param [in] b array of count floats.
+ * @param [in] count number of values in each array.
+ * @param [out] out receive the sum of the products a[i] * b[i].
+ * @param [out] error optional, receive an upper bound of the absolute error
+ * of <b>out</b> relative to the exact dot product.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if a or b is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if a value is not
+ * finite or the dot product overflows.
+ */
+int seagrass_float_dot(const float *a, const float *b, uintmax_t count,
+                       float *out, float *error);
+
+/**
+ * @brief Update y to alpha * x + y.
+ * @param [in] alpha scale of x.
+ * @param [in] x array of count floats.
+ * @param [in] count number of values in each array.
+ * @param [in,out] y array of count floats to update.
+ * @param [out] index optional, receive the index of the first element of
+ * <b>y</b> which is not finite.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if x or y is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if an updated element
+ * is not finite. The elements of <b>y</b> before <b>index</b> hold their
+ * updates while the others are unchanged.
+ * @note <b>x</b> may be the same array as <b>y</b>.
+ */
+int seagrass_float_axpy(float alpha, const float *x, uintmax_t count,
+                        float *y, uintmax_t *index);
+
+/**
+ * @brief Update y to alpha * matrix * x + beta * y.
+ * @param [in] alpha scale of the product of matrix and x.
+ * @param [in] matrix rows by columns floats stored row by row.
+ * @param [in] rows number of rows of matrix and of values of y.
+ * @param [in] columns number of columns of matrix and of values of x.
+ * @param [in] x array of columns floats.
+ * @param [in] beta scale of y. If zero then y is not read.
+ * @param [in,out] y array of rows floats to update.
+ * @param [out] index optional, receive the index of the first element of
+ * <b>y</b> whose update is not finite.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if matrix is <i>NULL</i> while
+ * rows and columns are not zero, or x is <i>NULL</i> while columns is not
+ * zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if y is <i>NULL</i> while rows is
+ * not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if an update is not
+ * finite. The elements of <b>y</b> before <b>index</b> hold their updates
+ * while the others are unchanged.
+ */
+int seagrass_float_gemv(float alpha, const float *matrix, uintmax_t rows,
+                        uintmax_t columns, const float *x, float beta,
+                        float *y, uintmax_t *index);
+
+/*
+ * The batched functions below check each value as their scalar counterparts
+ * do and report the same errors, yet compute the results with vectorized
+ * polynomial approximations instead of calling libm for each value. Their
+ * error measured against the exact result is:
+ * - seagrass_float_sqrt_n(): correctly rounded.
+ * - seagrass_float_log_n(): below 1 ulp, with at most 0.85 ulp over every
+ *   positive float.
+ * - seagrass_float_exp_n(): below 1 ulp, with at most 0.99 ulp over every
+ *   float from -104 to the largest with a finite result. Smaller values
+ *   give zero.
+ * - seagrass_float_pow_n(): below 1 ulp, evaluated in double before it is
+ *   rounded to float, so that it is correctly rounded but for results
+ *   close to halfway between two floats.
+ * seagrass_float_exp() and seagrass_float_pow() compute their results the
+ * same way, while those of seagrass_float_log_n() may differ from the ones
+ * of seagrass_float_log() in the last bit.
+ *
+ * On error <b>index</b> receives the index of the first failing value, the
+ * elements of <b>out</b> before it hold their results while the others are
+ * unchanged. <b>out</b> may be the same array as an argument.
+ */
+
+/**
+ * @brief Square roots of an array of floats.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [out] out array of count floats to receive the square roots.
+ * @param [out] index optional, receive the index of the first failing
+ * value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if values is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i> while count
+ * is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID if a value is not finite.
+ * @throws SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE if a value is less
+ * than zero.
+ */
+int seagrass_float_sqrt_n(const float *values, uintmax_t count, float *out,
+                          uintmax_t *index);
+
+/**
+ * @brief Natural logarithms of an array of floats.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [out] out array of count floats to receive the logarithms.
+ * @param [out] index optional, receive the index of the first failing
+ * value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if values is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i> while count
+ * is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID if a value is not finite.
+ * @throws SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO if a value is zero.
+ * @throws SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE if a value is less
+ * than zero.
+ */
+int seagrass_float_log_n(const float *values, uintmax_t count, float *out,
+                         uintmax_t *index);
+
+/**
+ * @brief Exponentials of an array of floats.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [out] out array of count floats to receive the exponentials.
+ * @param [out] index optional, receive the index of the first failing
+ * value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if values is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i> while count
+ * is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID if a value is not finite.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if a result
+ * overflows.
+ */
+int seagrass_float_exp_n(const float *values, uintmax_t count, float *out,
+                         uintmax_t *index);
+
+/**
+ * @brief Values of one array to the power of those of another.
+ * @param [in] a array of count bases.
+ * @param [in] b array of count powers.
+ * @param [in] count number of values in each array.
+ * @param [out] out array of count floats to receive a[i] to the power of
+ * b[i].
+ * @param [out] index optional, receive the index of the first failing pair
+ * of values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL if a or b is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i> while count
+ * is not zero.
+ * @throws SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID if a value is not finite.
+ * @throws SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO if a base is zero and its
+ * power less than zero.
+ * @throws SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE if a base is less
+ * than zero and its power not an integer.
+ * @throws SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT if a result
+ * overflows.
+ */
+int seagrass_float_pow_n(const float *a, const float *b, uintmax_t count,
+                         float *out, uintmax_t *index);
+
+/*
+ * Arithmetic on subnormal numbers, those smaller in magnitude than FLT_MIN,
+ * takes a slow path on many processors, on x86 up to a hundred times slower
+ * than on normal numbers. Within a fast denormals scope the calling thread
+ * flushes subnormal results to zero and, where the processor supports it,
+ * reads subnormal operands as zero (FTZ and DAZ of the x86 MXCSR register,
+ * FZ of the AArch64 FPCR register). This also applies to double. Only the
+ * calling thread is affected and other threads, e.g. those of
+ * seagrass_parallel_float_sum(), need scopes of their own.
+ *
+ * The checked functions then see zero where there was a subnormal number:
+ * - seagrass_float_add() and seagrass_float_subtract() no longer report
+ *   RESULT_IS_UNCHANGED for a subnormal operand, which now compares equal to
+ *   zero, and a result that would be subnormal becomes zero.
+ * - seagrass_float_multiply_exact() and seagrass_float_divide_exact() report
+ *   RESULT_IS_INCONSISTENT when normal operands give a result that would
+ *   have been subnormal, not only when it underflows to zero, yet succeed
+ *   with zero for a subnormal operand. seagrass_float_divide_exact()
+ *   reports DIVIDE_BY_ZERO for a subnormal divisor.
+ * - seagrass_float_is_equal() and the other comparisons are unaffected, as
+ *   subnormal differences are far below FLT_EPSILON either way.
+ */
+
+/**
+ * @brief Saved state of a fast denormals scope.
+ */
+struct seagrass_float_fast_denormals {
+    uintmax_t state;
+};
+
+/**
+ * @brief Check whether the processor can flush subnormal numbers to zero.
+ * @param [out] out receive true if a fast denormals scope has an effect,
+ * otherwise false.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_float_fast_denormals_is_supported(bool *out);
+
+/**
+ * @brief Begin to flush subnormal numbers to zero on the calling thread.
+ * <p>Scopes may be nested as long as each is ended in reverse order.</p>
+ * @param [out] out receive the state to restore at the end of the scope.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_float_fast_denormals_begin(
+        struct seagrass_float_fast_denormals *out);
+
+/**
+ * @brief End a fast denormals scope on the calling thread.
+ * <p>Only the handling of subnormal numbers is restored, floating point
+ * exceptions raised within the scope stay raised.</p>
+ * @param [in] object state received from the beginning of the scope.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ */
+int seagrass_float_fast_denormals_end(
+        const struct seagrass_float_fast_denormals *object);
+
 #endif /* _SEAGRASS_FLOAT_H_ */
@@ -0,0 +1,206 @@
+#ifndef _SEAGRASS_FLOAT_TOLERANCE_H_
+#define _SEAGRASS_FLOAT_TOLERANCE_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL \
+    SEA_URCHIN_ERROR_OBJECT_IS_NULL
+#define SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUES_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUE_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+
+enum seagrass_float_tolerance_mode {
+    /* |a - b| <= epsilon */
+    SEAGRASS_FLOAT_TOLERANCE_MODE_ABSOLUTE,
+    /* |a - b| <= epsilon * max(|a|, |b|) */
+    SEAGRASS_FLOAT_TOLERANCE_MODE_RELATIVE,
+    /* a and b are at most ulps representable floats apart */
+    SEAGRASS_FLOAT_TOLERANCE_MODE_ULP
+};
+
+/**
+ * @brief Comparison context for float.
+ * <p>Two floats are equal if they are within the tolerance of each other,
+ * otherwise they are ordered as usual. <i>NaN</i> is neither equal to, less
+ * than nor greater than any value. Exactly equal values, including
+ * infinities, are always equal.</p>
+ */
+struct seagrass_float_tolerance {
+    enum seagrass_float_tolerance_mode mode;
+    float epsilon;
+    uint32_t ulps;
+};
+
+/**
+ * @brief Initialize absolute tolerance.
+ * @param [in] object instance to be initialized.
+ * @param [in] epsilon largest absolute difference of equal values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUE_IS_INVALID if epsilon is
+ * negative or not finite.
+ */
+int seagrass_float_tolerance_init_absolute(
+        struct seagrass_float_tolerance *object,
+        float epsilon);
+
+/**
+ * @brief Initialize relative tolerance.
+ * @param [in] object instance to be initialized.
+ * @param [in] epsilon largest difference of equal values relative to the
+ * larger magnitude of the two.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUE_IS_INVALID if epsilon is
+ * negative or not finite.
+ */
+int seagrass_float_tolerance_init_relative(
+        struct seagrass_float_tolerance *object,
+        float epsilon);
+
+/**
+ * @brief Initialize units in the last place tolerance.
+ * @param [in] object instance to be initialized.
+ * @param [in] ulps largest number of representable floats between equal
+ * values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @note <i>-0.0</i> and <i>+0.0</i> are <i>0</i> ulps apart.
+ */
+int seagrass_float_tolerance_init_ulp(struct seagrass_float_tolerance *object,
+                                      uint32_t ulps);
+
+/**
+ * @brief Check if a is equal to b within the tolerance.
+ * @param [in] object tolerance.
+ * @param [in] a first float.
+ * @param [in] b second float.
+ * @param [out] out receive true if equal, otherwise false.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @note An infinity is only equal to itself and <i>NaN</i> is never equal.
+ */
+int seagrass_float_tolerance_is_equal(
+        const struct seagrass_float_tolerance *object,
+        float a,
+        float b,
+        bool *out);
+
+/**
+ * @brief Check if a is less than b and not equal within the tolerance.
+ * @param [in] object tolerance.
+ * @param [in] a first float.
+ * @param [in] b second float.
+ * @param [out] out receive true if less than, otherwise false.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_float_tolerance_is_less_than(
+        const struct seagrass_float_tolerance *object,
+        float a,
+        float b,
+        bool *out);
+
+/**
+ * @brief Check if a is greater than b and not equal within the tolerance.
+ * @param [in] object tolerance.
+ * @param [in] a first float.
+ * @param [in] b second float.
+ * @param [out] out receive true if greater than, otherwise false.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_float_tolerance_is_greater_than(
+        const struct seagrass_float_tolerance *object,
+        float a,
+        float b,
+        bool *out);
+
+/**
+ * @brief Element wise equality of two arrays as a bitmask.
+ * @param [in] object tolerance.
+ * @param [in] a first array of count floats.
+ * @param [in] b second array of count floats.
+ * @param [in] count number of elements.
+ * @param [out] out receive (count + 63) / 64 words where bit (i % 64) of
+ * word (i / 64) is set if a[i] is equal to b[i].
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUES_IS_NULL if a or b is
+ * <i>NULL</i> while count is not zero.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL if out is <i>NULL</i>
+ * while count is not zero.
+ * @note Unused bits of the last word are cleared.
+ */
+int seagrass_float_tolerance_is_equal_n(
+        const struct seagrass_float_tolerance *object,
+        const float *a,
+        const float *b,
+        uintmax_t count,
+        uint64_t *out);
+
+/**
+ * @brief Element wise less than of two arrays as a bitmask.
+ * @param [in] object tolerance.
+ * @param [in] a first array of count floats.
+ * @param [in] b second array of count floats.
+ * @param [in] count number of elements.
+ * @param [out] out receive (count + 63) / 64 words where bit (i % 64) of
+ * word (i / 64) is set if a[i] is less than b[i].
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUES_IS_NULL if a or b is
+ * <i>NULL</i> while count is not zero.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL if out is <i>NULL</i>
+ * while count is not zero.
+ * @note Unused bits of the last word are cleared.
+ */
+int seagrass_float_tolerance_is_less_than_n(
+        const struct seagrass_float_tolerance *object,
+        const float *a,
+        const float *b,
+        uintmax_t count,
+        uint64_t *out);
+
+/**
+ * @brief Element wise greater than of two arrays as a bitmask.
+ * @param [in] object tolerance.
+ * @param [in] a first array of count floats.
+ * @param [in] b second array of count floats.
+ * @param [in] count number of elements.
+ * @param [out] out receive (count + 63) / 64 words where bit (i % 64) of
+ * word (i / 64) is set if a[i] is greater than b[i].
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUES_IS_NULL if a or b is
+ * <i>NULL</i> while count is not zero.
+ * @throws SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL if out is <i>NULL</i>
+ * while count is not zero.
+ * @note Unused bits of the last word are cleared.
+ */
+int seagrass_float_tolerance_is_greater_than_n(
+        const struct seagrass_float_tolerance *object,
+        const float *a,
+        const float *b,
+        uintmax_t count,
+        uint64_t *out);
+
+#endif /* _SEAGRASS_FLOAT_TOLERANCE_H_ */
@@ -0,0 +1,257 @@
+#ifndef _SEAGRASS_HISTOGRAM_H_
+#define _SEAGRASS_HISTOGRAM_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL \
+    SEA_URCHIN_ERROR_OBJECT_IS_NULL
+#define SEAGRASS_HISTOGRAM_ERROR_OTHER_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_HISTOGRAM_ERROR_DATA_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_HISTOGRAM_ERROR_SHARDS_IS_ZERO \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_HISTOGRAM_ERROR_PERCENTILE_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_HISTOGRAM_ERROR_SIZE_IS_TOO_SMALL \
+    SEA_URCHIN_ERROR_VALUE_IS_TOO_SMALL
+#define SEAGRASS_HISTOGRAM_ERROR_IS_EMPTY \
+    SEA_URCHIN_ERROR_IS_EMPTY
+#define SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+#define SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED \
+    SEA_URCHIN_ERROR_MEMORY_ALLOCATION_FAILED
+
+#define SEAGRASS_HISTOGRAM_PRECISION_MINIMUM 1
+#define SEAGRASS_HISTOGRAM_PRECISION_MAXIMUM 16
+
+/*
+ * Values are counted in log-linear buckets. With a precision of p bits the
+ * values below 2^p each have a bucket of their own, while every power of two
+ * range above that is split into 2^(p-1) buckets of equal width. A bucket
+ * is therefore at most 1/2^(p-1) as wide as the smallest value it holds, i.e.
+ * a precision of 8 keeps the relative error below 0.8% using 7424 buckets to
+ * cover every uintmax_t.
+ */
+
+/**
+ * @brief Concurrent histogram of uintmax_t values.
+ * <p>The counts are split into shards, which start on separate cache lines.
+ * A recording thread is handed the lowest identity not in use on its first
+ * record, which it gives back when it exits, and owns the shard of that
+ * identity. As no other thread writes to it the owner increments its counts
+ * with a relaxed atomic load and store, neither locking nor retrying. Threads
+ * without a shard of their own record into an extra shard they share, using
+ * relaxed atomic increments.</p>
+ */
+struct seagrass_histogram {
+    uintmax_t precision;
+    uintmax_t buckets;
+    uintmax_t stride;
+    uintmax_t shards;
+    _Atomic(uintmax_t) *counts;
+};
+
+/**
+ * @brief Bucket counts of a histogram at one point in time.
+ */
+struct seagrass_histogram_snapshot {
+    uintmax_t precision;
+    uintmax_t count;
+    uintmax_t *counts;
+};
+
+/**
+ * @brief Initialize histogram.
+ * @param [in] object instance to be initialized.
+ * @param [in] precision significant bits the buckets resolve, from
+ * SEAGRASS_HISTOGRAM_PRECISION_MINIMUM to
+ * SEAGRASS_HISTOGRAM_PRECISION_MAXIMUM.
+ * @param [in] shards number of shards, one per thread recording at once
+ * avoids contention. Threads past the first 1024 running at once record into
+ * the shared shard whatever the number of shards.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID if precision is out
+ * of range.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_SHARDS_IS_ZERO if shards is zero.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the shards.
+ */
+int seagrass_histogram_init(struct seagrass_histogram *object,
+                            uintmax_t precision,
+                            uintmax_t shards);
+
+/**
+ * @brief Invalidate histogram, releasing its shards.
+ * @param [in] object instance to be invalidated.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ */
+int seagrass_histogram_invalidate(struct seagrass_histogram *object);
+
+/**
+ * @brief Record a value.
+ * @param [in] object histogram.
+ * @param [in] value to be counted.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @note Safe to call from any number of threads at once.
+ */
+int seagrass_histogram_record(struct seagrass_histogram *object,
+                              uintmax_t value);
+
+/**
+ * @brief Add the counts of other to the histogram.
+ * @param [in] object histogram to merge into.
+ * @param [in] other histogram whose counts are added.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID if the precisions of
+ * the histograms differ.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT if a count of other
+ * overflows or a count of object would overflow, in which case object is
+ * unchanged.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory to total the counts of other.
+ * @note Values may be recorded into either histogram meanwhile.
+ */
+int seagrass_histogram_merge(struct seagrass_histogram *object,
+                             const struct seagrass_histogram *other);
+
+/**
+ * @brief Take a snapshot of the histogram.
+ * @param [in] object histogram.
+ * @param [out] out snapshot to be initialized.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT if a count
+ * overflows.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the snapshot.
+ * @note Values recorded while the snapshot is taken may or may not be part of
+ * it.
+ */
+int seagrass_histogram_snapshot(const struct seagrass_histogram *object,
+                                struct seagrass_histogram_snapshot *out);
+
+/**
+ * @brief Invalidate snapshot, releasing its counts.
+ * @param [in] object instance to be invalidated.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ */
+int seagrass_histogram_snapshot_invalidate(
+        struct seagrass_histogram_snapshot *object);
+
+/**
+ * @brief Retrieve the number of values in the snapshot.
+ * @param [in] object snapshot.
+ * @param [out] out receive the number of values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_histogram_snapshot_count(
+        const struct seagrass_histogram_snapshot *object,
+        uintmax_t *out);
+
+/**
+ * @brief Retrieve the value at or below which the given percentage of the
+ * values fall.
+ * @param [in] object snapshot.
+ * @param [in] percentile from <i>0</i> to <i>100</i>.
+ * @param [out] out receive the largest value of the bucket that holds the
+ * percentile.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_PERCENTILE_IS_INVALID if percentile is
+ * outside of [0, 100].
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_IS_EMPTY if the snapshot has no values.
+ */
+int seagrass_histogram_snapshot_percentile(
+        const struct seagrass_histogram_snapshot *object,
+        double percentile,
+        uintmax_t *out);
+
+/**
+ * @brief Add the counts of other to the snapshot.
+ * @param [in] object snapshot to merge into.
+ * @param [in] other snapshot whose counts are added.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID if the precisions of
+ * the snapshots differ.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT if a count would
+ * overflow, in which case the snapshot is unchanged.
+ */
+int seagrass_histogram_snapshot_merge(
+        struct seagrass_histogram_snapshot *object,
+        const struct seagrass_histogram_snapshot *other);
+
+/**
+ * @brief Retrieve the size of the serialized snapshot.
+ * @param [in] object snapshot.
+ * @param [out] out receive the size in bytes.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_histogram_snapshot_serialized_size(
+        const struct seagrass_histogram_snapshot *object,
+        uintmax_t *out);
+
+/**
+ * @brief Serialize snapshot.
+ * <p>The precision is followed by a pair of the number of empty buckets
+ * skipped and the count for every bucket that is not empty, all as unsigned
+ * LEB128 integers.</p>
+ * @param [in] object snapshot.
+ * @param [out] data receive the serialized snapshot.
+ * @param [in] size of data in bytes.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_DATA_IS_NULL if data is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_SIZE_IS_TOO_SMALL if size is smaller than
+ * the serialized size.
+ */
+int seagrass_histogram_snapshot_serialize(
+        const struct seagrass_histogram_snapshot *object,
+        void *data,
+        uintmax_t size);
+
+/**
+ * @brief Initialize snapshot from its serialized form.
+ * @param [out] object snapshot to be initialized.
+ * @param [in] data serialized snapshot.
+ * @param [in] size of data in bytes.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_DATA_IS_NULL if data is <i>NULL</i>.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID if data is not a
+ * serialized snapshot.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT if the number of
+ * values overflows.
+ * @throws SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the snapshot.
+ */
+int seagrass_histogram_snapshot_deserialize(
+        struct seagrass_histogram_snapshot *object,
+        const void *data,
+        uintmax_t size);
+
+#endif /* _SEAGRASS_HISTOGRAM_H_ */
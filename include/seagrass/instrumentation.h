@@ -0,0 +1,187 @@
+#ifndef _SEAGRASS_INSTRUMENTATION_H_
+#define _SEAGRASS_INSTRUMENTATION_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL \
+    SEA_URCHIN_ERROR_OBJECT_IS_NULL
+#define SEAGRASS_INSTRUMENTATION_ERROR_OTHER_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_INSTRUMENTATION_ERROR_OUTCOME_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_INSTRUMENTATION_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+
+/*
+ * Instrumentation is compiled in when the library is built with
+ * SEAGRASS_INSTRUMENTATION defined, see the option of the same name in
+ * CMakeLists.txt. Every call to an instrumented function then counts its
+ * outcome in counters of the calling thread. A thread allocates its counters
+ * on its first instrumented call and owns them, so it increments them with a
+ * relaxed load and store rather than an atomic read-modify-write. The counts
+ * of a thread that exits are kept. Calls the library makes itself are
+ * counted too. Without instrumentation the functions below still work but
+ * every count is zero.
+ */
+
+enum seagrass_instrumentation_function {
+    SEAGRASS_INSTRUMENTATION_INT32_T_ADD = 0,
+    SEAGRASS_INSTRUMENTATION_INT32_T_SUBTRACT,
+    SEAGRASS_INSTRUMENTATION_INT32_T_MULTIPLY,
+    SEAGRASS_INSTRUMENTATION_INT32_T_DIVIDE,
+    SEAGRASS_INSTRUMENTATION_INT64_T_ADD,
+    SEAGRASS_INSTRUMENTATION_INT64_T_SUBTRACT,
+    SEAGRASS_INSTRUMENTATION_INT64_T_MULTIPLY,
+    SEAGRASS_INSTRUMENTATION_INT64_T_DIVIDE,
+    SEAGRASS_INSTRUMENTATION_UINT32_T_ADD,
+    SEAGRASS_INSTRUMENTATION_UINT32_T_SUBTRACT,
+    SEAGRASS_INSTRUMENTATION_UINT32_T_MULTIPLY,
+    SEAGRASS_INSTRUMENTATION_UINT32_T_DIVIDE,
+    SEAGRASS_INSTRUMENTATION_SIZE_T_ADD,
+    SEAGRASS_INSTRUMENTATION_SIZE_T_SUBTRACT,
+    SEAGRASS_INSTRUMENTATION_SIZE_T_MULTIPLY,
+    SEAGRASS_INSTRUMENTATION_SIZE_T_DIVIDE,
+    SEAGRASS_INSTRUMENTATION_UINTMAX_T_ADD,
+    SEAGRASS_INSTRUMENTATION_UINTMAX_T_SUBTRACT,
+    SEAGRASS_INSTRUMENTATION_UINTMAX_T_MULTIPLY,
+    SEAGRASS_INSTRUMENTATION_UINTMAX_T_DIVIDE,
+    SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+    SEAGRASS_INSTRUMENTATION_FLOAT_SUBTRACT,
+    SEAGRASS_INSTRUMENTATION_FLOAT_MULTIPLY,
+    SEAGRASS_INSTRUMENTATION_FLOAT_DIVIDE,
+    SEAGRASS_INSTRUMENTATION_DOUBLE_ADD,
+    SEAGRASS_INSTRUMENTATION_DOUBLE_SUBTRACT,
+    SEAGRASS_INSTRUMENTATION_DOUBLE_MULTIPLY,
+    SEAGRASS_INSTRUMENTATION_DOUBLE_DIVIDE,
+/**
+ * Number of instrumented functions.
+ */
+    SEAGRASS_INSTRUMENTATION_FUNCTIONS
+};
+
+enum seagrass_instrumentation_outcome {
+    SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS = 0,
+/**
+ * An out, quotient or other pointer argument was <i>NULL</i>.
+ */
+    SEAGRASS_INSTRUMENTATION_OUTCOME_ARGUMENT_IS_NULL,
+    SEAGRASS_INSTRUMENTATION_OUTCOME_RESULT_IS_INCONSISTENT,
+    SEAGRASS_INSTRUMENTATION_OUTCOME_RESULT_IS_UNCHANGED,
+    SEAGRASS_INSTRUMENTATION_OUTCOME_DIVIDE_BY_ZERO,
+/**
+ * Any other error code.
+ */
+    SEAGRASS_INSTRUMENTATION_OUTCOME_OTHER,
+/**
+ * Number of outcomes.
+ */
+    SEAGRASS_INSTRUMENTATION_OUTCOMES
+};
+
+/**
+ * @brief Counts of the outcomes of the instrumented functions.
+ */
+struct seagrass_instrumentation_snapshot {
+    uintmax_t counts[SEAGRASS_INSTRUMENTATION_FUNCTIONS]
+                    [SEAGRASS_INSTRUMENTATION_OUTCOMES];
+};
+
+/**
+ * @brief Check whether the library was built with instrumentation.
+ * @param [out] out receive true if calls are counted, otherwise false.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_instrumentation_is_enabled(bool *out);
+
+/**
+ * @brief Retrieve the name of an instrumented function.
+ * @param [in] function instrumented function.
+ * @param [out] out receive the name, e.g. "seagrass_float_add".
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID if function is
+ * not one of the instrumented functions.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_instrumentation_function_name(
+        enum seagrass_instrumentation_function function,
+        const char **out);
+
+/**
+ * @brief Add up the counts of all threads, including those that exited.
+ * <p>Counts of threads which are still running are read while they may be
+ * incremented, so the snapshot is not taken at a single point in time but
+ * each count is one the thread has reached.</p>
+ * @param [out] out receive the snapshot.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_RESULT_IS_INCONSISTENT if a count
+ * overflows.
+ */
+int seagrass_instrumentation_snapshot(
+        struct seagrass_instrumentation_snapshot *out);
+
+/**
+ * @brief Add the counts of other to the snapshot.
+ * @param [in] object snapshot to merge into.
+ * @param [in] other snapshot whose counts are added.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OTHER_IS_NULL if other is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_RESULT_IS_INCONSISTENT if a count
+ * would overflow, in which case the snapshot is unchanged.
+ */
+int seagrass_instrumentation_snapshot_merge(
+        struct seagrass_instrumentation_snapshot *object,
+        const struct seagrass_instrumentation_snapshot *other);
+
+/**
+ * @brief Retrieve the number of calls of a function with an outcome.
+ * @param [in] object snapshot.
+ * @param [in] function instrumented function.
+ * @param [in] outcome of the calls.
+ * @param [out] out receive the number of calls.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID if function is
+ * not one of the instrumented functions.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OUTCOME_IS_INVALID if outcome is not
+ * one of the outcomes.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_instrumentation_snapshot_count(
+        const struct seagrass_instrumentation_snapshot *object,
+        enum seagrass_instrumentation_function function,
+        enum seagrass_instrumentation_outcome outcome,
+        uintmax_t *out);
+
+/**
+ * @brief Retrieve the number of calls of a function with any outcome.
+ * @param [in] object snapshot.
+ * @param [in] function instrumented function.
+ * @param [out] out receive the number of calls.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID if function is
+ * not one of the instrumented functions.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_INSTRUMENTATION_ERROR_RESULT_IS_INCONSISTENT if the number
+ * of calls overflows.
+ */
+int seagrass_instrumentation_snapshot_calls(
+        const struct seagrass_instrumentation_snapshot *object,
+        enum seagrass_instrumentation_function function,
+        uintmax_t *out);
+
+#endif /* _SEAGRASS_INSTRUMENTATION_H_ */
@@ -0,0 +1,111 @@
+#ifndef _SEAGRASS_INT32_T_H_
+#define _SEAGRASS_INT32_T_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_INT32_T_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_INT32_T_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+#define SEAGRASS_INT32_T_ERROR_DIVIDE_BY_ZERO \
+    SEA_URCHIN_ERROR_DIVIDE_BY_ZERO
+#define SEAGRASS_INT32_T_ERROR_QUOTIENT_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+
+/**
+ * @brief Comparison function for int32_t*.
+ * @param [in] a first int32_t*.
+ * @param [in] b second int32_t*.
+ * @return <i>-1</i> if <b>a</b> is <u>less than</u> <b>b</b>,
+ * <i>0</i> if <b>a</b> is <u>equal to</u> <b>b</b> or <i>1</i> if <b>a</b> is
+ * <u>greater than</u> <b>b</b>.
+ * @note If <b>a</b> and <b>b</b> is <i>NULL</i> then abort(3) is called.
+ */
+int seagrass_int32_t_ptr_compare(const int32_t *a, const int32_t *b);
+
+/**
+ * @brief Comparison function for int32_t.
+ * @param [in] a first int32_t.
+ * @param [in] b second int32_t.
+ * @return <i>-1</i> if <b>a</b> is <u>less than</u> <b>b</b>,
+ * <i>0</i> if <b>a</b> is <u>equal to</u> <b>b</b> or <i>1</i> if <b>a</b> is
+ * <u>greater than</u> <b>b</b>.
+ */
+int seagrass_int32_t_compare(int32_t a, int32_t b);
+
+/**
+ * @brief Return the smaller int32_t value.
+ * @param [in] a first int32_t.
+ * @param [in] b second int32_t.
+ * @param [out] out receive the smaller between the first or second values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INT32_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_int32_t_minimum(int32_t a, int32_t b, int32_t *out);
+
+/**
+ * @brief Return the larger int32_t value.
+ * @param [in] a first int32_t.
+ * @param [in] b second int32_t.
+ * @param [out] out receive the larger between the first or second values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INT32_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_int32_t_maximum(int32_t a, int32_t b, int32_t *out);
+
+/**
+ * @brief Add two int32_t values together.
+ * @param [in] a first int32_t.
+ * @param [in] b second int32_t.
+ * @param [out] out receive the result of the two added values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INT32_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_INT32_T_ERROR_RESULT_IS_INCONSISTENT if the added values'
+ * result is not consistent.
+ */
+int seagrass_int32_t_add(int32_t a, int32_t b, int32_t *out);
+
+/**
+ * @brief Subtract the second value from the first.
+ * @param [in] a first int32_t.
+ * @param [in] b second int32_t.
+ * @param [out] out receive the result of the two subtracted values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INT32_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_INT32_T_ERROR_RESULT_IS_INCONSISTENT if the subtract
+ * values' result is not consistent.
+ */
+int seagrass_int32_t_subtract(int32_t a, int32_t b, int32_t *out);
+
+/**
+ * @brief Multiply two int32_t values.
+ * @param [in] a first int32_t.
+ * @param [in] b second int32_t.
+ * @param [out] out receive the result of the two multiplied values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INT32_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_INT32_T_ERROR_RESULT_IS_INCONSISTENT if the multiplied
+ * values' result is not consistent.
+ */
+int seagrass_int32_t_multiply(int32_t a, int32_t b, int32_t *out);
+
+/**
+ * @brief Divide the first value by the second.
+ * @param [in] a first int32_t.
+ * @param [in] b second int32_t.
+ * @param [out] quotient receive the quotient.
+ * @param [out] remainder optionally receive the remainder.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_INT32_T_ERROR_QUOTIENT_IS_NULL if quotient is <i>NULL</i>.
+ * @throws SEAGRASS_INT32_T_ERROR_DIVIDE_BY_ZERO if b is zero.
+ * @throws SEAGRASS_INT32_T_ERROR_RESULT_IS_INCONSISTENT if the quotient
+ * cannot be stored in an int32_t, that is when a is the smallest value and b
+ * is -1.
+ */
+int seagrass_int32_t_divide(int32_t a, int32_t b, int32_t *quotient,
+                            int32_t *remainder);
+
+#endif /* _SEAGRASS_INT32_T_H_ */
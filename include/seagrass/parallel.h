@@ -0,0 +1,179 @@
+#ifndef _SEAGRASS_PARALLEL_H_
+#define _SEAGRASS_PARALLEL_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+#include <seagrass/float.h>
+
+#define SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_PARALLEL_ERROR_SUMMATION_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+#define SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED \
+    SEA_URCHIN_ERROR_MEMORY_ALLOCATION_FAILED
+
+/*
+ * The reductions split the values into chunks of a fixed size, reduce the
+ * chunks on a process wide work-stealing thread pool and then combine the
+ * chunk results in order on the calling thread. As neither the chunks nor the
+ * order in which they are combined depend on the number of threads the
+ * results, including those of floating point reductions, are identical for
+ * any number of threads.
+ */
+
+/**
+ * @brief Sum uintmax_t values in parallel.
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [out] out receive the sum.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL if values is <i>NULL</i>
+ * while count is not zero.
+ * @throws SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT if the sum overflows,
+ * just as seagrass_uintmax_t_add() would have when adding the values one by
+ * one.
+ * @throws SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the chunk results.
+ */
+int seagrass_parallel_uintmax_t_sum(const uintmax_t *values, uintmax_t count,
+                                    uintmax_t *out);
+
+/**
+ * @brief Multiply uintmax_t values in parallel.
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [out] out receive the product.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL if values is <i>NULL</i>
+ * while count is not zero.
+ * @throws SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT if the product
+ * overflows before the first zero, just as seagrass_uintmax_t_multiply()
+ * would have when multiplying the values one by one.
+ * @throws SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the chunk results.
+ */
+int seagrass_parallel_uintmax_t_product(const uintmax_t *values,
+                                        uintmax_t count,
+                                        uintmax_t *out);
+
+/**
+ * @brief Smallest of the uintmax_t values computed in parallel.
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [out] out receive the minimum.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the chunk results.
+ */
+int seagrass_parallel_uintmax_t_minimum(const uintmax_t *values,
+                                        uintmax_t count,
+                                        uintmax_t *out);
+
+/**
+ * @brief Largest of the uintmax_t values computed in parallel.
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [out] out receive the maximum.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the chunk results.
+ */
+int seagrass_parallel_uintmax_t_maximum(const uintmax_t *values,
+                                        uintmax_t count,
+                                        uintmax_t *out);
+
+/**
+ * @brief Sum floats in parallel.
+ * <p>Each chunk is summed with seagrass_float_sum_n() and the chunk sums are
+ * then summed with the same algorithm.</p>
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [in] summation algorithm used to sum the values. When combined with
+ * SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS every worker flushes subnormal
+ * numbers to zero while it sums its chunk.
+ * @param [out] out receive the sum.
+ * @param [out] error optional, receive an upper bound of the absolute error
+ * of <b>out</b> relative to the exact sum of the values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL if values is <i>NULL</i>
+ * while count is not zero.
+ * @throws SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_SUMMATION_IS_INVALID if summation is not
+ * one of the summation algorithms.
+ * @throws SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT if a value is not
+ * finite or the sum overflows.
+ * @throws SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the chunk results.
+ */
+int seagrass_parallel_float_sum(const float *values, uintmax_t count,
+                                enum seagrass_float_summation summation,
+                                float *out, float *error);
+
+/**
+ * @brief Multiply floats in parallel.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [out] out receive the product.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL if values is <i>NULL</i>
+ * while count is not zero.
+ * @throws SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT if a value is not
+ * finite or the product overflows.
+ * @throws SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the chunk results.
+ */
+int seagrass_parallel_float_product(const float *values, uintmax_t count,
+                                    float *out);
+
+/**
+ * @brief Smallest of the floats computed in parallel.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [out] out receive the minimum.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT if a value is
+ * <i>NaN</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the chunk results.
+ */
+int seagrass_parallel_float_minimum(const float *values, uintmax_t count,
+                                    float *out);
+
+/**
+ * @brief Largest of the floats computed in parallel.
+ * @param [in] values array of count floats.
+ * @param [in] count number of values.
+ * @param [out] out receive the maximum.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT if a value is
+ * <i>NaN</i>.
+ * @throws SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED if there is
+ * insufficient memory for the chunk results.
+ */
+int seagrass_parallel_float_maximum(const float *values, uintmax_t count,
+                                    float *out);
+
+#endif /* _SEAGRASS_PARALLEL_H_ */
@@ -0,0 +1,185 @@
+#ifndef _SEAGRASS_STATS_H_
+#define _SEAGRASS_STATS_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_STATS_ERROR_OBJECT_IS_NULL \
+    SEA_URCHIN_ERROR_OBJECT_IS_NULL
+#define SEAGRASS_STATS_ERROR_OTHER_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_STATS_ERROR_VALUES_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_STATS_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_STATS_ERROR_COUNT_IS_ZERO \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+
+/**
+ * @brief Streaming count, mean, variance, minimum and maximum.
+ * <p>Rather than the sum and the sum of squares, which overflow and lose
+ * precision, the accumulator keeps the mean and the sum of squared
+ * deviations from the mean in double. Samples are added one at a time with
+ * Welford's update or in batches, whose statistics are computed with a
+ * corrected two-pass algorithm and then merged in O(1) with the formulas of
+ * Chan, Golub and LeVeque. Accumulators of different threads are merged the
+ * same way.</p>
+ * @note An update that fails leaves the accumulator unchanged.
+ */
+struct seagrass_stats {
+    uintmax_t count;
+    double mean;
+    double m2;
+    double minimum;
+    double maximum;
+};
+
+/**
+ * @brief Initialize empty accumulator.
+ * @param [in] object instance to be initialized.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ */
+int seagrass_stats_init(struct seagrass_stats *object);
+
+/**
+ * @brief Add a uintmax_t sample.
+ * @param [in] object accumulator.
+ * @param [in] value sample.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT if the count would
+ * overflow.
+ * @note Samples are converted to double and beyond 2<sup>53</sup> rounded.
+ */
+int seagrass_stats_add_uintmax_t(struct seagrass_stats *object,
+                                 uintmax_t value);
+
+/**
+ * @brief Add an array of uintmax_t samples.
+ * @param [in] object accumulator.
+ * @param [in] values array of count samples.
+ * @param [in] count number of samples.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_VALUES_IS_NULL if values is <i>NULL</i> and
+ * count is not zero.
+ * @throws SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT if the count would
+ * overflow.
+ */
+int seagrass_stats_add_uintmax_t_n(struct seagrass_stats *object,
+                                   const uintmax_t *values,
+                                   uintmax_t count);
+
+/**
+ * @brief Add a float sample.
+ * @param [in] object accumulator.
+ * @param [in] value sample.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT if the count would
+ * overflow or the sample is not finite.
+ */
+int seagrass_stats_add_float(struct seagrass_stats *object, float value);
+
+/**
+ * @brief Add an array of float samples.
+ * @param [in] object accumulator.
+ * @param [in] values array of count samples.
+ * @param [in] count number of samples.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_VALUES_IS_NULL if values is <i>NULL</i> and
+ * count is not zero.
+ * @throws SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT if the count would
+ * overflow or a sample is not finite.
+ */
+int seagrass_stats_add_float_n(struct seagrass_stats *object,
+                               const float *values,
+                               uintmax_t count);
+
+/**
+ * @brief Merge the samples of other into the accumulator.
+ * @param [in] object accumulator to merge into.
+ * @param [in] other accumulator whose samples are merged.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_OTHER_IS_NULL if other is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT if the count would
+ * overflow.
+ */
+int seagrass_stats_merge(struct seagrass_stats *object,
+                         const struct seagrass_stats *other);
+
+/**
+ * @brief Retrieve the number of samples.
+ * @param [in] object accumulator.
+ * @param [out] out receive the number of samples.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_stats_count(const struct seagrass_stats *object, uintmax_t *out);
+
+/**
+ * @brief Retrieve the mean of the samples.
+ * @param [in] object accumulator.
+ * @param [out] out receive the mean.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_COUNT_IS_ZERO if there are no samples.
+ */
+int seagrass_stats_mean(const struct seagrass_stats *object, double *out);
+
+/**
+ * @brief Retrieve the population variance of the samples.
+ * @param [in] object accumulator.
+ * @param [out] out receive the variance.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_COUNT_IS_ZERO if there are no samples.
+ */
+int seagrass_stats_variance(const struct seagrass_stats *object, double *out);
+
+/**
+ * @brief Retrieve the sample variance, with Bessel's correction.
+ * @param [in] object accumulator.
+ * @param [out] out receive the variance.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_COUNT_IS_ZERO if there are fewer than two
+ * samples.
+ */
+int seagrass_stats_sample_variance(const struct seagrass_stats *object,
+                                   double *out);
+
+/**
+ * @brief Retrieve the smallest sample.
+ * @param [in] object accumulator.
+ * @param [out] out receive the smallest sample.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_COUNT_IS_ZERO if there are no samples.
+ */
+int seagrass_stats_minimum(const struct seagrass_stats *object, double *out);
+
+/**
+ * @brief Retrieve the largest sample.
+ * @param [in] object accumulator.
+ * @param [out] out receive the largest sample.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_STATS_ERROR_OBJECT_IS_NULL if object is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_STATS_ERROR_COUNT_IS_ZERO if there are no samples.
+ */
+int seagrass_stats_maximum(const struct seagrass_stats *object, double *out);
+
+#endif /* _SEAGRASS_STATS_H_ */
@@ -14,6 +14,14 @@
     SEA_URCHIN_ERROR_DIVIDE_BY_ZERO
 #define SEAGRASS_UINTMAX_T_ERROR_QUOTIENT_IS_NULL \
     SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_UINTMAX_T_ERROR_RANGE_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
 
 /**
  * @brief Comparison function for uintmax_t*.
@@ -115,4 +123,179 @@ int seagrass_uintmax_t_divide(uintmax_t divisor, uintmax_t dividend,
 int seagrass_uintmax_t_times_and_a_half_even(uintmax_t current,
                                              uintmax_t *out);
 
+/**
+ * @brief Smallest value of an array and its index.
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [out] out receive the smallest value.
+ * @param [out] index optional, receive the index of the first occurrence of
+ * the smallest value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_uintmax_t_minimum_n(const uintmax_t *values, uintmax_t count,
+                                 uintmax_t *out, uintmax_t *index);
+
+/**
+ * @brief Largest value of an array and its index.
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [out] out receive the largest value.
+ * @param [out] index optional, receive the index of the first occurrence of
+ * the largest value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_uintmax_t_maximum_n(const uintmax_t *values, uintmax_t count,
+                                 uintmax_t *out, uintmax_t *index);
+
+/**
+ * @brief Smallest and largest values of an array in a single pass.
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [out] minimum receive the smallest value.
+ * @param [out] minimum_index optional, receive the index of the first
+ * occurrence of the smallest value.
+ * @param [out] maximum receive the largest value.
+ * @param [out] maximum_index optional, receive the index of the first
+ * occurrence of the largest value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL if values is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO if count is zero.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if minimum or maximum is
+ * <i>NULL</i>.
+ */
+int seagrass_uintmax_t_minmax_n(const uintmax_t *values, uintmax_t count,
+                                uintmax_t *minimum, uintmax_t *minimum_index,
+                                uintmax_t *maximum, uintmax_t *maximum_index);
+
+/**
+ * @brief Index of the first value of an array outside of a range.
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [in] minimum smallest value within the range.
+ * @param [in] maximum largest value within the range.
+ * @param [out] out receive the index of the first value less than minimum
+ * or greater than maximum, or <b>count</b> if every value is within the
+ * range.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL if values is <i>NULL</i>
+ * while count is not zero.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_RANGE_IS_INVALID if minimum is greater
+ * than maximum.
+ */
+int seagrass_uintmax_t_find_out_of_range_n(const uintmax_t *values,
+                                           uintmax_t count,
+                                           uintmax_t minimum,
+                                           uintmax_t maximum,
+                                           uintmax_t *out);
+
+/**
+ * @brief Values of an array outside of a range as a bitmask.
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [in] minimum smallest value within the range.
+ * @param [in] maximum largest value within the range.
+ * @param [out] out receive (count + 63) / 64 words where bit (i % 64) of
+ * word (i / 64) is set if values[i] is less than minimum or greater than
+ * maximum.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL if values is <i>NULL</i>
+ * while count is not zero.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i> while
+ * count is not zero.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_RANGE_IS_INVALID if minimum is greater
+ * than maximum.
+ * @note Unused bits of the last word are cleared.
+ */
+int seagrass_uintmax_t_out_of_range_mask_n(const uintmax_t *values,
+                                           uintmax_t count,
+                                           uintmax_t minimum,
+                                           uintmax_t maximum,
+                                           uint64_t *out);
+
+/*
+ * Whether the constant is not negative, spelled without >= 0 which warns
+ * for unsigned constants.
+ */
+#define SEAGRASS_UINTMAX_T_CONST_IS_NOT_NEGATIVE(a) \
+    ((a) > 0 || (a) == 0)
+
+/*
+ * Evaluate to value as an integer constant expression and fail the build if
+ * a or b is negative, as the conversion to uintmax_t would wrap it, or if
+ * check is false. A _Static_assert may appear as a member declaration, so
+ * wrapping it in sizeof keeps the whole expression constant.
+ */
+#define SEAGRASS_UINTMAX_T_CONST_CHECKED(a, b, check, message, value) \
+    ((uintmax_t) ((value) + 0 * sizeof(struct { \
+        _Static_assert(SEAGRASS_UINTMAX_T_CONST_IS_NOT_NEGATIVE(a) \
+                       && SEAGRASS_UINTMAX_T_CONST_IS_NOT_NEGATIVE(b), \
+                       "SEAGRASS_UINTMAX_T_CONST operand is negative"); \
+        _Static_assert((check), message); \
+        char c; \
+    })))
+
+/**
+ * @brief Compile-time checked addition of two constants.
+ * @param [in] a first constant.
+ * @param [in] b second constant.
+ * @return integer constant expression of <b>a</b> + <b>b</b>.
+ * @note Fails to compile if either constant is negative or the sum does not
+ * fit in uintmax_t.
+ */
+#define SEAGRASS_UINTMAX_T_CONST_ADD(a, b) \
+    SEAGRASS_UINTMAX_T_CONST_CHECKED((a), (b), \
+            (uintmax_t) (a) <= UINTMAX_MAX - (uintmax_t) (b), \
+            "SEAGRASS_UINTMAX_T_CONST_ADD overflows", \
+            (uintmax_t) (a) + (uintmax_t) (b))
+
+/**
+ * @brief Compile-time checked subtraction of two constants.
+ * @param [in] a first constant.
+ * @param [in] b second constant.
+ * @return integer constant expression of <b>a</b> - <b>b</b>.
+ * @note Fails to compile if either constant is negative or <b>b</b> is
+ * greater than <b>a</b>.
+ */
+#define SEAGRASS_UINTMAX_T_CONST_SUB(a, b) \
+    SEAGRASS_UINTMAX_T_CONST_CHECKED((a), (b), \
+            (uintmax_t) (a) >= (uintmax_t) (b), \
+            "SEAGRASS_UINTMAX_T_CONST_SUB underflows", \
+            (uintmax_t) (a) - (uintmax_t) (b))
+
+/**
+ * @brief Compile-time checked multiplication of two constants.
+ * @param [in] a first constant.
+ * @param [in] b second constant.
+ * @return integer constant expression of <b>a</b> * <b>b</b>.
+ * @note Fails to compile if either constant is negative or the product does
+ * not fit in uintmax_t.
+ */
+#define SEAGRASS_UINTMAX_T_CONST_MUL(a, b) \
+    SEAGRASS_UINTMAX_T_CONST_CHECKED((a), (b), \
+            (uintmax_t) (a) <= UINTMAX_MAX \
+                               / ((b) ? (uintmax_t) (b) : 1), \
+            "SEAGRASS_UINTMAX_T_CONST_MUL overflows", \
+            (uintmax_t) (a) * (uintmax_t) (b))
+
+/**
+ * @brief Compile-time checked division of two constants.
+ * @param [in] a dividend constant.
+ * @param [in] b divisor constant.
+ * @return integer constant expression of <b>a</b> / <b>b</b>.
+ * @note Fails to compile if either constant is negative or <b>b</b> is
+ * zero.
+ */
+#define SEAGRASS_UINTMAX_T_CONST_DIV(a, b) \
+    SEAGRASS_UINTMAX_T_CONST_CHECKED((a), (b), \
+            (b) != 0, \
+            "SEAGRASS_UINTMAX_T_CONST_DIV divides by zero", \
+            (uintmax_t) (a) / ((b) ? (uintmax_t) (b) : 1))
+
 #endif /* _SEAGRASS_UINTMAX_T_H_ */
@@ -0,0 +1,72 @@
+#ifndef _SEAGRASS_UINTMAX_T_ATOMIC_H_
+#define _SEAGRASS_UINTMAX_T_ATOMIC_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL \
+    SEA_URCHIN_ERROR_OBJECT_IS_NULL
+#define SEAGRASS_UINTMAX_T_ATOMIC_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+
+/*
+ * The operations are checked just like seagrass_uintmax_t_add() and its
+ * siblings but apply to a value shared between threads. The new value is
+ * computed from the current one and stored with a compare-and-swap, which is
+ * retried if another thread changed the value in between. An operation that
+ * would overflow fails without storing anything. Operations that cannot
+ * change the value, or that set it regardless of its current value, neither
+ * check nor retry. Successful operations have acquire-release semantics.
+ */
+
+/**
+ * @brief Atomically add to a shared uintmax_t unless the sum overflows.
+ * @param [in] object shared value.
+ * @param [in] value to be added.
+ * @param [out] out optionally receive the sum that was stored.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ATOMIC_ERROR_RESULT_IS_INCONSISTENT if the sum
+ * overflows, in which case the shared value is unchanged.
+ */
+int seagrass_uintmax_t_atomic_add(atomic_uintmax_t *object,
+                                  uintmax_t value,
+                                  uintmax_t *out);
+
+/**
+ * @brief Atomically subtract from a shared uintmax_t unless the difference
+ * would be negative.
+ * @param [in] object shared value.
+ * @param [in] value to be subtracted.
+ * @param [out] out optionally receive the difference that was stored.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ATOMIC_ERROR_RESULT_IS_INCONSISTENT if value is
+ * larger than the shared value, in which case the shared value is unchanged.
+ */
+int seagrass_uintmax_t_atomic_subtract(atomic_uintmax_t *object,
+                                       uintmax_t value,
+                                       uintmax_t *out);
+
+/**
+ * @brief Atomically multiply a shared uintmax_t unless the product
+ * overflows.
+ * @param [in] object shared value.
+ * @param [in] value to multiply by.
+ * @param [out] out optionally receive the product that was stored.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ATOMIC_ERROR_RESULT_IS_INCONSISTENT if the
+ * product overflows, in which case the shared value is unchanged.
+ */
+int seagrass_uintmax_t_atomic_multiply(atomic_uintmax_t *object,
+                                       uintmax_t value,
+                                       uintmax_t *out);
+
+#endif /* _SEAGRASS_UINTMAX_T_ATOMIC_H_ */
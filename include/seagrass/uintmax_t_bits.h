@@ -0,0 +1,121 @@
+#ifndef _SEAGRASS_UINTMAX_T_BITS_H_
+#define _SEAGRASS_UINTMAX_T_BITS_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <seagrass/uintmax_t.h>
+
+/**
+ * @brief Is the uintmax_t value a power of two.
+ * @param [in] a uintmax_t value.
+ * @param [out] out true if <b>a</b> is a power of two, false otherwise.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_uintmax_t_is_power_of_two(uintmax_t a, bool *out);
+
+/**
+ * @brief Return the smallest power of two that is greater than or equal to
+ * the value.
+ * @param [in] a uintmax_t value.
+ * @param [out] out receive the power of two.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT if the power of
+ * two cannot be stored in a uintmax_t.
+ */
+int seagrass_uintmax_t_next_power_of_two(uintmax_t a, uintmax_t *out);
+
+/**
+ * @brief Return the base 2 logarithm of the value rounded down.
+ * @param [in] a uintmax_t value.
+ * @param [out] out receive the logarithm.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID if a is zero.
+ */
+int seagrass_uintmax_t_floor_log2(uintmax_t a, uintmax_t *out);
+
+/**
+ * @brief Return the base 2 logarithm of the value rounded up.
+ * @param [in] a uintmax_t value.
+ * @param [out] out receive the logarithm.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID if a is zero.
+ */
+int seagrass_uintmax_t_ceil_log2(uintmax_t a, uintmax_t *out);
+
+/**
+ * @brief Return the number of set bits in the value.
+ * @param [in] a uintmax_t value.
+ * @param [out] out receive the number of set bits.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_uintmax_t_popcount(uintmax_t a, uintmax_t *out);
+
+/**
+ * @brief Return the number of leading zero bits in the value.
+ * @param [in] a uintmax_t value.
+ * @param [out] out receive the number of leading zero bits.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @note If <b>a</b> is zero then out receives the width of uintmax_t in bits.
+ */
+int seagrass_uintmax_t_count_leading_zeros(uintmax_t a, uintmax_t *out);
+
+/**
+ * @brief Return the number of trailing zero bits in the value.
+ * @param [in] a uintmax_t value.
+ * @param [out] out receive the number of trailing zero bits.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @note If <b>a</b> is zero then out receives the width of uintmax_t in bits.
+ */
+int seagrass_uintmax_t_count_trailing_zeros(uintmax_t a, uintmax_t *out);
+
+/**
+ * @brief Round the value up to a multiple of the alignment.
+ * @param [in] a uintmax_t value.
+ * @param [in] alignment power of two.
+ * @param [out] out receive the aligned value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID if alignment is not a
+ * power of two.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT if the aligned
+ * value cannot be stored in a uintmax_t.
+ */
+int seagrass_uintmax_t_align_up(uintmax_t a, uintmax_t alignment,
+                                uintmax_t *out);
+
+/**
+ * @brief Round the value down to a multiple of the alignment.
+ * @param [in] a uintmax_t value.
+ * @param [in] alignment power of two.
+ * @param [out] out receive the aligned value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID if alignment is not a
+ * power of two.
+ */
+int seagrass_uintmax_t_align_down(uintmax_t a, uintmax_t alignment,
+                                  uintmax_t *out);
+
+/**
+ * @brief Raise the base to the power of the exponent.
+ * @param [in] base uintmax_t value.
+ * @param [in] exponent uintmax_t value.
+ * @param [out] out receive the result of base to the power of exponent.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT if the result
+ * cannot be stored in a uintmax_t.
+ * @note Zero to the power of zero is one.
+ */
+int seagrass_uintmax_t_power(uintmax_t base, uintmax_t exponent,
+                             uintmax_t *out);
+
+#endif /* _SEAGRASS_UINTMAX_T_BITS_H_ */
@@ -0,0 +1,164 @@
+#ifndef _SEAGRASS_UINTMAX_T_CHECKED_H_
+#define _SEAGRASS_UINTMAX_T_CHECKED_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL \
+    SEA_URCHIN_ERROR_OBJECT_IS_NULL
+#define SEAGRASS_UINTMAX_T_CHECKED_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_UINTMAX_T_CHECKED_ERROR_VALUES_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_UINTMAX_T_CHECKED_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+
+/**
+ * @brief uintmax_t value with a sticky overflow flag.
+ * <p>Once an operation overflows the flag remains set, in the spirit of the
+ * IEEE 754 exception flags, so that a loop may perform many operations
+ * without branching and check for failure once at the end.</p>
+ * @note The value is unspecified once overflow has been flagged.
+ */
+struct seagrass_uintmax_t_checked {
+    uintmax_t value;
+    bool overflow;
+};
+
+/**
+ * @brief Initialize checked value.
+ * @param [in] object instance to be initialized.
+ * @param [in] value initial value.
+ * @note <b>object</b> must not be <i>NULL</i>.
+ */
+static inline void seagrass_uintmax_t_checked_init(
+        struct seagrass_uintmax_t_checked *const object,
+        const uintmax_t value) {
+    object->value = value;
+    object->overflow = false;
+}
+
+/**
+ * @brief Add value to the checked value.
+ * @param [in] object instance whose value will be added to.
+ * @param [in] value to be added.
+ * @note <b>object</b> must not be <i>NULL</i>.
+ */
+static inline void seagrass_uintmax_t_checked_add(
+        struct seagrass_uintmax_t_checked *const object,
+        const uintmax_t value) {
+    uintmax_t result;
+#if defined(__GNUC__) || defined(__clang__)
+    object->overflow |= __builtin_add_overflow(object->value, value, &result);
+#else
+    result = object->value + value;
+    object->overflow |= result < value;
+#endif
+    object->value = result;
+}
+
+/**
+ * @brief Subtract value from the checked value.
+ * @param [in] object instance whose value will be subtracted from.
+ * @param [in] value to be subtracted.
+ * @note <b>object</b> must not be <i>NULL</i>.
+ */
+static inline void seagrass_uintmax_t_checked_subtract(
+        struct seagrass_uintmax_t_checked *const object,
+        const uintmax_t value) {
+    uintmax_t result;
+#if defined(__GNUC__) || defined(__clang__)
+    object->overflow |= __builtin_sub_overflow(object->value, value, &result);
+#else
+    result = object->value - value;
+    object->overflow |= object->value < value;
+#endif
+    object->value = result;
+}
+
+/**
+ * @brief Multiply the checked value by value.
+ * @param [in] object instance whose value will be multiplied.
+ * @param [in] value to multiply by.
+ * @note <b>object</b> must not be <i>NULL</i>.
+ */
+static inline void seagrass_uintmax_t_checked_multiply(
+        struct seagrass_uintmax_t_checked *const object,
+        const uintmax_t value) {
+    uintmax_t result;
+#if defined(__GNUC__) || defined(__clang__)
+    object->overflow |= __builtin_mul_overflow(object->value, value, &result);
+#else
+    result = object->value * value;
+    object->overflow |= object->value && result / object->value != value;
+#endif
+    object->value = result;
+}
+
+/**
+ * @brief Add the other checked value to the checked value.
+ * @param [in] object instance whose value will be added to.
+ * @param [in] other checked value to be added.
+ * @note The overflow flag of <b>other</b> is carried over.
+ * @note <b>object</b> and <b>other</b> must not be <i>NULL</i>.
+ */
+static inline void seagrass_uintmax_t_checked_merge(
+        struct seagrass_uintmax_t_checked *const object,
+        const struct seagrass_uintmax_t_checked *const other) {
+    object->overflow |= other->overflow;
+    seagrass_uintmax_t_checked_add(object, other->value);
+}
+
+/**
+ * @brief Retrieve the checked value.
+ * @param [in] object instance whose value we are to retrieve.
+ * @param [out] out receive the value.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_CHECKED_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_CHECKED_ERROR_RESULT_IS_INCONSISTENT if any of
+ * the operations performed on the checked value overflowed.
+ */
+int seagrass_uintmax_t_checked_get(
+        const struct seagrass_uintmax_t_checked *object, uintmax_t *out);
+
+/**
+ * @brief Add all the values to the checked value.
+ * @param [in] object instance whose value will be added to.
+ * @param [in] values array of uintmax_t to be added.
+ * @param [in] count number of items in the values array.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_CHECKED_ERROR_VALUES_IS_NULL if values is
+ * <i>NULL</i> and count is not zero.
+ * @note Overflow is recorded in the checked value and is not reported as an
+ * error by this function.
+ */
+int seagrass_uintmax_t_checked_sum(
+        struct seagrass_uintmax_t_checked *object,
+        const uintmax_t *values,
+        uintmax_t count);
+
+/**
+ * @brief Multiply the checked value by all the values.
+ * @param [in] object instance whose value will be multiplied.
+ * @param [in] values array of uintmax_t to multiply by.
+ * @param [in] count number of items in the values array.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_CHECKED_ERROR_VALUES_IS_NULL if values is
+ * <i>NULL</i> and count is not zero.
+ * @note Overflow is recorded in the checked value and is not reported as an
+ * error by this function.
+ */
+int seagrass_uintmax_t_checked_product(
+        struct seagrass_uintmax_t_checked *object,
+        const uintmax_t *values,
+        uintmax_t count);
+
+#endif /* _SEAGRASS_UINTMAX_T_CHECKED_H_ */
@@ -0,0 +1,104 @@
+#ifndef _SEAGRASS_UINTMAX_T_DIVIDER_H_
+#define _SEAGRASS_UINTMAX_T_DIVIDER_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL \
+    SEA_URCHIN_ERROR_OBJECT_IS_NULL
+#define SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_UINTMAX_T_DIVIDER_ERROR_DIVIDE_BY_ZERO \
+    SEA_URCHIN_ERROR_DIVIDE_BY_ZERO
+#define SEAGRASS_UINTMAX_T_DIVIDER_ERROR_QUOTIENT_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_UINTMAX_T_DIVIDER_ERROR_VALUES_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+
+/**
+ * @brief Precomputed reciprocal of an invariant divisor.
+ * <p>Division by the divisor is performed using a multiplication and shifts
+ * only, which is considerably cheaper than a hardware divide when the same
+ * divisor is used many times.</p>
+ */
+struct seagrass_uintmax_t_divider {
+    uintmax_t divisor;
+    uintmax_t magic;
+    unsigned char shift;
+    bool add;
+};
+
+/**
+ * @brief Initialize divider.
+ * @param [in] object instance to be initialized.
+ * @param [in] divisor uintmax_t that values will be divided by.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_DIVIDER_ERROR_DIVIDE_BY_ZERO if divisor is
+ * zero.
+ */
+int seagrass_uintmax_t_divider_init(struct seagrass_uintmax_t_divider *object,
+                                    uintmax_t divisor);
+
+/**
+ * @brief Divide value by the divider's divisor.
+ * @param [in] object divider instance.
+ * @param [in] value uintmax_t to be divided.
+ * @param [out] quotient receive the quotient.
+ * @param [out] remainder optionally receive the remainder.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_DIVIDER_ERROR_QUOTIENT_IS_NULL if quotient is
+ * <i>NULL</i>.
+ */
+int seagrass_uintmax_t_divider_divide(
+        const struct seagrass_uintmax_t_divider *object,
+        uintmax_t value,
+        uintmax_t *quotient,
+        uintmax_t *remainder);
+
+/**
+ * @brief Remainder of value divided by the divider's divisor.
+ * @param [in] object divider instance.
+ * @param [in] value uintmax_t to be divided.
+ * @param [out] out receive the remainder.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ */
+int seagrass_uintmax_t_divider_modulo(
+        const struct seagrass_uintmax_t_divider *object,
+        uintmax_t value,
+        uintmax_t *out);
+
+/**
+ * @brief Divide each of the values by the divider's divisor.
+ * @param [in] object divider instance.
+ * @param [in] values array of uintmax_t to be divided.
+ * @param [in] count number of items in the values array.
+ * @param [out] quotients array of count items to receive the quotients.
+ * @param [out] remainders optional array of count items to receive the
+ * remainders.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL if object is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_DIVIDER_ERROR_VALUES_IS_NULL if values is
+ * <i>NULL</i> and count is not zero.
+ * @throws SEAGRASS_UINTMAX_T_DIVIDER_ERROR_QUOTIENT_IS_NULL if quotients is
+ * <i>NULL</i> and count is not zero.
+ * @note <b>quotients</b> or <b>remainders</b> may be the same array as
+ * <b>values</b> to divide in place.
+ */
+int seagrass_uintmax_t_divider_divide_n(
+        const struct seagrass_uintmax_t_divider *object,
+        const uintmax_t *values,
+        uintmax_t count,
+        uintmax_t *quotients,
+        uintmax_t *remainders);
+
+#endif /* _SEAGRASS_UINTMAX_T_DIVIDER_H_ */
@@ -0,0 +1,54 @@
+#ifndef _SEAGRASS_UINTMAX_T_PREFIX_SUM_H_
+#define _SEAGRASS_UINTMAX_T_PREFIX_SUM_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_VALUES_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_MODE_IS_INVALID \
+    SEA_URCHIN_ERROR_VALUE_IS_INVALID
+#define SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+
+enum seagrass_uintmax_t_prefix_sum_mode {
+    /* out[i] = values[0] + ... + values[i] */
+    SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE = 0,
+    /* out[i] = values[0] + ... + values[i - 1], out[0] = 0 */
+    SEAGRASS_UINTMAX_T_PREFIX_SUM_EXCLUSIVE = 1
+};
+
+/**
+ * @brief Prefix sum of an array of uintmax_t.
+ * <p>Large arrays are scanned in two passes on the thread pool, first
+ * summing blocks of values and then scanning each block from the sum of the
+ * blocks before it.</p>
+ * @param [in] values array of count uintmax_t.
+ * @param [in] count number of values.
+ * @param [in] mode inclusive or exclusive prefix sum.
+ * @param [out] out array of count uintmax_t to receive the prefix sums.
+ * @param [out] index optional, receive the index of the first element of
+ * <b>out</b> that overflows.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_VALUES_IS_NULL if values is
+ * <i>NULL</i> and count is not zero.
+ * @throws SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i> and count is not zero.
+ * @throws SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_MODE_IS_INVALID if mode is not
+ * one of the prefix sum modes.
+ * @throws SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_RESULT_IS_INCONSISTENT if a
+ * prefix sum overflows. The elements of <b>out</b> before <b>index</b> hold
+ * their prefix sums while the others are unspecified.
+ * @note <b>out</b> may be the same array as <b>values</b>.
+ */
+int seagrass_uintmax_t_prefix_sum(const uintmax_t *values,
+                                  uintmax_t count,
+                                  enum seagrass_uintmax_t_prefix_sum_mode mode,
+                                  uintmax_t *out,
+                                  uintmax_t *index);
+
+#endif /* _SEAGRASS_UINTMAX_T_PREFIX_SUM_H_ */
@@ -0,0 +1,95 @@
+#ifndef _SEAGRASS_UINTMAX_T_SATURATING_H_
+#define _SEAGRASS_UINTMAX_T_SATURATING_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+
+/**
+ * @brief Add two uintmax_t values together saturating at UINTMAX_MAX.
+ * @param [in] a first uintmax_t.
+ * @param [in] b second uintmax_t.
+ * @return sum of the two values or <i>UINTMAX_MAX</i> if it overflows.
+ */
+uintmax_t seagrass_uintmax_t_saturating_add(uintmax_t a, uintmax_t b);
+
+/**
+ * @brief Subtract the second value from the first saturating at zero.
+ * @param [in] a first uintmax_t.
+ * @param [in] b second uintmax_t.
+ * @return difference of the two values or <i>0</i> if it underflows.
+ */
+uintmax_t seagrass_uintmax_t_saturating_subtract(uintmax_t a, uintmax_t b);
+
+/**
+ * @brief Multiply two uintmax_t values saturating at UINTMAX_MAX.
+ * @param [in] a first uintmax_t.
+ * @param [in] b second uintmax_t.
+ * @return product of the two values or <i>UINTMAX_MAX</i> if it overflows.
+ */
+uintmax_t seagrass_uintmax_t_saturating_multiply(uintmax_t a, uintmax_t b);
+
+/**
+ * @brief Add the values of two arrays element-wise saturating at
+ * UINTMAX_MAX.
+ * @param [in] a first array of uintmax_t.
+ * @param [in] b second array of uintmax_t.
+ * @param [in] count number of items in each of the arrays.
+ * @param [out] out array of count items to receive the results.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL if a or b is
+ * <i>NULL</i> and count is not zero.
+ * @throws SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i> and count is not zero.
+ * @note <b>out</b> may be the same array as <b>a</b> or <b>b</b>.
+ */
+int seagrass_uintmax_t_saturating_add_n(const uintmax_t *a,
+                                        const uintmax_t *b,
+                                        uintmax_t count,
+                                        uintmax_t *out);
+
+/**
+ * @brief Subtract the values of the second array from the first
+ * element-wise saturating at zero.
+ * @param [in] a first array of uintmax_t.
+ * @param [in] b second array of uintmax_t.
+ * @param [in] count number of items in each of the arrays.
+ * @param [out] out array of count items to receive the results.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL if a or b is
+ * <i>NULL</i> and count is not zero.
+ * @throws SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i> and count is not zero.
+ * @note <b>out</b> may be the same array as <b>a</b> or <b>b</b>.
+ */
+int seagrass_uintmax_t_saturating_subtract_n(const uintmax_t *a,
+                                             const uintmax_t *b,
+                                             uintmax_t count,
+                                             uintmax_t *out);
+
+/**
+ * @brief Multiply the values of two arrays element-wise saturating at
+ * UINTMAX_MAX.
+ * @param [in] a first array of uintmax_t.
+ * @param [in] b second array of uintmax_t.
+ * @param [in] count number of items in each of the arrays.
+ * @param [out] out array of count items to receive the results.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL if a or b is
+ * <i>NULL</i> and count is not zero.
+ * @throws SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL if out is
+ * <i>NULL</i> and count is not zero.
+ * @note <b>out</b> may be the same array as <b>a</b> or <b>b</b>.
+ */
+int seagrass_uintmax_t_saturating_multiply_n(const uintmax_t *a,
+                                             const uintmax_t *b,
+                                             uintmax_t count,
+                                             uintmax_t *out);
+
+#endif /* _SEAGRASS_UINTMAX_T_SATURATING_H_ */
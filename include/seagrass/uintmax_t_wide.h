@@ -0,0 +1,98 @@
+#ifndef _SEAGRASS_UINTMAX_T_WIDE_H_
+#define _SEAGRASS_UINTMAX_T_WIDE_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sea-urchin.h>
+
+#define SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL \
+    SEA_URCHIN_ERROR_OUT_IS_NULL
+#define SEAGRASS_UINTMAX_T_WIDE_ERROR_QUOTIENT_IS_NULL \
+    SEA_URCHIN_ERROR_VALUE_IS_NULL
+#define SEAGRASS_UINTMAX_T_WIDE_ERROR_DIVIDE_BY_ZERO \
+    SEA_URCHIN_ERROR_DIVIDE_BY_ZERO
+#define SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT \
+    SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT
+
+/**
+ * @brief Unsigned integer twice the width of uintmax_t.
+ * <p>The value is <b>hi</b> * 2^w + <b>lo</b> where w is the width of
+ * uintmax_t in bits.</p>
+ */
+struct seagrass_uintmax_t_wide {
+    uintmax_t hi;
+    uintmax_t lo;
+};
+
+/**
+ * @brief Multiply two uintmax_t values into a double width result.
+ * @param [in] a first uintmax_t.
+ * @param [in] b second uintmax_t.
+ * @param [out] out receive the full product of the two values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @note Uses <i>unsigned __int128</i> where available, otherwise a portable
+ * half word implementation.
+ */
+int seagrass_uintmax_t_multiply_wide(uintmax_t a, uintmax_t b,
+                                     struct seagrass_uintmax_t_wide *out);
+
+/**
+ * @brief Multiply two uintmax_t values and then divide by the third without
+ * overflow of the intermediate product.
+ * @param [in] a first uintmax_t.
+ * @param [in] b second uintmax_t.
+ * @param [in] c uintmax_t used to divide the product of a and b.
+ * @param [out] quotient receive the quotient of (a * b) / c.
+ * @param [out] remainder optionally receive the remainder of (a * b) / c.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_WIDE_ERROR_QUOTIENT_IS_NULL if quotient is
+ * <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_WIDE_ERROR_DIVIDE_BY_ZERO if c is zero.
+ * @throws SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT if the
+ * quotient cannot be stored in a uintmax_t.
+ */
+int seagrass_uintmax_t_muldiv(uintmax_t a, uintmax_t b, uintmax_t c,
+                              uintmax_t *quotient, uintmax_t *remainder);
+
+/**
+ * @brief Comparison function for double width values.
+ * @param [in] a first double width value.
+ * @param [in] b second double width value.
+ * @return <i>-1</i> if <b>a</b> is <u>less than</u> <b>b</b>,
+ * <i>0</i> if <b>a</b> is <u>equal to</u> <b>b</b> or <i>1</i> if <b>a</b> is
+ * <u>greater than</u> <b>b</b>.
+ */
+int seagrass_uintmax_t_wide_compare(struct seagrass_uintmax_t_wide a,
+                                    struct seagrass_uintmax_t_wide b);
+
+/**
+ * @brief Add two double width values together.
+ * @param [in] a first double width value.
+ * @param [in] b second double width value.
+ * @param [out] out receive the result of the two added values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT if the added
+ * values' result is not consistent.
+ */
+int seagrass_uintmax_t_wide_add(struct seagrass_uintmax_t_wide a,
+                                struct seagrass_uintmax_t_wide b,
+                                struct seagrass_uintmax_t_wide *out);
+
+/**
+ * @brief Subtract the second double width value from the first.
+ * @param [in] a first double width value.
+ * @param [in] b second double width value.
+ * @param [out] out receive the result of the two subtracted values.
+ * @return On success <i>0</i>, otherwise an error code.
+ * @throws SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL if out is <i>NULL</i>.
+ * @throws SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT if the
+ * subtracted values' result is not consistent.
+ */
+int seagrass_uintmax_t_wide_subtract(struct seagrass_uintmax_t_wide a,
+                                     struct seagrass_uintmax_t_wide b,
+                                     struct seagrass_uintmax_t_wide *out);
+
+#endif /* _SEAGRASS_UINTMAX_T_WIDE_H_ */
@@ -0,0 +1,89 @@
+#ifndef _SEAGRASS_BITS_H_
+#define _SEAGRASS_BITS_H_
+
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SEAGRASS_BITS_WIDTH (sizeof(uintmax_t) * CHAR_BIT)
+
+#if (defined(__GNUC__) || defined(__clang__)) && UINTMAX_MAX == ULLONG_MAX
+#define SEAGRASS_BITS_BUILTIN
+#endif
+
+/**
+ * @brief Number of leading zero bits.
+ * @param [in] a non-zero value.
+ * @return number of leading zero bits in a.
+ * @note Compiles to lzcnt or bsr where the target supports it.
+ */
+static inline unsigned int seagrass_bits_clz(const uintmax_t a) {
+#if defined(SEAGRASS_BITS_BUILTIN)
+    return (unsigned int) __builtin_clzll(a);
+#else
+    unsigned int n = 0;
+    for (uintmax_t bit = (uintmax_t) 1 << (SEAGRASS_BITS_WIDTH - 1);
+         !(a & bit); bit >>= 1) {
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Number of trailing zero bits.
+ * @param [in] a non-zero value.
+ * @return number of trailing zero bits in a.
+ * @note Compiles to tzcnt or bsf where the target supports it.
+ */
+static inline unsigned int seagrass_bits_ctz(const uintmax_t a) {
+#if defined(SEAGRASS_BITS_BUILTIN)
+    return (unsigned int) __builtin_ctzll(a);
+#else
+    unsigned int n = 0;
+    for (uintmax_t bit = 1; !(a & bit); bit <<= 1) {
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Number of set bits.
+ * @param [in] a value.
+ * @return number of set bits in a.
+ * @note Compiles to popcnt where the target supports it.
+ */
+static inline unsigned int seagrass_bits_popcount(uintmax_t a) {
+#if defined(SEAGRASS_BITS_BUILTIN)
+    return (unsigned int) __builtin_popcountll(a);
+#else
+    unsigned int n = 0;
+    for (; a; a &= a - 1) {
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Gather the lowest bit of 64 bytes into a word.
+ * @param [in] bytes 64 bytes that are each zero or one.
+ * @return word whose bit i is bytes[i].
+ * @note Eight bytes are gathered per multiplication, which moves the lowest
+ * bit of each of them into the top byte of the product.
+ */
+static inline uint64_t seagrass_bits_gather(const uint8_t *const bytes) {
+    uint64_t bits = 0;
+    for (unsigned int i = 0; i < 64; i += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        bits |= ((word * UINT64_C(0x0102040810204080)) >> 56) << i;
+    }
+    return bits;
+}
+
+#endif /* _SEAGRASS_BITS_H_ */
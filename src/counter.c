@@ -0,0 +1,103 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "thread_identity.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* Slots fill a cache line each. */
+#define LINE 64
+#define COUNTS_PER_LINE (LINE / sizeof(uintmax_t))
+
+/* Identity of the calling thread plus one, zero until it has been looked
+ * up. */
+static _Thread_local uintmax_t identity;
+
+static inline _Atomic(uintmax_t) *slot(
+        const struct seagrass_counter *const object,
+        const uintmax_t index) {
+    return object->counts + index * COUNTS_PER_LINE;
+}
+
+int seagrass_counter_init(struct seagrass_counter *const object,
+                          const uintmax_t slots) {
+    if (!object) {
+        return SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL;
+    }
+    if (!slots) {
+        return SEAGRASS_COUNTER_ERROR_SLOTS_IS_ZERO;
+    }
+    uintmax_t size;
+    void *counts;
+    /* the slots plus the shared one */
+    if (slots == UINTMAX_MAX
+        || seagrass_uintmax_t_multiply(slots + 1, LINE, &size)
+        || size > SIZE_MAX
+        || posix_memalign(&counts, LINE, (size_t) size)) {
+        return SEAGRASS_COUNTER_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    *object = (struct seagrass_counter) {
+            .slots = slots,
+            .counts = counts
+    };
+    for (uintmax_t i = 0; i <= slots; i++) {
+        atomic_init(slot(object, i), 0);
+    }
+    return 0;
+}
+
+int seagrass_counter_invalidate(struct seagrass_counter *const object) {
+    if (!object) {
+        return SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL;
+    }
+    free(object->counts);
+    *object = (struct seagrass_counter) {0};
+    return 0;
+}
+
+int seagrass_counter_add(struct seagrass_counter *const object,
+                         const uintmax_t value) {
+    if (!object) {
+        return SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL;
+    }
+    if (!identity) {
+        identity = seagrass_thread_identity() + 1;
+    }
+    if (identity > object->slots) {
+        return seagrass_uintmax_t_atomic_add(slot(object, object->slots),
+                                             value, NULL);
+    }
+    /* only the owner writes to its slot */
+    _Atomic(uintmax_t) *const count = slot(object, identity - 1);
+    const uintmax_t current = atomic_load_explicit(count,
+                                                   memory_order_relaxed);
+    const uintmax_t sum = current + value;
+    if (sum < current) {
+        return SEAGRASS_COUNTER_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    atomic_store_explicit(count, sum, memory_order_relaxed);
+    return 0;
+}
+
+int seagrass_counter_value(const struct seagrass_counter *const object,
+                           uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_COUNTER_ERROR_OUT_IS_NULL;
+    }
+    uintmax_t sum = 0;
+    for (uintmax_t i = 0; i <= object->slots; i++) {
+        if (seagrass_uintmax_t_add(
+                sum, atomic_load_explicit(slot(object, i),
+                                          memory_order_relaxed),
+                &sum)) {
+            return SEAGRASS_COUNTER_ERROR_RESULT_IS_INCONSISTENT;
+        }
+    }
+    *out = sum;
+    return 0;
+}
@@ -0,0 +1,26 @@
+#include <stdlib.h>
+#include <float.h>
+#include <fenv.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "instrumentation.h"
+
+#pragma STDC FENV_ACCESS ON
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define SEAGRASS_TEMPLATE_TYPE double
+#define SEAGRASS_TEMPLATE_EPSILON DBL_EPSILON
+#define SEAGRASS_TEMPLATE_FABS fabs
+#define SEAGRASS_TEMPLATE_LLRINT llrint
+#define SEAGRASS_TEMPLATE_MIN DBL_MIN
+#define SEAGRASS_TEMPLATE_MANT_DIG DBL_MANT_DIG
+#define SEAGRASS_TEMPLATE_RESIDUAL(x, y, z) fma((x), (y), -(z))
+#define SEAGRASS_TEMPLATE_FUNCTION(name) seagrass_double_ ## name
+#define SEAGRASS_TEMPLATE_ERROR(name) SEAGRASS_DOUBLE_ERROR_ ## name
+#define SEAGRASS_TEMPLATE_INSTRUMENTATION(name) \
+    SEAGRASS_INSTRUMENTATION_DOUBLE_ ## name
+#include "floating_template.h"
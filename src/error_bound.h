@@ -0,0 +1,54 @@
+#ifndef _SEAGRASS_ERROR_BOUND_H_
+#define _SEAGRASS_ERROR_BOUND_H_
+
+#include <float.h>
+#include <math.h>
+
+/* Rounding error bounds of the float reductions, evaluated in double. */
+
+/**
+ * @brief Unit roundoff of float.
+ */
+#define SEAGRASS_FLOAT_U ((double) FLT_EPSILON / 2)
+
+/**
+ * @brief Unit roundoff of double.
+ */
+#define SEAGRASS_DOUBLE_U (DBL_EPSILON / 2)
+
+/**
+ * @brief Error factor of a chain of operations.
+ * @param [in] k number of operations in the longest chain.
+ * @param [in] u unit roundoff.
+ * @return k * u / (1 - k * u), or infinity if k * u is not below one.
+ */
+static inline double seagrass_error_factor(const double k, const double u) {
+    const double ku = k * u;
+    return ku < 1 ? ku / (1 - ku) : INFINITY;
+}
+
+/**
+ * @brief Upper bound of an exact sum of absolute values.
+ * @param [in] computed sum of absolute values computed in float.
+ * @param [in] factor error factor of the longest chain of operations.
+ * @return computed / (1 - factor), or infinity if factor is not below one.
+ */
+static inline double seagrass_upper_magnitude(const double computed,
+                                              const double factor) {
+    return factor < 1 ? computed / (1 - factor) : INFINITY;
+}
+
+/**
+ * @brief Smallest float not below the value.
+ * @param [in] value bound computed in double.
+ * @return value rounded up to float, infinity for NaN.
+ */
+static inline float seagrass_round_up(const double value) {
+    if (isnan(value)) {
+        return INFINITY;
+    }
+    const float result = (float) value;
+    return result < value ? nextafterf(result, INFINITY) : result;
+}
+
+#endif /* _SEAGRASS_ERROR_BOUND_H_ */
@@ -0,0 +1,86 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+
+/* flush to zero (bit 15) and denormals are zero (bit 6) of MXCSR */
+#define FAST_DENORMALS ((uintmax_t) 0x8040)
+
+static uintmax_t get_state(void) {
+    return _mm_getcsr();
+}
+
+static void set_state(const uintmax_t state) {
+    _mm_setcsr((unsigned int) state);
+}
+
+#elif defined(__aarch64__)
+
+/* flush to zero (bit 24) of FPCR, which flushes operands as well */
+#define FAST_DENORMALS ((uintmax_t) 1 << 24)
+
+static uintmax_t get_state(void) {
+    uint64_t state;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(state));
+    return state;
+}
+
+static void set_state(const uintmax_t state) {
+    __asm__ __volatile__("msr fpcr, %0" : : "r"((uint64_t) state));
+}
+
+#else
+
+#define FAST_DENORMALS ((uintmax_t) 0)
+
+static uintmax_t get_state(void) {
+    return 0;
+}
+
+static void set_state(const uintmax_t state) {
+    (void) state;
+}
+
+#endif
+
+int seagrass_float_fast_denormals_is_supported(bool *const out) {
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    *out = 0 != FAST_DENORMALS;
+    return 0;
+}
+
+int seagrass_float_fast_denormals_begin(
+        struct seagrass_float_fast_denormals *const out) {
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    const uintmax_t state = get_state();
+    if (FAST_DENORMALS != (state & FAST_DENORMALS)) {
+        set_state(state | FAST_DENORMALS);
+    }
+    out->state = state;
+    return 0;
+}
+
+int seagrass_float_fast_denormals_end(
+        const struct seagrass_float_fast_denormals *const object) {
+    if (!object) {
+        return SEAGRASS_FLOAT_ERROR_OBJECT_IS_NULL;
+    }
+    /* keep the exception flags raised within the scope */
+    const uintmax_t state = get_state();
+    const uintmax_t restored = (state & ~FAST_DENORMALS)
+                               | (object->state & FAST_DENORMALS);
+    if (restored != state) {
+        set_state(restored);
+    }
+    return 0;
+}
@@ -0,0 +1,231 @@
+#include <stdlib.h>
+#include <string.h>
+#include <seagrass.h>
+
+#include "kernel.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* The floats are reduced as integer keys that order the same as the floats
+ * do. Unlike float comparisons, which the compiler may only turn into vector
+ * minimum and maximum instructions when NaN and signed zeros can be ignored,
+ * integer comparisons vectorize as they are. */
+#define LANES 32
+/* Values reduced between updates of the running extremes. The index of an
+ * extreme is only searched for within the block that holds it. */
+#define BLOCK 1024
+/* Magnitudes above that of infinity are NaN. */
+#define INFINITY_MAGNITUDE 0x7f800000u
+
+/* Flip the magnitude of negative floats so that the keys order as signed
+ * integers, with -0.0 right before +0.0. */
+static inline int32_t key(const float value, uint32_t *const magnitude) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    *magnitude = bits & 0x7fffffff;
+    return (int32_t) (bits ^ ((uint32_t) ((int32_t) bits >> 31) >> 1));
+}
+
+struct extremes {
+    int32_t minimum;
+    int32_t maximum;
+    uint32_t magnitude;
+};
+
+static inline void update(struct extremes *const extremes, const float value) {
+    uint32_t magnitude;
+    const int32_t k = key(value, &magnitude);
+    extremes->minimum = k < extremes->minimum ? k : extremes->minimum;
+    extremes->maximum = k > extremes->maximum ? k : extremes->maximum;
+    extremes->magnitude = magnitude > extremes->magnitude
+                          ? magnitude : extremes->magnitude;
+}
+
+/* count is a nonzero multiple of LANES. */
+static inline struct extremes lanes(const float *const values,
+                                    const uintmax_t count,
+                                    const bool minimum,
+                                    const bool maximum) {
+    int32_t low[LANES];
+    int32_t high[LANES];
+    uint32_t magnitude[LANES];
+    for (uintmax_t j = 0; j < LANES; j++) {
+        low[j] = high[j] = key(values[j], &magnitude[j]);
+    }
+    for (uintmax_t i = LANES; i < count; i += LANES) {
+        for (uintmax_t j = 0; j < LANES; j++) {
+            uint32_t m;
+            const int32_t k = key(values[i + j], &m);
+            if (minimum) {
+                low[j] = k < low[j] ? k : low[j];
+            }
+            if (maximum) {
+                high[j] = k > high[j] ? k : high[j];
+            }
+            magnitude[j] = m > magnitude[j] ? m : magnitude[j];
+        }
+    }
+    struct extremes result = {low[0], high[0], magnitude[0]};
+    for (uintmax_t j = 1; j < LANES; j++) {
+        result.minimum = low[j] < result.minimum ? low[j] : result.minimum;
+        result.maximum = high[j] > result.maximum ? high[j] : result.maximum;
+        result.magnitude = magnitude[j] > result.magnitude
+                           ? magnitude[j] : result.magnitude;
+    }
+    return result;
+}
+
+SEAGRASS_KERNEL
+static struct extremes lanes_minimum(const float *const values,
+                                     const uintmax_t count) {
+    return lanes(values, count, true, false);
+}
+
+SEAGRASS_KERNEL
+static struct extremes lanes_maximum(const float *const values,
+                                     const uintmax_t count) {
+    return lanes(values, count, false, true);
+}
+
+SEAGRASS_KERNEL
+static struct extremes lanes_minmax(const float *const values,
+                                    const uintmax_t count) {
+    return lanes(values, count, true, true);
+}
+
+static uintmax_t find(const float *const values, uintmax_t i,
+                      const int32_t k) {
+    uint32_t magnitude;
+    for (; key(values[i], &magnitude) != k; i++);
+    return i;
+}
+
+/* Returns false if a value is NaN. On success low and high receive the
+ * index of the requested extremes. */
+static bool extremes(const float *const values,
+                     const uintmax_t count,
+                     const bool minimum,
+                     const bool maximum,
+                     uintmax_t *const low,
+                     uintmax_t *const high) {
+    struct extremes result;
+    result.minimum = result.maximum = key(values[0], &result.magnitude);
+    uintmax_t lower = 0;
+    uintmax_t higher = 0;
+    for (uintmax_t i = 0; i < count; i += BLOCK) {
+        const uintmax_t n = count - i < BLOCK ? count - i : BLOCK;
+        const uintmax_t m = n - n % LANES;
+        struct extremes block;
+        block.minimum = block.maximum = key(values[i], &block.magnitude);
+        if (m) {
+            block = minimum
+                    ? maximum
+                      ? lanes_minmax(values + i, m)
+                      : lanes_minimum(values + i, m)
+                    : lanes_maximum(values + i, m);
+        }
+        for (uintmax_t j = m; j < n; j++) {
+            update(&block, values[i + j]);
+        }
+        if (block.minimum < result.minimum) {
+            result.minimum = block.minimum;
+            lower = i;
+        }
+        if (block.maximum > result.maximum) {
+            result.maximum = block.maximum;
+            higher = i;
+        }
+        result.magnitude = block.magnitude > result.magnitude
+                           ? block.magnitude : result.magnitude;
+    }
+    if (result.magnitude > INFINITY_MAGNITUDE) {
+        return false;
+    }
+    if (minimum) {
+        *low = find(values, lower, result.minimum);
+    }
+    if (maximum) {
+        *high = find(values, higher, result.maximum);
+    }
+    return true;
+}
+
+int seagrass_float_minimum_n(const float *const values,
+                             const uintmax_t count,
+                             float *const out,
+                             uintmax_t *const index) {
+    if (!values) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!count) {
+        return SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO;
+    }
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    uintmax_t low;
+    if (!extremes(values, count, true, false, &low, NULL)) {
+        return SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = values[low];
+    if (index) {
+        *index = low;
+    }
+    return 0;
+}
+
+int seagrass_float_maximum_n(const float *const values,
+                             const uintmax_t count,
+                             float *const out,
+                             uintmax_t *const index) {
+    if (!values) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!count) {
+        return SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO;
+    }
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    uintmax_t high;
+    if (!extremes(values, count, false, true, NULL, &high)) {
+        return SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = values[high];
+    if (index) {
+        *index = high;
+    }
+    return 0;
+}
+
+int seagrass_float_minmax_n(const float *const values,
+                            const uintmax_t count,
+                            float *const minimum,
+                            uintmax_t *const minimum_index,
+                            float *const maximum,
+                            uintmax_t *const maximum_index) {
+    if (!values) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!count) {
+        return SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO;
+    }
+    if (!minimum || !maximum) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    uintmax_t low, high;
+    if (!extremes(values, count, true, true, &low, &high)) {
+        return SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *minimum = values[low];
+    *maximum = values[high];
+    if (minimum_index) {
+        *minimum_index = low;
+    }
+    if (maximum_index) {
+        *maximum_index = high;
+    }
+    return 0;
+}
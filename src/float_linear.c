@@ -0,0 +1,203 @@
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "error_bound.h"
+#include "kernel.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* Each kernel runs LANES independent accumulators, which the compiler maps
+ * onto vector registers, as the summation in float_sum.c does. */
+#define LANES 8
+/* Values of axpy updated between checks for non-finite results. */
+#define BLOCK 1024
+
+/* Fused multiply add where the processor provides it. Elsewhere fmaf() is
+ * emulated in software, which is far slower than a multiply and an add. */
+#ifdef FP_FAST_FMAF
+#define MULTIPLY_ADD(a, b, c) fmaf((a), (b), (c))
+#else
+#define MULTIPLY_ADD(a, b, c) ((a) * (b) + (c))
+#endif
+
+/* The remaining values padded with zeros, which leave any dot product
+ * unchanged, so that the lanes are only ever indexed by constants. */
+struct tail {
+    float values[LANES];
+};
+
+static inline struct tail load_tail(const float *const values,
+                                    const uintmax_t count) {
+    struct tail tail = {0};
+    memcpy(tail.values, values, count * sizeof(*values));
+    return tail;
+}
+
+static inline float combine(const float sum[LANES]) {
+    return ((sum[0] + sum[1]) + (sum[2] + sum[3]))
+           + ((sum[4] + sum[5]) + (sum[6] + sum[7]));
+}
+
+SEAGRASS_KERNEL
+static float dot(const float *const a, const float *const b,
+                 const uintmax_t count) {
+    float sum[LANES] = {0};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (unsigned int j = 0; j < LANES; j++) {
+            sum[j] = MULTIPLY_ADD(a[i + j], b[i + j], sum[j]);
+        }
+    }
+    if (i < count) {
+        const struct tail x = load_tail(a + i, count - i);
+        const struct tail y = load_tail(b + i, count - i);
+        for (unsigned int j = 0; j < LANES; j++) {
+            sum[j] = MULTIPLY_ADD(x.values[j], y.values[j], sum[j]);
+        }
+    }
+    return combine(sum);
+}
+
+/* The dot product of the absolute values, with the absolute value taken of
+ * each product, which is exact, as GCC keeps the lanes in memory when it is
+ * taken of the operands instead. */
+SEAGRASS_KERNEL
+static float dot_magnitude(const float *const a, const float *const b,
+                           const uintmax_t count) {
+    float sum[LANES] = {0};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (unsigned int j = 0; j < LANES; j++) {
+            sum[j] += fabsf(a[i + j] * b[i + j]);
+        }
+    }
+    if (i < count) {
+        const struct tail x = load_tail(a + i, count - i);
+        const struct tail y = load_tail(b + i, count - i);
+        for (unsigned int j = 0; j < LANES; j++) {
+            sum[j] += fabsf(x.values[j] * y.values[j]);
+        }
+    }
+    return combine(sum);
+}
+
+/* Computes the results into out and returns zero if every one of them is
+ * finite and NaN otherwise, as the product of zero and a non-finite value is
+ * NaN. */
+SEAGRASS_KERNEL
+static float axpy(const float alpha, const float *const x,
+                  const float *const y, const uintmax_t count,
+                  float *const out) {
+    float check[LANES] = {0};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        float result[LANES];
+        for (unsigned int j = 0; j < LANES; j++) {
+            result[j] = MULTIPLY_ADD(alpha, x[i + j], y[i + j]);
+            check[j] += result[j] * 0;
+        }
+        memcpy(out + i, result, sizeof(result));
+    }
+    float tail = 0;
+    for (; i < count; i++) {
+        const float result = MULTIPLY_ADD(alpha, x[i], y[i]);
+        out[i] = result;
+        tail += result * 0;
+    }
+    return combine(check) + tail;
+}
+
+int seagrass_float_dot(const float *const a,
+                       const float *const b,
+                       const uintmax_t count,
+                       float *const out,
+                       float *const error) {
+    if ((!a || !b) && count) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    const float result = dot(a, b, count);
+    /* an overflow or a non-finite value makes the result non-finite */
+    if (!isfinite(result)) {
+        return SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = result;
+    if (error) {
+        /* Higham, Accuracy and Stability of Numerical Algorithms, 3.1, with
+         * the longest chain of operations being a multiplication and an
+         * addition per value of a lane followed by the combination of the
+         * lanes, which is counted twice over when fused */
+        const double factor = seagrass_error_factor(
+                2 * ((double) (count / LANES) + 1) + 3, SEAGRASS_FLOAT_U);
+        const double magnitude = dot_magnitude(a, b, count);
+        *error = seagrass_round_up(
+                factor * seagrass_upper_magnitude(magnitude, factor));
+    }
+    return 0;
+}
+
+int seagrass_float_axpy(const float alpha,
+                        const float *const x,
+                        const uintmax_t count,
+                        float *const y,
+                        uintmax_t *const index) {
+    if ((!x || !y) && count) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    /* a block is only stored once its results are known to be finite, so
+     * that the elements after a failing one are left unchanged */
+    float result[BLOCK];
+    for (uintmax_t i = 0; i < count; i += BLOCK) {
+        const uintmax_t n = count - i < BLOCK ? count - i : BLOCK;
+        if (!axpy(alpha, x + i, y + i, n, result)) {
+            memcpy(y + i, result, n * sizeof(float));
+            continue;
+        }
+        uintmax_t j = 0;
+        for (; isfinite(result[j]); j++);
+        memcpy(y + i, result, j * sizeof(float));
+        if (index) {
+            *index = i + j;
+        }
+        return SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    return 0;
+}
+
+int seagrass_float_gemv(const float alpha,
+                        const float *const matrix,
+                        const uintmax_t rows,
+                        const uintmax_t columns,
+                        const float *const x,
+                        const float beta,
+                        float *const y,
+                        uintmax_t *const index) {
+    if ((!matrix && rows && columns) || (!x && columns)) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!y && rows) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    for (uintmax_t i = 0; i < rows; i++) {
+        const float product = alpha * dot(matrix + i * columns, x, columns);
+        /* y is not read when beta is zero so that it may be uninitialized */
+        const float result = beta
+                             ? MULTIPLY_ADD(beta, y[i], product)
+                             : product;
+        if (!isfinite(result)) {
+            if (index) {
+                *index = i;
+            }
+            return SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+        }
+        y[i] = result;
+    }
+    return 0;
+}
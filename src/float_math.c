@@ -0,0 +1,486 @@
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "kernel.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* Values computed into a buffer between checks. A block with an invalid
+ * value is searched for the first one and only the values before it are
+ * copied out, so that out may be the same array as the arguments. */
+#define BLOCK 1024
+#define LANES 8
+/* Largest float whose exponential is finite. */
+#define EXP_MAXIMUM 0x1.62e42ep6f
+/* Below it the exponential rounds to zero. */
+#define EXP_MINIMUM (-104.0f)
+/* Adding and subtracting it rounds a float or a double to an integer. */
+#define ROUND_FLOAT 0x1.8p23f
+#define ROUND_DOUBLE 0x1.8p52
+#define LN2 0.69314718055994530942
+#define LOG2E 1.4426950408889634074
+#define SQRT1_2 0.70710678118654752440
+
+static inline uint32_t bits_of(const float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline float float_of(const uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline uint64_t bits_of_double(const double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline double double_of(const uint64_t bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/* Selects between the bits of two floats, as GCC turns the selection of a
+ * float into a branch that it then no longer vectorizes. */
+static inline float choose(const bool condition, const float a,
+                           const float b) {
+    const uint32_t mask = -(uint32_t) condition;
+    return float_of((bits_of(a) & mask) | (bits_of(b) & ~mask));
+}
+
+/* Integers are exact in float from 2^23 on. Below it the conversion to
+ * int32_t truncates. */
+static inline bool is_integer(const float value) {
+    const float magnitude = fabsf(value);
+    const float small = choose(magnitude < 0x1p23f, magnitude, 0);
+    return (float) (int32_t) small == small;
+}
+
+static inline bool is_odd(const float value) {
+    const float magnitude = fabsf(value);
+    const float small = choose(magnitude < 0x1p24f, magnitude, 0);
+    return is_integer(value) & ((int32_t) small & 1);
+}
+
+/* The domain of each function as a predicate, shared by the kernels and the
+ * scalar checks so that both agree on which values fail. NaN fails every
+ * comparison. */
+
+static inline bool sqrt_is_valid(const float a) {
+    return (a >= 0) & (a <= FLT_MAX);
+}
+
+static inline bool log_is_valid(const float a) {
+    return (a > 0) & (a <= FLT_MAX);
+}
+
+static inline bool exp_is_valid(const float a) {
+    return (a >= -FLT_MAX) & (a <= EXP_MAXIMUM);
+}
+
+static inline bool pow_is_valid(const float a, const float b) {
+    return (fabsf(a) <= FLT_MAX) & (fabsf(b) <= FLT_MAX)
+           & !((a == 0) & (b < 0))
+           & !((a < 0) & !is_integer(b));
+}
+
+static int check_sqrt(const float a) {
+    if (sqrt_is_valid(a)) {
+        return 0;
+    }
+    if (!isfinite(a)) {
+        return SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID;
+    }
+    return SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE;
+}
+
+static int check_log(const float a) {
+    if (log_is_valid(a)) {
+        return 0;
+    }
+    if (!isfinite(a)) {
+        return SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID;
+    }
+    if (!a) {
+        return SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO;
+    }
+    return SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE;
+}
+
+static int check_exp(const float a) {
+    if (exp_is_valid(a)) {
+        return 0;
+    }
+    if (!isfinite(a)) {
+        return SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID;
+    }
+    return SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+}
+
+static int check_pow(const float a, const float b) {
+    if (pow_is_valid(a, b)) {
+        return 0;
+    }
+    if (!isfinite(a) || !isfinite(b)) {
+        return SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID;
+    }
+    if (!a) {
+        return SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO;
+    }
+    return SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE;
+}
+
+/* The lanes compute one value each, with a value outside of the domain
+ * replaced so that no lane raises errno or converts an out of range float
+ * to an integer, and mark whether it was invalid. Conditions only select
+ * between bits, as the compiler does not vectorize floating point
+ * operations that are performed conditionally. */
+
+SEAGRASS_LANE float sqrt_lane(const float a, uint32_t *const invalid) {
+    const bool valid = sqrt_is_valid(a);
+    *invalid |= !valid;
+    /* an invalid value is replaced by +0.0 */
+    return sqrtf(float_of(bits_of(a) & -(uint32_t) valid));
+}
+
+/* Split a positive finite value into m * 2^e with m within
+ * [sqrt(1/2), sqrt(2)), as in the Cephes library, returning m - 1. */
+SEAGRASS_LANE float reduce(const float value, int32_t *const exponent) {
+    const bool subnormal = value < FLT_MIN;
+    /* multiplied by 2^23 if subnormal, as an exponent added to 1.0 */
+    const uint32_t bits = bits_of(value * float_of(
+            UINT32_C(0x3f800000) + ((uint32_t) subnormal * (23 << 23))));
+    /* the mantissa within [1/2, 1) */
+    const float m = float_of((bits & 0x007fffff) | 0x3f000000);
+    const bool low = m < (float) SQRT1_2;
+    *exponent = (int32_t) (bits >> 23) - 126 - 23 * subnormal - low;
+    /* doubled if low, again as an exponent */
+    return float_of(bits_of(m) + ((uint32_t) low << 23)) - 1;
+}
+
+/* Cephes logf, with the logarithm of two split into 0.693359375, exact in
+ * float, and a correction. */
+SEAGRASS_LANE float log_lane(const float a, uint32_t *const invalid) {
+    const bool valid = log_is_valid(a);
+    *invalid |= !valid;
+    int32_t exponent;
+    const float x = reduce(choose(valid, a, 1), &exponent);
+    const float e = (float) exponent;
+    const float z = x * x;
+    /* the polynomial by Estrin's scheme rather than Horner's, which halves
+     * the chain of dependent operations that bounds the throughput */
+    const float z2 = z * z;
+    const float p01 = 3.3333331174e-1f + x * -2.4999993993e-1f;
+    const float p23 = 2.0000714765e-1f + x * -1.6668057665e-1f;
+    const float p45 = 1.4249322787e-1f + x * -1.2420140846e-1f;
+    const float p67 = 1.1676998740e-1f + x * -1.1514610310e-1f;
+    const float p = (p01 + z * p23)
+                    + z2 * ((p45 + z * p67) + z2 * 7.0376836292e-2f);
+    float y = p * x * z;
+    y += e * -2.12194440e-4f;
+    y -= 0.5f * z;
+    return (x + y) + e * 0.693359375f;
+}
+
+/* 2^n for n within [-150, 128] as the product of two floats, as 2^n itself
+ * is not a normal float at either end. */
+SEAGRASS_LANE float scale(const float value, const int32_t n) {
+    const int32_t half = n / 2;
+    return value * float_of((uint32_t) (half + 127) << 23)
+           * float_of((uint32_t) (n - half + 127) << 23);
+}
+
+/* Cephes expf, reducing by the nearest multiple of the logarithm of two. */
+SEAGRASS_LANE float exp_lane(const float a, uint32_t *const invalid) {
+    const bool valid = exp_is_valid(a);
+    *invalid |= !valid;
+    float x = choose(valid, a, 0);
+    x = choose(x > EXP_MINIMUM, x, EXP_MINIMUM);
+    const float n = (x * (float) LOG2E + ROUND_FLOAT) - ROUND_FLOAT;
+    x -= n * 0.693359375f;
+    x -= n * -2.12194440e-4f;
+    const float z = x * x;
+    float p = 1.9875691500e-4f;
+    p = p * x + 1.3981999507e-3f;
+    p = p * x + 8.3334519073e-3f;
+    p = p * x + 4.1665795894e-2f;
+    p = p * x + 1.6666665459e-1f;
+    p = p * x + 5.0000001201e-1f;
+    p = p * z + x + 1;
+    return scale(p, (int32_t) n);
+}
+
+/* a^b as exp(b * log(a)) in double, which keeps the error of the logarithm,
+ * scaled by b, well below that of rounding the result to float. */
+SEAGRASS_LANE float pow_lane(const float a, const float b,
+                             uint32_t *const invalid) {
+    const bool valid = pow_is_valid(a, b);
+    const float power = choose(valid, b, 1);
+    /* zero and invalid bases are replaced by 1 and fixed up at the end */
+    const bool zero = a == 0;
+    /* Split into m * 2^e in double, where every float is normal, with the
+     * exponent converted through the bits of 2^52 + e, as there is no
+     * conversion from a 64 bit integer to double before AVX-512. */
+    const uint64_t bits = bits_of_double(choose(valid & !zero, fabsf(a), 1));
+    const uint64_t mantissa = bits & UINT64_C(0x000fffffffffffff);
+    /* whether m is below sqrt(1/2), by the carry into bit 52, as there is no
+     * comparison of 64 bit integers before SSE4.2 */
+    const uint64_t low = 1 ^ ((mantissa + (UINT64_C(0x0010000000000000)
+                                           - UINT64_C(0x0006a09e667f3bcd)))
+                              >> 52);
+    const double exponent = double_of(UINT64_C(0x4330000000000000)
+                                      | ((bits >> 52) - low))
+                            - (0x1p52 + 1022);
+    const double x = double_of(mantissa | ((1022 + low) << 52)) - 1;
+    /* log(1 + x) as 2 atanh(s) */
+    const double s = x / (x + 2);
+    const double s2 = s * s;
+    const double s4 = s2 * s2;
+    /* truncated after s^14, as the remainder is below 2^-41 relative */
+    const double p = (1 + s2 * (1.0 / 3)) + s4 * (1.0 / 5 + s2 * (1.0 / 7))
+                     + s4 * s4 * ((1.0 / 9 + s2 * (1.0 / 11))
+                                  + s4 * (1.0 / 13 + s2 * (1.0 / 15)));
+    double y = power * (exponent * LN2 + 2 * s * p);
+    /* beyond it the result overflows or rounds to zero */
+    y = fabs(y) < 110 ? y : copysign(110, y);
+    /* the low bits of the rounded value hold n, as there is no conversion
+     * from double to a 64 bit integer before AVX-512 */
+    const double rounded = y * LOG2E + ROUND_DOUBLE;
+    const double n = rounded - ROUND_DOUBLE;
+    /* the logarithm of two split as in fdlibm */
+    const double r = (y - n * 6.93147180369123816490e-01)
+                     - n * 1.90821492927058770002e-10;
+    /* truncated after r^8, as the remainder is below 2^-31 relative */
+    const double r2 = r * r;
+    const double r4 = r2 * r2;
+    const double q = (1 + r) + r2 * (0.5 + r * (1.0 / 6))
+                     + r4 * ((1.0 / 24 + r * (1.0 / 120))
+                             + r2 * (1.0 / 720 + r * (1.0 / 5040))
+                             + r4 * (1.0 / 40320));
+    const float result = (float) (q * double_of(
+            (bits_of_double(rounded) + 1023) << 52));
+    /* zero to a positive power is +0.0, and a negative base to an odd power
+     * negative, including -0.0 */
+    const uint32_t sign = (bits_of(a) >> 31) & is_odd(power);
+    const float magnitude = choose(zero & (power > 0), 0, result);
+    *invalid |= !valid | !(magnitude <= FLT_MAX);
+    return float_of(bits_of(magnitude) | sign << 31);
+}
+
+/* The exponential and the power use the lanes rather than expf() and
+ * powf(), which report overflow and underflow through errno. */
+
+int seagrass_float_sqrt(const float a, float *const out) {
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    const int error = check_sqrt(a);
+    if (error) {
+        return error;
+    }
+    *out = sqrtf(a);
+    return 0;
+}
+
+int seagrass_float_log(const float a, float *const out) {
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    const int error = check_log(a);
+    if (error) {
+        return error;
+    }
+    *out = logf(a);
+    return 0;
+}
+
+int seagrass_float_exp(const float a, float *const out) {
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    const int error = check_exp(a);
+    if (error) {
+        return error;
+    }
+    uint32_t invalid = 0;
+    *out = exp_lane(a, &invalid);
+    return 0;
+}
+
+int seagrass_float_pow(const float a, const float b, float *const out) {
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    const int error = check_pow(a, b);
+    if (error) {
+        return error;
+    }
+    uint32_t invalid = 0;
+    const float result = pow_lane(a, b, &invalid);
+    if (invalid) {
+        return SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = result;
+    return 0;
+}
+
+static inline bool any(const uint32_t *const invalid) {
+    uint32_t result = 0;
+    for (unsigned int j = 0; j < LANES; j++) {
+        result |= invalid[j];
+    }
+    return result;
+}
+
+/* Define a kernel applying a lane to each value, out may overlap a. The lane
+ * is called by name, as GCC does not inline an always_inline lane passed by
+ * pointer before constant propagation, which -O1 does not run. */
+#define UNARY_KERNEL(name, lane) \
+    SEAGRASS_KERNEL \
+    static bool name(const float *const a, const uintmax_t count, \
+                     float *const out) { \
+        uint32_t invalid[LANES] = {0}; \
+        uintmax_t i = 0; \
+        for (; i + LANES <= count; i += LANES) { \
+            float result[LANES]; \
+            for (unsigned int j = 0; j < LANES; j++) { \
+                result[j] = lane(a[i + j], &invalid[j]); \
+            } \
+            memcpy(out + i, result, sizeof(result)); \
+        } \
+        for (; i < count; i++) { \
+            out[i] = lane(a[i], &invalid[0]); \
+        } \
+        return any(invalid); \
+    }
+
+UNARY_KERNEL(sqrt_kernel, sqrt_lane)
+UNARY_KERNEL(log_kernel, log_lane)
+UNARY_KERNEL(exp_kernel, exp_lane)
+
+SEAGRASS_KERNEL
+static bool pow_kernel(const float *const a, const float *const b,
+                       const uintmax_t count, float *const out) {
+    uint32_t invalid[LANES] = {0};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        float result[LANES];
+        for (unsigned int j = 0; j < LANES; j++) {
+            result[j] = pow_lane(a[i + j], b[i + j], &invalid[j]);
+        }
+        memcpy(out + i, result, sizeof(result));
+    }
+    for (; i < count; i++) {
+        out[i] = pow_lane(a[i], b[i], &invalid[0]);
+    }
+    return any(invalid);
+}
+
+/* Only the first failing value of a block is searched for, and only the
+ * values before it are copied out. */
+static int failed(const float *const result, const float *const a,
+                  const float *const b, const uintmax_t offset,
+                  int (*const check)(float, float),
+                  float *const out, uintmax_t *const index) {
+    uintmax_t j = 0;
+    int error = 0;
+    for (; !(error = check(a[j], b ? b[j] : 0))
+           && fabsf(result[j]) <= FLT_MAX; j++);
+    memcpy(out, result, j * sizeof(*out));
+    if (index) {
+        *index = offset + j;
+    }
+    return error ? error : SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+}
+
+static int check_sqrt_unary(const float a, const float b) {
+    (void) b;
+    return check_sqrt(a);
+}
+
+static int check_log_unary(const float a, const float b) {
+    (void) b;
+    return check_log(a);
+}
+
+static int check_exp_unary(const float a, const float b) {
+    (void) b;
+    return check_exp(a);
+}
+
+static int unary_n(const float *const values, const uintmax_t count,
+                   bool (*const kernel)(const float *, uintmax_t, float *),
+                   int (*const check)(float, float),
+                   float *const out, uintmax_t *const index) {
+    if (!values && count) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!out && count) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    float result[BLOCK];
+    for (uintmax_t i = 0; i < count; i += BLOCK) {
+        const uintmax_t n = count - i < BLOCK ? count - i : BLOCK;
+        if (kernel(values + i, n, result)) {
+            return failed(result, values + i, NULL, i, check, out + i,
+                          index);
+        }
+        memcpy(out + i, result, n * sizeof(*out));
+    }
+    return 0;
+}
+
+int seagrass_float_sqrt_n(const float *const values,
+                          const uintmax_t count,
+                          float *const out,
+                          uintmax_t *const index) {
+    return unary_n(values, count, sqrt_kernel, check_sqrt_unary, out,
+                   index);
+}
+
+int seagrass_float_log_n(const float *const values,
+                         const uintmax_t count,
+                         float *const out,
+                         uintmax_t *const index) {
+    return unary_n(values, count, log_kernel, check_log_unary, out, index);
+}
+
+int seagrass_float_exp_n(const float *const values,
+                         const uintmax_t count,
+                         float *const out,
+                         uintmax_t *const index) {
+    return unary_n(values, count, exp_kernel, check_exp_unary, out, index);
+}
+
+int seagrass_float_pow_n(const float *const a,
+                         const float *const b,
+                         const uintmax_t count,
+                         float *const out,
+                         uintmax_t *const index) {
+    if ((!a || !b) && count) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!out && count) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    float result[BLOCK];
+    for (uintmax_t i = 0; i < count; i += BLOCK) {
+        const uintmax_t n = count - i < BLOCK ? count - i : BLOCK;
+        if (pow_kernel(a + i, b + i, n, result)) {
+            return failed(result, a + i, b + i, i, check_pow, out + i,
+                          index);
+        }
+        memcpy(out + i, result, n * sizeof(*out));
+    }
+    return 0;
+}
@@ -0,0 +1,246 @@
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "error_bound.h"
+#include "kernel.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* Each algorithm runs LANES independent accumulators, which the compiler
+ * maps onto vector registers, and combines them at the end. Within a lane
+ * the operations happen in the same order as the scalar algorithm so the
+ * error analysis remains valid without reassociation. */
+#define LANES 8
+#define PAIRWISE_BLOCK 128
+
+/* The remaining values padded with zeros, which leave any sum unchanged, so
+ * that the lanes are only ever indexed by constants and stay in registers. */
+struct tail {
+    float values[LANES];
+};
+
+static inline struct tail load_tail(const float *const values,
+                                    const uintmax_t count) {
+    struct tail tail = {0};
+    memcpy(tail.values, values, count * sizeof(*values));
+    return tail;
+}
+
+/* Knuth's branch free TwoSum. It yields the same error term as the branch in
+ * Neumaier's algorithm, which keeps the loop free of selects. */
+static inline float two_sum(float *const sum, const float x) {
+    const float t = *sum + x;
+    const float z = t - *sum;
+    const float error = (*sum - (t - z)) + (x - z);
+    *sum = t;
+    return error;
+}
+
+SEAGRASS_KERNEL
+static float compensated(const float *const values, const uintmax_t count,
+                         double *const bound) {
+    float sum[LANES] = {0};
+    float compensation[LANES] = {0};
+    float absolute[LANES] = {0};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (unsigned int j = 0; j < LANES; j++) {
+            const float x = values[i + j];
+            compensation[j] += two_sum(&sum[j], x);
+            absolute[j] += fabsf(x);
+        }
+    }
+    if (i < count) {
+        const struct tail tail = load_tail(values + i, count - i);
+        for (unsigned int j = 0; j < LANES; j++) {
+            const float x = tail.values[j];
+            compensation[j] += two_sum(&sum[j], x);
+            absolute[j] += fabsf(x);
+        }
+    }
+    float s = 0;
+    float c = 0;
+    float a = 0;
+    for (unsigned int j = 0; j < LANES; j++) {
+        c += two_sum(&s, sum[j]);
+        c += compensation[j];
+        a += absolute[j];
+    }
+    const float result = s + c;
+    /* Ogita, Rump and Oishi, Accurate Sum and Dot Product, Proposition 4.5,
+     * where the longest chain of additions is the one within a lane followed
+     * by the combination of the lanes */
+    const double factor = seagrass_error_factor(
+            (double) (count / LANES) + 2 * LANES, SEAGRASS_FLOAT_U);
+    const double magnitude = seagrass_upper_magnitude(a, factor);
+    *bound = (SEAGRASS_FLOAT_U * fabsf(result) + factor * factor * magnitude)
+             / (1 - SEAGRASS_FLOAT_U);
+    return result;
+}
+
+struct pairwise {
+    float sum;
+    float magnitude;
+};
+
+/* The sum and the magnitude are separate loops, as GCC does not keep two
+ * independent sets of lanes in registers within one loop. */
+SEAGRASS_KERNEL
+static float pairwise_block(const float *const values,
+                            const uintmax_t count,
+                            const bool magnitude) {
+    float sum[LANES] = {0};
+    uintmax_t i = 0;
+    if (magnitude) {
+        for (; i + LANES <= count; i += LANES) {
+            for (unsigned int j = 0; j < LANES; j++) {
+                sum[j] += fabsf(values[i + j]);
+            }
+        }
+    } else {
+        for (; i + LANES <= count; i += LANES) {
+            for (unsigned int j = 0; j < LANES; j++) {
+                sum[j] += values[i + j];
+            }
+        }
+    }
+    if (i < count) {
+        const struct tail tail = load_tail(values + i, count - i);
+        for (unsigned int j = 0; j < LANES; j++) {
+            sum[j] += magnitude ? fabsf(tail.values[j]) : tail.values[j];
+        }
+    }
+    return ((sum[0] + sum[1]) + (sum[2] + sum[3]))
+           + ((sum[4] + sum[5]) + (sum[6] + sum[7]));
+}
+
+static float pairwise(const float *const values, const uintmax_t count,
+                      double *const bound) {
+    /* Combine the block sums iteratively like a binary counter, where
+     * stack[k] holds the sum of 2^k blocks, instead of recursing. */
+    struct pairwise stack[64];
+    unsigned int depth = 0;
+    uintmax_t blocks = 0;
+    for (uintmax_t i = 0; i < count; i += PAIRWISE_BLOCK, blocks++) {
+        const uintmax_t n = count - i < PAIRWISE_BLOCK
+                            ? count - i : PAIRWISE_BLOCK;
+        struct pairwise block = {
+                .sum = pairwise_block(values + i, n, false),
+                .magnitude = pairwise_block(values + i, n, true)
+        };
+        for (uintmax_t k = blocks; k & 1; k >>= 1) {
+            depth--;
+            block.sum = stack[depth].sum + block.sum;
+            block.magnitude = stack[depth].magnitude + block.magnitude;
+        }
+        stack[depth++] = block;
+    }
+    struct pairwise result = {0};
+    while (depth) {
+        depth--;
+        result.sum = stack[depth].sum + result.sum;
+        result.magnitude = stack[depth].magnitude + result.magnitude;
+    }
+    /* longest chain of additions: the lane sums, the lane tree and then at
+     * most two additions per level of the counter */
+    double levels = 0;
+    for (uintmax_t n = blocks; n > 1; n = (n + 1) / 2) {
+        levels += 1;
+    }
+    const double factor = seagrass_error_factor(
+            (double) PAIRWISE_BLOCK / LANES + 3 + 2 * levels, SEAGRASS_FLOAT_U);
+    /* the magnitude was summed in the same order, see Higham, Accuracy and
+     * Stability of Numerical Algorithms, 4.2 */
+    *bound = factor * seagrass_upper_magnitude(result.magnitude, factor);
+    return result.sum;
+}
+
+SEAGRASS_KERNEL
+static float widened(const float *const values, const uintmax_t count,
+                     double *const bound) {
+    double sum[LANES] = {0};
+    double absolute[LANES] = {0};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (unsigned int j = 0; j < LANES; j++) {
+            sum[j] += values[i + j];
+            absolute[j] += fabsf(values[i + j]);
+        }
+    }
+    if (i < count) {
+        const struct tail tail = load_tail(values + i, count - i);
+        for (unsigned int j = 0; j < LANES; j++) {
+            sum[j] += tail.values[j];
+            absolute[j] += fabsf(tail.values[j]);
+        }
+    }
+    double s = 0;
+    double a = 0;
+    for (unsigned int j = 0; j < LANES; j++) {
+        s += sum[j];
+        a += absolute[j];
+    }
+    /* double accumulation and then a single rounding to float */
+    *bound = seagrass_error_factor((double) count + LANES, SEAGRASS_DOUBLE_U)
+             * a + SEAGRASS_FLOAT_U * fabs(s);
+    return (float) s;
+}
+
+int seagrass_float_sum_n(const float *const values,
+                         const uintmax_t count,
+                         const enum seagrass_float_summation summation,
+                         float *const out,
+                         float *const error) {
+    if (!values && count) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    float (*kernel)(const float *, uintmax_t, double *);
+    switch (summation & ~SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS) {
+        default: {
+            return SEAGRASS_FLOAT_ERROR_SUMMATION_IS_INVALID;
+        }
+        case SEAGRASS_FLOAT_SUMMATION_COMPENSATED: {
+            kernel = compensated;
+            break;
+        }
+        case SEAGRASS_FLOAT_SUMMATION_PAIRWISE: {
+            kernel = pairwise;
+            break;
+        }
+        case SEAGRASS_FLOAT_SUMMATION_DOUBLE: {
+            kernel = widened;
+            break;
+        }
+    }
+    double bound;
+    float result;
+    if (summation & SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS) {
+        struct seagrass_float_fast_denormals scope;
+        seagrass_required_true(!seagrass_float_fast_denormals_begin(&scope));
+        result = kernel(values, count, &bound);
+        seagrass_required_true(!seagrass_float_fast_denormals_end(&scope));
+        /* Every operation of a kernel may flush an operand or a result below
+         * FLT_MIN to zero. A kernel performs at most eight of them per value
+         * and per lane, each with a coefficient of one in the sum. */
+        bound += 8 * ((double) count + 2 * LANES) * FLT_MIN;
+    } else {
+        result = kernel(values, count, &bound);
+    }
+    /* a non-finite value makes the sum non-finite as well */
+    if (!isfinite(result)) {
+        return SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = result;
+    if (error) {
+        *error = seagrass_round_up(bound);
+    }
+    return 0;
+}
@@ -0,0 +1,280 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <seagrass.h>
+
+#include "bits.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define BITS 64
+
+/* The predicates below combine their conditions with bitwise operators
+ * rather than branches so that the array loops map onto vector compares. */
+
+static inline bool equal_absolute(const float a, const float b,
+                                  const float epsilon) {
+    return (a == b) | (fabsf(a - b) <= epsilon);
+}
+
+static inline bool equal_relative(const float a, const float b,
+                                  const float epsilon) {
+    const float A = fabsf(a);
+    const float B = fabsf(b);
+    const float magnitude = A > B ? A : B;
+    /* An infinite magnitude would scale epsilon into infinity as well, so
+     * infinities are only ever equal to themselves. */
+    return (a == b)
+           | ((magnitude <= FLT_MAX) & (fabsf(a - b) <= epsilon * magnitude));
+}
+
+/* Map the sign-magnitude float bits onto two's complement integers so that
+ * adjacent floats are adjacent integers and -0.0 maps onto +0.0. */
+static inline int64_t ordered(const float a) {
+    uint32_t i;
+    memcpy(&i, &a, sizeof(i));
+    const uint32_t sign = -(i >> 31);
+    const uint32_t magnitude = i & UINT32_C(0x7fffffff);
+    return (int32_t) ((magnitude ^ sign) - sign);
+}
+
+static inline bool equal_ulp(const float a, const float b,
+                             const uint32_t ulps) {
+    const int64_t distance = ordered(a) - ordered(b);
+    /* The infinities sit right next to FLT_MAX in the ordering, so only
+     * finite values are counted in ulps, which also excludes NaN. */
+    return (a == b)
+           | ((fabsf(a) <= FLT_MAX) & (fabsf(b) <= FLT_MAX)
+              & (distance <= (int64_t) ulps) & (distance >= -(int64_t) ulps));
+}
+
+#define EQUAL_ABSOLUTE(a, b) \
+    equal_absolute((a), (b), object->epsilon)
+#define EQUAL_RELATIVE(a, b) \
+    equal_relative((a), (b), object->epsilon)
+#define EQUAL_ULP(a, b) \
+    equal_ulp((a), (b), object->ulps)
+#define LESS_ABSOLUTE(a, b) \
+    (((a) < (b)) & !EQUAL_ABSOLUTE(a, b))
+#define LESS_RELATIVE(a, b) \
+    (((a) < (b)) & !EQUAL_RELATIVE(a, b))
+#define LESS_ULP(a, b) \
+    (((a) < (b)) & !EQUAL_ULP(a, b))
+#define GREATER_ABSOLUTE(a, b) \
+    (((a) > (b)) & !EQUAL_ABSOLUTE(a, b))
+#define GREATER_RELATIVE(a, b) \
+    (((a) > (b)) & !EQUAL_RELATIVE(a, b))
+#define GREATER_ULP(a, b) \
+    (((a) > (b)) & !EQUAL_ULP(a, b))
+
+#define DISPATCH(MODE, ABSOLUTE, RELATIVE, ULP) \
+    switch (MODE) { \
+        default: { \
+            seagrass_required_true(false); \
+            break; \
+        } \
+        case SEAGRASS_FLOAT_TOLERANCE_MODE_ABSOLUTE: { \
+            ABSOLUTE; \
+            break; \
+        } \
+        case SEAGRASS_FLOAT_TOLERANCE_MODE_RELATIVE: { \
+            RELATIVE; \
+            break; \
+        } \
+        case SEAGRASS_FLOAT_TOLERANCE_MODE_ULP: { \
+            ULP; \
+            break; \
+        } \
+    }
+
+/* Evaluate the predicate into a block of bytes first, which vectorizes as
+ * plain compares, and then gather one bit per byte into the word. */
+#define PACK(PREDICATE) \
+    do { \
+        uint64_t *word = out; \
+        for (uintmax_t i = 0; i < count; i += BITS, word++) { \
+            uint8_t lanes[BITS] = {0}; \
+            const uintmax_t n = count - i < BITS ? count - i : BITS; \
+            for (uintmax_t j = 0; j < n; j++) { \
+                lanes[j] = PREDICATE(a[i + j], b[i + j]); \
+            } \
+            *word = seagrass_bits_gather(lanes); \
+        } \
+    } while (0)
+
+static bool is_valid_epsilon(const float epsilon) {
+    return isfinite(epsilon) && epsilon >= 0;
+}
+
+int seagrass_float_tolerance_init_absolute(
+        struct seagrass_float_tolerance *const object,
+        const float epsilon) {
+    if (!object) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL;
+    }
+    if (!is_valid_epsilon(epsilon)) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUE_IS_INVALID;
+    }
+    *object = (struct seagrass_float_tolerance) {
+            .mode = SEAGRASS_FLOAT_TOLERANCE_MODE_ABSOLUTE,
+            .epsilon = epsilon
+    };
+    return 0;
+}
+
+int seagrass_float_tolerance_init_relative(
+        struct seagrass_float_tolerance *const object,
+        const float epsilon) {
+    if (!object) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL;
+    }
+    if (!is_valid_epsilon(epsilon)) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUE_IS_INVALID;
+    }
+    *object = (struct seagrass_float_tolerance) {
+            .mode = SEAGRASS_FLOAT_TOLERANCE_MODE_RELATIVE,
+            .epsilon = epsilon
+    };
+    return 0;
+}
+
+int seagrass_float_tolerance_init_ulp(
+        struct seagrass_float_tolerance *const object,
+        const uint32_t ulps) {
+    if (!object) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL;
+    }
+    *object = (struct seagrass_float_tolerance) {
+            .mode = SEAGRASS_FLOAT_TOLERANCE_MODE_ULP,
+            .ulps = ulps
+    };
+    return 0;
+}
+
+int seagrass_float_tolerance_is_equal(
+        const struct seagrass_float_tolerance *const object,
+        const float a,
+        const float b,
+        bool *const out) {
+    if (!object) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL;
+    }
+    DISPATCH(object->mode,
+             *out = EQUAL_ABSOLUTE(a, b),
+             *out = EQUAL_RELATIVE(a, b),
+             *out = EQUAL_ULP(a, b))
+    return 0;
+}
+
+int seagrass_float_tolerance_is_less_than(
+        const struct seagrass_float_tolerance *const object,
+        const float a,
+        const float b,
+        bool *const out) {
+    if (!object) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL;
+    }
+    DISPATCH(object->mode,
+             *out = LESS_ABSOLUTE(a, b),
+             *out = LESS_RELATIVE(a, b),
+             *out = LESS_ULP(a, b))
+    return 0;
+}
+
+int seagrass_float_tolerance_is_greater_than(
+        const struct seagrass_float_tolerance *const object,
+        const float a,
+        const float b,
+        bool *const out) {
+    if (!object) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL;
+    }
+    DISPATCH(object->mode,
+             *out = GREATER_ABSOLUTE(a, b),
+             *out = GREATER_RELATIVE(a, b),
+             *out = GREATER_ULP(a, b))
+    return 0;
+}
+
+static int check_n(const struct seagrass_float_tolerance *const object,
+                   const float *const a,
+                   const float *const b,
+                   const uintmax_t count,
+                   const uint64_t *const out) {
+    if (!object) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL;
+    }
+    if (!count) {
+        return 0;
+    }
+    if (!a || !b) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL;
+    }
+    return 0;
+}
+
+int seagrass_float_tolerance_is_equal_n(
+        const struct seagrass_float_tolerance *const object,
+        const float *const a,
+        const float *const b,
+        const uintmax_t count,
+        uint64_t *const out) {
+    const int error = check_n(object, a, b, count, out);
+    if (error) {
+        return error;
+    }
+    DISPATCH(object->mode,
+             PACK(EQUAL_ABSOLUTE),
+             PACK(EQUAL_RELATIVE),
+             PACK(EQUAL_ULP))
+    return 0;
+}
+
+int seagrass_float_tolerance_is_less_than_n(
+        const struct seagrass_float_tolerance *const object,
+        const float *const a,
+        const float *const b,
+        const uintmax_t count,
+        uint64_t *const out) {
+    const int error = check_n(object, a, b, count, out);
+    if (error) {
+        return error;
+    }
+    DISPATCH(object->mode,
+             PACK(LESS_ABSOLUTE),
+             PACK(LESS_RELATIVE),
+             PACK(LESS_ULP))
+    return 0;
+}
+
+int seagrass_float_tolerance_is_greater_than_n(
+        const struct seagrass_float_tolerance *const object,
+        const float *const a,
+        const float *const b,
+        const uintmax_t count,
+        uint64_t *const out) {
+    const int error = check_n(object, a, b, count, out);
+    if (error) {
+        return error;
+    }
+    DISPATCH(object->mode,
+             PACK(GREATER_ABSOLUTE),
+             PACK(GREATER_RELATIVE),
+             PACK(GREATER_ULP))
+    return 0;
+}
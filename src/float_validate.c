@@ -0,0 +1,163 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "bits.h"
+#include "kernel.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define BITS 64
+#define LANES 16
+/* Values checked between searches for the first invalid one. */
+#define BLOCK 1024
+/* Magnitudes above that of infinity are NaN. */
+#define INFINITY_MAGNITUDE 0x7f800000u
+
+#define RULES (SEAGRASS_FLOAT_RULE_NOT_NAN \
+               | SEAGRASS_FLOAT_RULE_FINITE \
+               | SEAGRASS_FLOAT_RULE_NON_NEGATIVE \
+               | SEAGRASS_FLOAT_RULE_RANGE)
+
+/* Any combination of the rules reduces to a value being invalid if its
+ * magnitude bits are at least limit, or it is less than lower, or greater
+ * than upper. The comparisons of NaN with the bounds are false, so that NaN
+ * is only caught by the limit. */
+struct bounds {
+    uint32_t limit;
+    float lower;
+    float upper;
+};
+
+static inline bool invalid(const struct bounds bounds, const float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return ((bits & 0x7fffffff) >= bounds.limit)
+           | (value < bounds.lower)
+           | (value > bounds.upper);
+}
+
+static int init(const unsigned int rules,
+                const float minimum,
+                const float maximum,
+                struct bounds *const out) {
+    if (rules & ~RULES) {
+        return SEAGRASS_FLOAT_ERROR_RULES_IS_INVALID;
+    }
+    /* no magnitude reaches the limit */
+    struct bounds result = {UINT32_C(0x80000000), -INFINITY, INFINITY};
+    if (rules & SEAGRASS_FLOAT_RULE_NOT_NAN) {
+        result.limit = INFINITY_MAGNITUDE + 1;
+    }
+    if (rules & SEAGRASS_FLOAT_RULE_FINITE) {
+        result.limit = INFINITY_MAGNITUDE;
+    }
+    if (rules & SEAGRASS_FLOAT_RULE_NON_NEGATIVE) {
+        result.lower = 0;
+    }
+    if (rules & SEAGRASS_FLOAT_RULE_RANGE) {
+        if (isnan(minimum) || isnan(maximum) || minimum > maximum) {
+            return SEAGRASS_FLOAT_ERROR_RANGE_IS_INVALID;
+        }
+        result.lower = minimum > result.lower ? minimum : result.lower;
+        result.upper = maximum;
+    }
+    *out = result;
+    return 0;
+}
+
+/* Returns whether any of the values is invalid. */
+SEAGRASS_KERNEL
+static bool any(const struct bounds bounds, const float *const values,
+                const uintmax_t count) {
+    uint8_t found[LANES] = {0};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (unsigned int j = 0; j < LANES; j++) {
+            found[j] |= invalid(bounds, values[i + j]);
+        }
+    }
+    uint8_t result = 0;
+    for (; i < count; i++) {
+        result |= invalid(bounds, values[i]);
+    }
+    for (unsigned int j = 0; j < LANES; j++) {
+        result |= found[j];
+    }
+    return result;
+}
+
+/* Evaluate the predicate of BITS values into bytes first, which vectorizes
+ * as plain compares with a loop of constant length, and then gather the
+ * bytes into the word. */
+static inline uint64_t word(const struct bounds bounds,
+                            const float *const values) {
+    uint8_t lanes[BITS];
+    for (unsigned int j = 0; j < BITS; j++) {
+        lanes[j] = invalid(bounds, values[j]);
+    }
+    return seagrass_bits_gather(lanes);
+}
+
+int seagrass_float_find_invalid_n(const float *const values,
+                                  const uintmax_t count,
+                                  const unsigned int rules,
+                                  const float minimum,
+                                  const float maximum,
+                                  uintmax_t *const out) {
+    if (!values && count) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    struct bounds bounds;
+    const int error = init(rules, minimum, maximum, &bounds);
+    if (error) {
+        return error;
+    }
+    for (uintmax_t i = 0; i < count; i += BLOCK) {
+        const uintmax_t n = count - i < BLOCK ? count - i : BLOCK;
+        if (any(bounds, values + i, n)) {
+            for (; !invalid(bounds, values[i]); i++);
+            *out = i;
+            return 0;
+        }
+    }
+    *out = count;
+    return 0;
+}
+
+int seagrass_float_invalid_mask_n(const float *const values,
+                                  const uintmax_t count,
+                                  const unsigned int rules,
+                                  const float minimum,
+                                  const float maximum,
+                                  uint64_t *const out) {
+    if (!values && count) {
+        return SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL;
+    }
+    if (!out && count) {
+        return SEAGRASS_FLOAT_ERROR_OUT_IS_NULL;
+    }
+    struct bounds bounds;
+    const int error = init(rules, minimum, maximum, &bounds);
+    if (error) {
+        return error;
+    }
+    uintmax_t i = 0;
+    for (; i + BITS <= count; i += BITS) {
+        out[i / BITS] = word(bounds, values + i);
+    }
+    if (i < count) {
+        uint64_t bits = 0;
+        for (uintmax_t j = 0; i + j < count; j++) {
+            bits |= (uint64_t) invalid(bounds, values[i + j]) << j;
+        }
+        out[i / BITS] = bits;
+    }
+    return 0;
+}
@@ -0,0 +1,373 @@
+/*
+ * Checked floating point arithmetic template.
+ *
+ * Define the following before including this file:
+ *  SEAGRASS_TEMPLATE_TYPE       floating point type, e.g. double
+ *  SEAGRASS_TEMPLATE_EPSILON    machine epsilon of the type, e.g. DBL_EPSILON
+ *  SEAGRASS_TEMPLATE_FABS       absolute value function, e.g. fabs
+ *  SEAGRASS_TEMPLATE_LLRINT     round to long long function, e.g. llrint
+ *  SEAGRASS_TEMPLATE_MIN        smallest normal value, e.g. DBL_MIN
+ *  SEAGRASS_TEMPLATE_MANT_DIG   bits of the significand, e.g. DBL_MANT_DIG
+ *  SEAGRASS_TEMPLATE_RESIDUAL   x * y - z, which is zero only when x * y
+ *                               equals z exactly, e.g. fma(x, y, -(z))
+ *  SEAGRASS_TEMPLATE_FUNCTION   maps a name to the function name, e.g.
+ *                               seagrass_double_ ## name
+ *  SEAGRASS_TEMPLATE_ERROR      maps a name to the error code, e.g.
+ *                               SEAGRASS_DOUBLE_ERROR_ ## name
+ *  SEAGRASS_TEMPLATE_INSTRUMENTATION
+ *                               maps a name to the instrumented function,
+ *                               e.g. SEAGRASS_INSTRUMENTATION_DOUBLE_ ## name
+ *
+ * The rounding modes are shared with the float module, see
+ * enum seagrass_float_rounding_mode.
+ *
+ * The parameters are undefined at the end of this file.
+ */
+#if !defined(SEAGRASS_TEMPLATE_TYPE) || !defined(SEAGRASS_TEMPLATE_EPSILON) \
+    || !defined(SEAGRASS_TEMPLATE_FABS) || !defined(SEAGRASS_TEMPLATE_LLRINT) \
+    || !defined(SEAGRASS_TEMPLATE_MIN) || !defined(SEAGRASS_TEMPLATE_MANT_DIG) \
+    || !defined(SEAGRASS_TEMPLATE_RESIDUAL) \
+    || !defined(SEAGRASS_TEMPLATE_FUNCTION) \
+    || !defined(SEAGRASS_TEMPLATE_ERROR) \
+    || !defined(SEAGRASS_TEMPLATE_INSTRUMENTATION)
+#error "floating template parameters are not defined"
+#endif
+
+#define T SEAGRASS_TEMPLATE_TYPE
+#define F SEAGRASS_TEMPLATE_FUNCTION
+#define E SEAGRASS_TEMPLATE_ERROR
+#define I SEAGRASS_TEMPLATE_INSTRUMENTATION
+
+int F(ptr_compare)(const T *const a, const T *const b) {
+    seagrass_required_true(a || b);
+    if (!b) {
+        return (-1);
+    } else if (!a) {
+        return 1;
+    }
+    return F(compare)(*a, *b);
+}
+
+int F(compare)(const T a, const T b) {
+    bool result;
+    seagrass_required_true(!F(is_less_than)(a, b, &result));
+    if (result) {
+        return (-1);
+    }
+    seagrass_required_true(!F(is_greater_than)(a, b, &result));
+    if (result) {
+        return 1;
+    }
+    return 0;
+}
+
+int F(minimum)(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    bool result;
+    seagrass_required_true(!F(is_less_than)(a, b, &result));
+    if (result) {
+        *out = a;
+    } else {
+        *out = b;
+    }
+    return 0;
+}
+
+int F(maximum)(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    bool result;
+    seagrass_required_true(!F(is_greater_than)(a, b, &result));
+    if (result) {
+        *out = a;
+    } else {
+        *out = b;
+    }
+    return 0;
+}
+
+static int checked_add(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    const T c = a + b;
+    if ((b && (c == a)) || (a && (c == b))) {
+        return E(RESULT_IS_UNCHANGED);
+    }
+    bool result;
+    seagrass_required_true(!F(is_equal)(c - a, b, &result));
+    if (!result) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    *out = c;
+    return 0;
+}
+
+int F(add)(const T a, const T b, T *const out) {
+    return seagrass_instrumentation_record(I(ADD), checked_add(a, b, out));
+}
+
+static int checked_subtract(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    const T c = a - b;
+    if ((b && (c == a)) || (a && (c == -b))) {
+        return E(RESULT_IS_UNCHANGED);
+    }
+    bool result;
+    seagrass_required_true(!F(is_equal)(c - a, -b, &result));
+    if (!result) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    *out = c;
+    return 0;
+}
+
+int F(subtract)(const T a, const T b, T *const out) {
+    return seagrass_instrumentation_record(I(SUBTRACT),
+                                          checked_subtract(a, b, out));
+}
+
+static int checked_multiply(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    bool result;
+    T A, B;
+    seagrass_required_true(!F(maximum)(a, b, &A));
+    seagrass_required_true(!F(minimum)(a, b, &B));
+    const T C = A * B;
+    seagrass_required_true(!F(is_equal)(C, 0, &result));
+    if (result) {
+        *out = 0;
+        return 0;
+    }
+    seagrass_required_true(!F(is_equal)(C / A, B, &result));
+    if (!result) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    *out = C;
+    return 0;
+}
+
+int F(multiply)(const T a, const T b, T *const out) {
+    return seagrass_instrumentation_record(I(MULTIPLY),
+                                          checked_multiply(a, b, out));
+}
+
+static int checked_divide(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    bool result;
+    seagrass_required_true(!F(is_equal)(b, 0, &result));
+    if (result) {
+        return E(DIVIDE_BY_ZERO);
+    }
+    const T c = a / b;
+    seagrass_required_true(!F(is_equal)(a, c * b, &result));
+    if (!result) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    *out = c;
+    return 0;
+}
+
+int F(divide)(const T a, const T b, T *const out) {
+    return seagrass_instrumentation_record(I(DIVIDE),
+                                          checked_divide(a, b, out));
+}
+
+/*
+ * The exact variants reject every result which differs from the exact one,
+ * measuring the rounding error instead of comparing with a tolerance. The
+ * error of a sum is representable and found by TwoSum, the error of a
+ * product by the residual of a fused multiply-add.
+ */
+
+static bool is_exact_sum(const T a, const T b, const T c) {
+    const T bb = c - a;
+    return !((a - (c - bb)) + (b - bb));
+}
+
+static bool is_exact_product(const T x, const T y, const T z) {
+    const T scale = (T) (UINT64_C(1) << SEAGRASS_TEMPLATE_MANT_DIG);
+    /*
+     * Below this bound the residual may be smaller than the smallest
+     * subnormal number and round to zero, so the smaller factor and z are
+     * scaled up by a power of two first, which is exact.
+     */
+    if (SEAGRASS_TEMPLATE_FABS(z) < SEAGRASS_TEMPLATE_MIN * scale) {
+        const bool swap = SEAGRASS_TEMPLATE_FABS(x) > SEAGRASS_TEMPLATE_FABS(y);
+        const T small = (swap ? y : x) * scale * scale;
+        return !SEAGRASS_TEMPLATE_RESIDUAL(small, swap ? x : y,
+                                           z * scale * scale);
+    }
+    return !SEAGRASS_TEMPLATE_RESIDUAL(x, y, z);
+}
+
+int F(add_exact)(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    const T c = a + b;
+    if (!isfinite(c)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    if ((b && (c == a)) || (a && (c == b))) {
+        return E(RESULT_IS_UNCHANGED);
+    }
+    if (!is_exact_sum(a, b, c)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    *out = c;
+    return 0;
+}
+
+int F(subtract_exact)(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    const T c = a - b;
+    if (!isfinite(c)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    if ((b && (c == a)) || (a && (c == -b))) {
+        return E(RESULT_IS_UNCHANGED);
+    }
+    if (!is_exact_sum(a, -b, c)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    *out = c;
+    return 0;
+}
+
+int F(multiply_exact)(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    const T c = a * b;
+    if (!isfinite(c) || (!c && a && b) || !is_exact_product(a, b, c)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    *out = c;
+    return 0;
+}
+
+int F(divide_exact)(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    if (!b) {
+        return E(DIVIDE_BY_ZERO);
+    }
+    const T c = a / b;
+    if (!isfinite(c) || !is_exact_product(c, b, a)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    *out = c;
+    return 0;
+}
+
+int F(is_equal)(const T a, const T b, bool *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    *out = SEAGRASS_TEMPLATE_FABS(a - b) <= SEAGRASS_TEMPLATE_EPSILON;
+    return 0;
+}
+
+int F(is_greater_than)(const T a, const T b, bool *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    *out = (a - b) >= SEAGRASS_TEMPLATE_EPSILON;
+    return 0;
+}
+
+int F(is_less_than)(const T a, const T b, bool *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    *out = (a - b) <= -SEAGRASS_TEMPLATE_EPSILON;
+    return 0;
+}
+
+int F(is_greater_or_equal)(const T a, const T b, bool *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    *out = (a - b) >= -SEAGRASS_TEMPLATE_EPSILON;
+    return 0;
+}
+
+int F(is_less_or_equal)(const T a, const T b, bool *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    *out = (a - b) <= SEAGRASS_TEMPLATE_EPSILON;
+    return 0;
+}
+
+int F(to_uintmax_t)(const T a, const enum seagrass_float_rounding_mode mode,
+                    uintmax_t *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    bool result;
+    seagrass_required_true(!F(is_less_than)(a, 0, &result));
+    if (result) {
+        return E(FLOAT_VALUE_IS_NEGATIVE);
+    }
+    const int round = fegetround();
+    switch (mode) {
+        default: {
+            return E(ROUNDING_MODE_IS_INVALID);
+        }
+        case SEAGRASS_FLOAT_ROUNDING_MODE_NEAREST: {
+            seagrass_required_true(!fesetround(FE_TONEAREST));
+            break;
+        }
+        case SEAGRASS_FLOAT_ROUNDING_MODE_DOWNWARD: {
+            seagrass_required_true(!fesetround(FE_DOWNWARD));
+            break;
+        }
+        case SEAGRASS_FLOAT_ROUNDING_MODE_UPWARD: {
+            seagrass_required_true(!fesetround(FE_UPWARD));
+            break;
+        }
+        case SEAGRASS_FLOAT_ROUNDING_MODE_TOWARDS_ZERO: {
+            seagrass_required_true(!fesetround(FE_TOWARDZERO));
+            break;
+        }
+    }
+    seagrass_required_true(!feclearexcept(FE_ALL_EXCEPT));
+    *out = SEAGRASS_TEMPLATE_LLRINT(a);
+    const int except = fetestexcept(FE_INVALID | FE_DIVBYZERO
+                                    | FE_OVERFLOW | FE_UNDERFLOW);
+    if (except & FE_INVALID) {
+        return E(FLOAT_VALUE_TOO_LARGE);
+    }
+    seagrass_required_true(!except);
+    seagrass_required_true(!fesetround(round));
+    return 0;
+}
+
+#undef T
+#undef F
+#undef E
+#undef I
+#undef SEAGRASS_TEMPLATE_TYPE
+#undef SEAGRASS_TEMPLATE_EPSILON
+#undef SEAGRASS_TEMPLATE_FABS
+#undef SEAGRASS_TEMPLATE_LLRINT
+#undef SEAGRASS_TEMPLATE_MIN
+#undef SEAGRASS_TEMPLATE_MANT_DIG
+#undef SEAGRASS_TEMPLATE_RESIDUAL
+#undef SEAGRASS_TEMPLATE_FUNCTION
+#undef SEAGRASS_TEMPLATE_ERROR
+#undef SEAGRASS_TEMPLATE_INSTRUMENTATION
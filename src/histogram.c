@@ -0,0 +1,416 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "bits.h"
+#include "thread_identity.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* Shards start on a cache line of their own. */
+#define LINE 64
+#define COUNTS_PER_LINE (LINE / sizeof(uintmax_t))
+
+/* Identity of the calling thread plus one, zero until it has been looked
+ * up. */
+static _Thread_local uintmax_t identity;
+
+static uintmax_t bucket_count(const uintmax_t precision) {
+    return (SEAGRASS_BITS_WIDTH - precision + 2) << (precision - 1);
+}
+
+static inline uintmax_t bucket(const uintmax_t value,
+                               const uintmax_t precision) {
+    const uintmax_t exponent = SEAGRASS_BITS_WIDTH - 1
+                               - seagrass_bits_clz(value | 1);
+    const uintmax_t shift = exponent < precision
+                            ? 0 : exponent - precision + 1;
+    return (shift << (precision - 1)) + (value >> shift);
+}
+
+/* Largest value counted in the bucket. */
+static uintmax_t highest(const uintmax_t index, const uintmax_t precision) {
+    if (!(index >> precision)) {
+        return index;
+    }
+    const uintmax_t shift = (index >> (precision - 1)) - 1;
+    const uintmax_t significand = index - (shift << (precision - 1));
+    return (significand << shift) + (((uintmax_t) 1 << shift) - 1);
+}
+
+/* Add to a bucket of the shard of the calling thread. Only the thread
+ * owning a shard writes to it, which spares it the atomic read-modify-write
+ * that the shared shard needs. */
+static inline void add(struct seagrass_histogram *const object,
+                       const uintmax_t index,
+                       const uintmax_t count) {
+    if (!identity) {
+        identity = seagrass_thread_identity() + 1;
+    }
+    const uintmax_t shard = identity - 1;
+    if (shard < object->shards) {
+        _Atomic(uintmax_t) *const counts = object->counts
+                                           + shard * object->stride;
+        atomic_store_explicit(
+                &counts[index],
+                atomic_load_explicit(&counts[index], memory_order_relaxed)
+                + count,
+                memory_order_relaxed);
+    } else {
+        _Atomic(uintmax_t) *const counts = object->counts
+                                           + object->shards * object->stride;
+        atomic_fetch_add_explicit(&counts[index], count,
+                                  memory_order_relaxed);
+    }
+}
+
+/* Sum the counts of the bucket over all shards, returns false on overflow. */
+static bool total(const struct seagrass_histogram *const object,
+                  const uintmax_t index,
+                  uintmax_t *const out) {
+    uintmax_t sum = 0;
+    for (uintmax_t i = 0; i <= object->shards; i++) {
+        const uintmax_t count = atomic_load_explicit(
+                &object->counts[i * object->stride + index],
+                memory_order_relaxed);
+        if (seagrass_uintmax_t_add(sum, count, &sum)) {
+            return false;
+        }
+    }
+    *out = sum;
+    return true;
+}
+
+int seagrass_histogram_init(struct seagrass_histogram *const object,
+                            const uintmax_t precision,
+                            const uintmax_t shards) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    if (precision < SEAGRASS_HISTOGRAM_PRECISION_MINIMUM
+        || precision > SEAGRASS_HISTOGRAM_PRECISION_MAXIMUM) {
+        return SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID;
+    }
+    if (!shards) {
+        return SEAGRASS_HISTOGRAM_ERROR_SHARDS_IS_ZERO;
+    }
+    const uintmax_t buckets = bucket_count(precision);
+    uintmax_t stride, count, size;
+    seagrass_required_true(!seagrass_uintmax_t_align_up(
+            buckets, COUNTS_PER_LINE, &stride));
+    void *counts;
+    /* the shards plus the shared one */
+    if (shards == UINTMAX_MAX
+        || seagrass_uintmax_t_multiply(shards + 1, stride, &count)
+        || seagrass_uintmax_t_multiply(count, sizeof(uintmax_t), &size)
+        || size > SIZE_MAX
+        || posix_memalign(&counts, LINE, (size_t) size)) {
+        return SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    *object = (struct seagrass_histogram) {
+            .precision = precision,
+            .buckets = buckets,
+            .stride = stride,
+            .shards = shards,
+            .counts = counts
+    };
+    for (uintmax_t i = 0; i < count; i++) {
+        atomic_init(&object->counts[i], 0);
+    }
+    return 0;
+}
+
+int seagrass_histogram_invalidate(struct seagrass_histogram *const object) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    free(object->counts);
+    *object = (struct seagrass_histogram) {0};
+    return 0;
+}
+
+int seagrass_histogram_record(struct seagrass_histogram *const object,
+                              const uintmax_t value) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    add(object, bucket(value, object->precision), 1);
+    return 0;
+}
+
+int seagrass_histogram_merge(struct seagrass_histogram *const object,
+                             const struct seagrass_histogram *const other) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    if (!other) {
+        return SEAGRASS_HISTOGRAM_ERROR_OTHER_IS_NULL;
+    }
+    if (object->precision != other->precision) {
+        return SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID;
+    }
+    uintmax_t *const counts = calloc(other->buckets, sizeof(uintmax_t));
+    if (!counts) {
+        return SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    /* every bucket is checked before any is added to, so that a merge that
+     * fails leaves object as it was */
+    for (uintmax_t i = 0; i < other->buckets; i++) {
+        uintmax_t count, sum;
+        if (!total(other, i, &counts[i])
+            || !total(object, i, &count)
+            || seagrass_uintmax_t_add(count, counts[i], &sum)) {
+            free(counts);
+            return SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT;
+        }
+    }
+    for (uintmax_t i = 0; i < other->buckets; i++) {
+        if (counts[i]) {
+            add(object, i, counts[i]);
+        }
+    }
+    free(counts);
+    return 0;
+}
+
+int seagrass_histogram_snapshot(const struct seagrass_histogram *const object,
+                                struct seagrass_histogram_snapshot *const out) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL;
+    }
+    uintmax_t *const counts = calloc(object->buckets, sizeof(uintmax_t));
+    if (!counts) {
+        return SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    uintmax_t sum = 0;
+    for (uintmax_t i = 0; i < object->buckets; i++) {
+        if (!total(object, i, &counts[i])
+            || seagrass_uintmax_t_add(sum, counts[i], &sum)) {
+            free(counts);
+            return SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT;
+        }
+    }
+    *out = (struct seagrass_histogram_snapshot) {
+            .precision = object->precision,
+            .count = sum,
+            .counts = counts
+    };
+    return 0;
+}
+
+int seagrass_histogram_snapshot_invalidate(
+        struct seagrass_histogram_snapshot *const object) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    free(object->counts);
+    *object = (struct seagrass_histogram_snapshot) {0};
+    return 0;
+}
+
+int seagrass_histogram_snapshot_count(
+        const struct seagrass_histogram_snapshot *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL;
+    }
+    *out = object->count;
+    return 0;
+}
+
+int seagrass_histogram_snapshot_percentile(
+        const struct seagrass_histogram_snapshot *const object,
+        const double percentile,
+        uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    if (!(percentile >= 0 && percentile <= 100)) {
+        return SEAGRASS_HISTOGRAM_ERROR_PERCENTILE_IS_INVALID;
+    }
+    if (!out) {
+        return SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL;
+    }
+    if (!object->count) {
+        return SEAGRASS_HISTOGRAM_ERROR_IS_EMPTY;
+    }
+    /* the rank of the value, from 1 to the count */
+    const double rank = ceil(percentile / 100 * (double) object->count);
+    const uintmax_t wanted = rank < 1
+                             ? 1
+                             : rank >= (double) object->count
+                               ? object->count
+                               : (uintmax_t) rank;
+    uintmax_t i = 0;
+    for (uintmax_t seen = object->counts[0]; seen < wanted;
+         seen += object->counts[++i]);
+    *out = highest(i, object->precision);
+    return 0;
+}
+
+int seagrass_histogram_snapshot_merge(
+        struct seagrass_histogram_snapshot *const object,
+        const struct seagrass_histogram_snapshot *const other) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    if (!other) {
+        return SEAGRASS_HISTOGRAM_ERROR_OTHER_IS_NULL;
+    }
+    if (object->precision != other->precision) {
+        return SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID;
+    }
+    /* no bucket can overflow if the sum of all of them does not */
+    uintmax_t count;
+    if (seagrass_uintmax_t_add(object->count, other->count, &count)) {
+        return SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    const uintmax_t buckets = bucket_count(object->precision);
+    for (uintmax_t i = 0; i < buckets; i++) {
+        object->counts[i] += other->counts[i];
+    }
+    object->count = count;
+    return 0;
+}
+
+static uintmax_t leb128_size(uintmax_t value) {
+    uintmax_t size = 1;
+    for (; value >>= 7; size++);
+    return size;
+}
+
+static unsigned char *leb128_write(unsigned char *data, uintmax_t value) {
+    for (; value >= 0x80; value >>= 7) {
+        *data++ = (unsigned char) (value | 0x80);
+    }
+    *data++ = (unsigned char) value;
+    return data;
+}
+
+/* Returns false if the value is truncated or does not fit a uintmax_t. */
+static bool leb128_read(const unsigned char **const data,
+                        const unsigned char *const end,
+                        uintmax_t *const out) {
+    uintmax_t value = 0;
+    for (unsigned int shift = 0; *data < end; shift += 7) {
+        const uintmax_t byte = *(*data)++;
+        if (shift >= SEAGRASS_BITS_WIDTH
+            || (shift > SEAGRASS_BITS_WIDTH - 7
+                && (byte & 0x7f) >> (SEAGRASS_BITS_WIDTH - shift))) {
+            return false;
+        }
+        value |= (byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *out = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+int seagrass_histogram_snapshot_serialized_size(
+        const struct seagrass_histogram_snapshot *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL;
+    }
+    const uintmax_t buckets = bucket_count(object->precision);
+    uintmax_t size = leb128_size(object->precision);
+    for (uintmax_t i = 0, next = 0; i < buckets; i++) {
+        if (object->counts[i]) {
+            size += leb128_size(i - next) + leb128_size(object->counts[i]);
+            next = i + 1;
+        }
+    }
+    *out = size;
+    return 0;
+}
+
+int seagrass_histogram_snapshot_serialize(
+        const struct seagrass_histogram_snapshot *const object,
+        void *const data,
+        const uintmax_t size) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    if (!data) {
+        return SEAGRASS_HISTOGRAM_ERROR_DATA_IS_NULL;
+    }
+    uintmax_t required;
+    seagrass_required_true(!seagrass_histogram_snapshot_serialized_size(
+            object, &required));
+    if (size < required) {
+        return SEAGRASS_HISTOGRAM_ERROR_SIZE_IS_TOO_SMALL;
+    }
+    const uintmax_t buckets = bucket_count(object->precision);
+    unsigned char *at = leb128_write(data, object->precision);
+    for (uintmax_t i = 0, next = 0; i < buckets; i++) {
+        if (object->counts[i]) {
+            at = leb128_write(at, i - next);
+            at = leb128_write(at, object->counts[i]);
+            next = i + 1;
+        }
+    }
+    return 0;
+}
+
+int seagrass_histogram_snapshot_deserialize(
+        struct seagrass_histogram_snapshot *const object,
+        const void *const data,
+        const uintmax_t size) {
+    if (!object) {
+        return SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL;
+    }
+    if (!data) {
+        return SEAGRASS_HISTOGRAM_ERROR_DATA_IS_NULL;
+    }
+    const unsigned char *at = data;
+    const unsigned char *const end = at + size;
+    uintmax_t precision;
+    if (!leb128_read(&at, end, &precision)
+        || precision < SEAGRASS_HISTOGRAM_PRECISION_MINIMUM
+        || precision > SEAGRASS_HISTOGRAM_PRECISION_MAXIMUM) {
+        return SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID;
+    }
+    const uintmax_t buckets = bucket_count(precision);
+    uintmax_t *const counts = calloc(buckets, sizeof(uintmax_t));
+    if (!counts) {
+        return SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    uintmax_t sum = 0;
+    for (uintmax_t next = 0; at < end;) {
+        uintmax_t skipped, count;
+        /* only buckets that are not empty are serialized */
+        if (!leb128_read(&at, end, &skipped)
+            || !leb128_read(&at, end, &count)
+            || skipped >= buckets - next
+            || !count) {
+            free(counts);
+            return SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID;
+        }
+        next += skipped;
+        if (seagrass_uintmax_t_add(sum, count, &sum)) {
+            free(counts);
+            return SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT;
+        }
+        counts[next++] = count;
+    }
+    *object = (struct seagrass_histogram_snapshot) {
+            .precision = precision,
+            .count = sum,
+            .counts = counts
+    };
+    return 0;
+}
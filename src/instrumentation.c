@@ -0,0 +1,232 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <seagrass.h>
+
+#include "instrumentation.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+static const char *const names[SEAGRASS_INSTRUMENTATION_FUNCTIONS] = {
+        "seagrass_int32_t_add",
+        "seagrass_int32_t_subtract",
+        "seagrass_int32_t_multiply",
+        "seagrass_int32_t_divide",
+        "seagrass_int64_t_add",
+        "seagrass_int64_t_subtract",
+        "seagrass_int64_t_multiply",
+        "seagrass_int64_t_divide",
+        "seagrass_uint32_t_add",
+        "seagrass_uint32_t_subtract",
+        "seagrass_uint32_t_multiply",
+        "seagrass_uint32_t_divide",
+        "seagrass_size_t_add",
+        "seagrass_size_t_subtract",
+        "seagrass_size_t_multiply",
+        "seagrass_size_t_divide",
+        "seagrass_uintmax_t_add",
+        "seagrass_uintmax_t_subtract",
+        "seagrass_uintmax_t_multiply",
+        "seagrass_uintmax_t_divide",
+        "seagrass_float_add",
+        "seagrass_float_subtract",
+        "seagrass_float_multiply",
+        "seagrass_float_divide",
+        "seagrass_double_add",
+        "seagrass_double_subtract",
+        "seagrass_double_multiply",
+        "seagrass_double_divide"
+};
+
+/*
+ * Counts are added up with plain additions rather than the instrumented
+ * functions so that taking a snapshot does not count calls of its own.
+ */
+
+#ifdef SEAGRASS_INSTRUMENTATION
+
+_Thread_local struct seagrass_instrumentation_counters *
+        seagrass_instrumentation_counters;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static pthread_key_t key;
+/* counters of the running threads */
+static struct seagrass_instrumentation_counters *running;
+/* counts of the threads that exited */
+static struct seagrass_instrumentation_snapshot exited;
+
+static void retire(void *const value) {
+    struct seagrass_instrumentation_counters *const counters = value;
+    seagrass_required_true(!pthread_mutex_lock(&lock));
+    struct seagrass_instrumentation_counters **i = &running;
+    for (; *i != counters; i = &(*i)->next);
+    *i = counters->next;
+    for (uintmax_t f = 0; f < SEAGRASS_INSTRUMENTATION_FUNCTIONS; f++) {
+        for (uintmax_t o = 0; o < SEAGRASS_INSTRUMENTATION_OUTCOMES; o++) {
+            exited.counts[f][o] = seagrass_uintmax_t_saturating_add(
+                    exited.counts[f][o],
+                    atomic_load_explicit(&counters->counts[f][o],
+                                         memory_order_relaxed));
+        }
+    }
+    seagrass_required_true(!pthread_mutex_unlock(&lock));
+    seagrass_instrumentation_counters = NULL;
+    free(counters);
+}
+
+static void initialize(void) {
+    seagrass_required_true(!pthread_key_create(&key, retire));
+}
+
+struct seagrass_instrumentation_counters *
+seagrass_instrumentation_register(void) {
+    seagrass_required_true(!pthread_once(&once, initialize));
+    struct seagrass_instrumentation_counters *const counters
+            = calloc(1, sizeof(*counters));
+    if (!counters) {
+        return NULL;
+    }
+    if (pthread_setspecific(key, counters)) {
+        free(counters);
+        return NULL;
+    }
+    seagrass_required_true(!pthread_mutex_lock(&lock));
+    counters->next = running;
+    running = counters;
+    seagrass_required_true(!pthread_mutex_unlock(&lock));
+    seagrass_instrumentation_counters = counters;
+    return counters;
+}
+
+#endif /* SEAGRASS_INSTRUMENTATION */
+
+int seagrass_instrumentation_is_enabled(bool *const out) {
+    if (!out) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL;
+    }
+#ifdef SEAGRASS_INSTRUMENTATION
+    *out = true;
+#else
+    *out = false;
+#endif
+    return 0;
+}
+
+int seagrass_instrumentation_function_name(
+        const enum seagrass_instrumentation_function function,
+        const char **const out) {
+    if ((uintmax_t) function >= SEAGRASS_INSTRUMENTATION_FUNCTIONS) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID;
+    }
+    if (!out) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL;
+    }
+    *out = names[function];
+    return 0;
+}
+
+int seagrass_instrumentation_snapshot(
+        struct seagrass_instrumentation_snapshot *const out) {
+    if (!out) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL;
+    }
+    struct seagrass_instrumentation_snapshot result = {0};
+#ifdef SEAGRASS_INSTRUMENTATION
+    seagrass_required_true(!pthread_mutex_lock(&lock));
+    result = exited;
+    bool overflow = false;
+    for (const struct seagrass_instrumentation_counters *i = running; i;
+         i = i->next) {
+        for (uintmax_t f = 0; f < SEAGRASS_INSTRUMENTATION_FUNCTIONS; f++) {
+            for (uintmax_t o = 0; o < SEAGRASS_INSTRUMENTATION_OUTCOMES;
+                 o++) {
+                const uintmax_t count = result.counts[f][o];
+                result.counts[f][o] += atomic_load_explicit(
+                        &i->counts[f][o], memory_order_relaxed);
+                overflow |= result.counts[f][o] < count;
+            }
+        }
+    }
+    /* saturated while threads exited */
+    for (uintmax_t f = 0; f < SEAGRASS_INSTRUMENTATION_FUNCTIONS; f++) {
+        for (uintmax_t o = 0; o < SEAGRASS_INSTRUMENTATION_OUTCOMES; o++) {
+            overflow |= UINTMAX_MAX == exited.counts[f][o];
+        }
+    }
+    seagrass_required_true(!pthread_mutex_unlock(&lock));
+    if (overflow) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_RESULT_IS_INCONSISTENT;
+    }
+#endif
+    *out = result;
+    return 0;
+}
+
+int seagrass_instrumentation_snapshot_merge(
+        struct seagrass_instrumentation_snapshot *const object,
+        const struct seagrass_instrumentation_snapshot *const other) {
+    if (!object) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL;
+    }
+    if (!other) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OTHER_IS_NULL;
+    }
+    struct seagrass_instrumentation_snapshot result;
+    for (uintmax_t f = 0; f < SEAGRASS_INSTRUMENTATION_FUNCTIONS; f++) {
+        for (uintmax_t o = 0; o < SEAGRASS_INSTRUMENTATION_OUTCOMES; o++) {
+            result.counts[f][o] = object->counts[f][o] + other->counts[f][o];
+            if (result.counts[f][o] < object->counts[f][o]) {
+                return SEAGRASS_INSTRUMENTATION_ERROR_RESULT_IS_INCONSISTENT;
+            }
+        }
+    }
+    *object = result;
+    return 0;
+}
+
+int seagrass_instrumentation_snapshot_count(
+        const struct seagrass_instrumentation_snapshot *const object,
+        const enum seagrass_instrumentation_function function,
+        const enum seagrass_instrumentation_outcome outcome,
+        uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL;
+    }
+    if ((uintmax_t) function >= SEAGRASS_INSTRUMENTATION_FUNCTIONS) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID;
+    }
+    if ((uintmax_t) outcome >= SEAGRASS_INSTRUMENTATION_OUTCOMES) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OUTCOME_IS_INVALID;
+    }
+    if (!out) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL;
+    }
+    *out = object->counts[function][outcome];
+    return 0;
+}
+
+int seagrass_instrumentation_snapshot_calls(
+        const struct seagrass_instrumentation_snapshot *const object,
+        const enum seagrass_instrumentation_function function,
+        uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL;
+    }
+    if ((uintmax_t) function >= SEAGRASS_INSTRUMENTATION_FUNCTIONS) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID;
+    }
+    if (!out) {
+        return SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL;
+    }
+    uintmax_t calls = 0;
+    for (uintmax_t o = 0; o < SEAGRASS_INSTRUMENTATION_OUTCOMES; o++) {
+        calls += object->counts[function][o];
+        if (calls < object->counts[function][o]) {
+            return SEAGRASS_INSTRUMENTATION_ERROR_RESULT_IS_INCONSISTENT;
+        }
+    }
+    *out = calls;
+    return 0;
+}
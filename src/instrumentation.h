@@ -0,0 +1,79 @@
+#ifndef _SEAGRASS_INSTRUMENTATION_PRIVATE_H_
+#define _SEAGRASS_INSTRUMENTATION_PRIVATE_H_
+
+#include <stdatomic.h>
+#include <seagrass/instrumentation.h>
+
+#ifdef SEAGRASS_INSTRUMENTATION
+
+/**
+ * @brief Counters of a single thread.
+ */
+struct seagrass_instrumentation_counters {
+    _Atomic(uintmax_t) counts[SEAGRASS_INSTRUMENTATION_FUNCTIONS]
+                             [SEAGRASS_INSTRUMENTATION_OUTCOMES];
+    struct seagrass_instrumentation_counters *next;
+};
+
+/* NULL until the first instrumented call of the thread. */
+extern _Thread_local struct seagrass_instrumentation_counters *
+        seagrass_instrumentation_counters;
+
+/**
+ * @brief Allocate and register the counters of the calling thread.
+ * @return counters, or <i>NULL</i> if there is insufficient memory.
+ */
+struct seagrass_instrumentation_counters *
+seagrass_instrumentation_register(void);
+
+/**
+ * @brief Count the outcome of a call in the counters of the calling thread.
+ * @param [in] function that was called.
+ * @param [in] error code it returned.
+ * @return error.
+ */
+static inline int seagrass_instrumentation_record(
+        const enum seagrass_instrumentation_function function,
+        const int error) {
+    struct seagrass_instrumentation_counters *counters
+            = seagrass_instrumentation_counters;
+    if (!counters && !(counters = seagrass_instrumentation_register())) {
+        return error;
+    }
+    enum seagrass_instrumentation_outcome outcome;
+    switch (error) {
+        case 0:
+            outcome = SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS;
+            break;
+        case SEA_URCHIN_ERROR_OUT_IS_NULL:
+        case SEA_URCHIN_ERROR_VALUE_IS_NULL:
+            outcome = SEAGRASS_INSTRUMENTATION_OUTCOME_ARGUMENT_IS_NULL;
+            break;
+        case SEA_URCHIN_ERROR_RESULT_IS_INCONSISTENT:
+            outcome = SEAGRASS_INSTRUMENTATION_OUTCOME_RESULT_IS_INCONSISTENT;
+            break;
+        case SEA_URCHIN_ERROR_RESULT_IS_UNCHANGED:
+            outcome = SEAGRASS_INSTRUMENTATION_OUTCOME_RESULT_IS_UNCHANGED;
+            break;
+        case SEA_URCHIN_ERROR_DIVIDE_BY_ZERO:
+            outcome = SEAGRASS_INSTRUMENTATION_OUTCOME_DIVIDE_BY_ZERO;
+            break;
+        default:
+            outcome = SEAGRASS_INSTRUMENTATION_OUTCOME_OTHER;
+            break;
+    }
+    /* only this thread writes its counters */
+    _Atomic(uintmax_t) *const count = &counters->counts[function][outcome];
+    atomic_store_explicit(
+            count, atomic_load_explicit(count, memory_order_relaxed) + 1,
+            memory_order_relaxed);
+    return error;
+}
+
+#else
+
+#define seagrass_instrumentation_record(function, error) (error)
+
+#endif /* SEAGRASS_INSTRUMENTATION */
+
+#endif /* _SEAGRASS_INSTRUMENTATION_PRIVATE_H_ */
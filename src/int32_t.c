@@ -0,0 +1,18 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "instrumentation.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define SEAGRASS_TEMPLATE_TYPE int32_t
+#define SEAGRASS_TEMPLATE_SIGNED 1
+#define SEAGRASS_TEMPLATE_MIN INT32_MIN
+#define SEAGRASS_TEMPLATE_MAX INT32_MAX
+#define SEAGRASS_TEMPLATE_FUNCTION(name) seagrass_int32_t_ ## name
+#define SEAGRASS_TEMPLATE_ERROR(name) SEAGRASS_INT32_T_ERROR_ ## name
+#define SEAGRASS_TEMPLATE_INSTRUMENTATION(name) \
+    SEAGRASS_INSTRUMENTATION_INT32_T_ ## name
+#include "integer_template.h"
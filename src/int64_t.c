@@ -0,0 +1,18 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "instrumentation.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define SEAGRASS_TEMPLATE_TYPE int64_t
+#define SEAGRASS_TEMPLATE_SIGNED 1
+#define SEAGRASS_TEMPLATE_MIN INT64_MIN
+#define SEAGRASS_TEMPLATE_MAX INT64_MAX
+#define SEAGRASS_TEMPLATE_FUNCTION(name) seagrass_int64_t_ ## name
+#define SEAGRASS_TEMPLATE_ERROR(name) SEAGRASS_INT64_T_ERROR_ ## name
+#define SEAGRASS_TEMPLATE_INSTRUMENTATION(name) \
+    SEAGRASS_INSTRUMENTATION_INT64_T_ ## name
+#include "integer_template.h"
@@ -0,0 +1,202 @@
+/*
+ * Checked integer arithmetic template.
+ *
+ * Define the following before including this file:
+ *  SEAGRASS_TEMPLATE_TYPE       integer type, e.g. uint32_t
+ *  SEAGRASS_TEMPLATE_SIGNED     1 if the type is signed, otherwise 0
+ *  SEAGRASS_TEMPLATE_MIN        smallest value of the type
+ *  SEAGRASS_TEMPLATE_MAX        largest value of the type
+ *  SEAGRASS_TEMPLATE_FUNCTION   maps a name to the function name, e.g.
+ *                               seagrass_uint32_t_ ## name
+ *  SEAGRASS_TEMPLATE_ERROR      maps a name to the error code, e.g.
+ *                               SEAGRASS_UINT32_T_ERROR_ ## name
+ *  SEAGRASS_TEMPLATE_INSTRUMENTATION
+ *                               maps a name to the instrumented function,
+ *                               e.g. SEAGRASS_INSTRUMENTATION_UINT32_T_ ## name
+ *
+ * The parameters are undefined at the end of this file.
+ */
+#if !defined(SEAGRASS_TEMPLATE_TYPE) || !defined(SEAGRASS_TEMPLATE_SIGNED) \
+    || !defined(SEAGRASS_TEMPLATE_MIN) || !defined(SEAGRASS_TEMPLATE_MAX) \
+    || !defined(SEAGRASS_TEMPLATE_FUNCTION) \
+    || !defined(SEAGRASS_TEMPLATE_ERROR) \
+    || !defined(SEAGRASS_TEMPLATE_INSTRUMENTATION)
+#error "integer template parameters are not defined"
+#endif
+
+#define T SEAGRASS_TEMPLATE_TYPE
+#define F SEAGRASS_TEMPLATE_FUNCTION
+#define E SEAGRASS_TEMPLATE_ERROR
+#define I SEAGRASS_TEMPLATE_INSTRUMENTATION
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SEAGRASS_TEMPLATE_BUILTIN
+#endif
+
+int F(ptr_compare)(const T *const a, const T *const b) {
+    seagrass_required_true(a || b);
+    if (!b) {
+        return (-1);
+    } else if (!a) {
+        return 1;
+    }
+    return F(compare)(*a, *b);
+}
+
+int F(compare)(const T a, const T b) {
+    if (a == b) {
+        return 0;
+    } else if (a > b) {
+        return 1;
+    }
+    return (-1);
+}
+
+int F(minimum)(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    *out = a < b ? a : b;
+    return 0;
+}
+
+int F(maximum)(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    *out = a > b ? a : b;
+    return 0;
+}
+
+static int checked_add(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    T c;
+#if defined(SEAGRASS_TEMPLATE_BUILTIN)
+    if (__builtin_add_overflow(a, b, &c)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+#elif SEAGRASS_TEMPLATE_SIGNED
+    if ((b > 0 && a > SEAGRASS_TEMPLATE_MAX - b)
+        || (b < 0 && a < SEAGRASS_TEMPLATE_MIN - b)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    c = a + b;
+#else
+    c = a + b;
+    if (c < a) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+#endif
+    *out = c;
+    return 0;
+}
+
+int F(add)(const T a, const T b, T *const out) {
+    return seagrass_instrumentation_record(I(ADD), checked_add(a, b, out));
+}
+
+static int checked_subtract(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    T c;
+#if defined(SEAGRASS_TEMPLATE_BUILTIN)
+    if (__builtin_sub_overflow(a, b, &c)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+#elif SEAGRASS_TEMPLATE_SIGNED
+    if ((b < 0 && a > SEAGRASS_TEMPLATE_MAX + b)
+        || (b > 0 && a < SEAGRASS_TEMPLATE_MIN + b)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    c = a - b;
+#else
+    if (a < b) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    c = a - b;
+#endif
+    *out = c;
+    return 0;
+}
+
+int F(subtract)(const T a, const T b, T *const out) {
+    return seagrass_instrumentation_record(I(SUBTRACT),
+                                          checked_subtract(a, b, out));
+}
+
+static int checked_multiply(const T a, const T b, T *const out) {
+    if (!out) {
+        return E(OUT_IS_NULL);
+    }
+    T c;
+#if defined(SEAGRASS_TEMPLATE_BUILTIN)
+    if (__builtin_mul_overflow(a, b, &c)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+#elif SEAGRASS_TEMPLATE_SIGNED
+    if (a > 0 ? (b > 0 ? a > SEAGRASS_TEMPLATE_MAX / b
+                       : b < SEAGRASS_TEMPLATE_MIN / a)
+              : (b > 0 ? a < SEAGRASS_TEMPLATE_MIN / b
+                       : a && b < SEAGRASS_TEMPLATE_MAX / a)) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+    c = a * b;
+#else
+    if (!a || !b) {
+        *out = 0;
+        return 0;
+    }
+    c = a * b;
+    if (c / a != b) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+#endif
+    *out = c;
+    return 0;
+}
+
+int F(multiply)(const T a, const T b, T *const out) {
+    return seagrass_instrumentation_record(I(MULTIPLY),
+                                          checked_multiply(a, b, out));
+}
+
+static int checked_divide(const T a, const T b, T *const quotient,
+                          T *const remainder) {
+    if (!quotient) {
+        return E(QUOTIENT_IS_NULL);
+    }
+    if (!b) {
+        return E(DIVIDE_BY_ZERO);
+    }
+#if SEAGRASS_TEMPLATE_SIGNED
+    if (SEAGRASS_TEMPLATE_MIN == a && -1 == b) {
+        return E(RESULT_IS_INCONSISTENT);
+    }
+#endif
+    *quotient = a / b;
+    if (remainder) {
+        *remainder = a % b;
+    }
+    return 0;
+}
+
+int F(divide)(const T a, const T b, T *const quotient, T *const remainder) {
+    return seagrass_instrumentation_record(
+            I(DIVIDE), checked_divide(a, b, quotient, remainder));
+}
+
+#undef SEAGRASS_TEMPLATE_BUILTIN
+#undef T
+#undef F
+#undef E
+#undef I
+#undef SEAGRASS_TEMPLATE_TYPE
+#undef SEAGRASS_TEMPLATE_SIGNED
+#undef SEAGRASS_TEMPLATE_MIN
+#undef SEAGRASS_TEMPLATE_MAX
+#undef SEAGRASS_TEMPLATE_FUNCTION
+#undef SEAGRASS_TEMPLATE_ERROR
+#undef SEAGRASS_TEMPLATE_INSTRUMENTATION
@@ -0,0 +1,26 @@
+#ifndef _SEAGRASS_KERNEL_H_
+#define _SEAGRASS_KERNEL_H_
+
+/* A kernel is the loop over an array of values that the compiler is meant
+ * to vectorize. Kernels are kept out of line so that their lanes stay in
+ * vector registers instead of being spilled around the checks of the
+ * calling function. Kernels whose output may overlap their input compute
+ * each group of lanes into an array of their own before storing it, as the
+ * compiler does not vectorize stores that might overlap values still to be
+ * loaded. */
+#if defined(__GNUC__) || defined(__clang__)
+#define SEAGRASS_KERNEL __attribute__((noinline))
+#else
+#define SEAGRASS_KERNEL
+#endif
+
+/* A lane computes a single value of a kernel and must be inlined into the
+ * kernel for it to be vectorized, which GCC declines to do for the larger
+ * lanes on its own. */
+#if defined(__GNUC__) || defined(__clang__)
+#define SEAGRASS_LANE static inline __attribute__((always_inline))
+#else
+#define SEAGRASS_LANE static inline
+#endif
+
+#endif /* _SEAGRASS_KERNEL_H_ */
@@ -0,0 +1,428 @@
+#include <stdlib.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "error_bound.h"
+#include "thread_pool.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* Number of values reduced by one task. The chunks must not depend on the
+ * number of threads, otherwise neither would the float results. */
+#define CHUNK ((uintmax_t) 1 << 14)
+/* Chunk results kept on the stack, larger inputs allocate them. */
+#define LOCAL 8
+#define LANES 8
+
+struct partial {
+    uintmax_t integer;
+    float real;
+    float bound;
+    int error;
+    /* NaN for float minimum and maximum, zero for products */
+    bool flag;
+};
+
+struct job {
+    const void *values;
+    uintmax_t count;
+    enum seagrass_float_summation summation;
+    struct partial *partials;
+};
+
+static uintmax_t chunk_count(const struct job *const job,
+                             const uintmax_t index) {
+    const uintmax_t remaining = job->count - index * CHUNK;
+    return remaining < CHUNK ? remaining : CHUNK;
+}
+
+static int reduce(struct job *const job,
+                  struct partial *const local,
+                  const seagrass_thread_pool_task task) {
+    const uintmax_t chunks = job->count / CHUNK + (job->count % CHUNK != 0);
+    if (chunks <= LOCAL) {
+        job->partials = local;
+    } else if (chunks > SIZE_MAX / sizeof(struct partial)
+               || !(job->partials = malloc(chunks * sizeof(struct partial)))) {
+        return SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    seagrass_thread_pool_for(chunks, task, job);
+    return 0;
+}
+
+static void release(const struct job *const job,
+                    const struct partial *const local) {
+    if (job->partials != local) {
+        free(job->partials);
+    }
+}
+
+static void uintmax_t_sum_task(void *const context, const uintmax_t index) {
+    const struct job *const job = context;
+    struct seagrass_uintmax_t_checked sum;
+    seagrass_uintmax_t_checked_init(&sum, 0);
+    seagrass_required_true(!seagrass_uintmax_t_checked_sum(
+            &sum,
+            (const uintmax_t *) job->values + index * CHUNK,
+            chunk_count(job, index)));
+    job->partials[index] = (struct partial) {
+            .integer = sum.value,
+            .flag = sum.overflow
+    };
+}
+
+int seagrass_parallel_uintmax_t_sum(const uintmax_t *const values,
+                                    const uintmax_t count,
+                                    uintmax_t *const out) {
+    if (!values && count) {
+        return SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL;
+    }
+    struct partial local[LOCAL];
+    struct job job = {.values = values, .count = count};
+    int error;
+    if ((error = reduce(&job, local, uintmax_t_sum_task))) {
+        return error;
+    }
+    struct seagrass_uintmax_t_checked sum;
+    seagrass_uintmax_t_checked_init(&sum, 0);
+    const uintmax_t chunks = count / CHUNK + (count % CHUNK != 0);
+    for (uintmax_t i = 0; i < chunks; i++) {
+        sum.overflow |= job.partials[i].flag;
+        seagrass_uintmax_t_checked_add(&sum, job.partials[i].integer);
+    }
+    release(&job, local);
+    if (sum.overflow) {
+        return SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = sum.value;
+    return 0;
+}
+
+/* Product of the values up to the first zero, a chunk containing a zero is
+ * flagged as such. As all the values before the first zero are at least one
+ * an overflow within a chunk implies that the total overflows too. */
+static void uintmax_t_product_task(void *const context,
+                                   const uintmax_t index) {
+    const struct job *const job = context;
+    const uintmax_t *const values = (const uintmax_t *) job->values
+                                    + index * CHUNK;
+    const uintmax_t count = chunk_count(job, index);
+    uintmax_t i = 0;
+    for (; i < count && values[i]; i++);
+    struct seagrass_uintmax_t_checked product;
+    seagrass_uintmax_t_checked_init(&product, 1);
+    seagrass_required_true(!seagrass_uintmax_t_checked_product(
+            &product, values, i));
+    job->partials[index] = (struct partial) {
+            .integer = product.value,
+            .error = product.overflow,
+            .flag = i < count
+    };
+}
+
+int seagrass_parallel_uintmax_t_product(const uintmax_t *const values,
+                                        const uintmax_t count,
+                                        uintmax_t *const out) {
+    if (!values && count) {
+        return SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL;
+    }
+    struct partial local[LOCAL];
+    struct job job = {.values = values, .count = count};
+    int error;
+    if ((error = reduce(&job, local, uintmax_t_product_task))) {
+        return error;
+    }
+    struct seagrass_uintmax_t_checked product;
+    seagrass_uintmax_t_checked_init(&product, 1);
+    const uintmax_t chunks = count / CHUNK + (count % CHUNK != 0);
+    for (uintmax_t i = 0; i < chunks; i++) {
+        product.overflow |= job.partials[i].error;
+        seagrass_uintmax_t_checked_multiply(&product,
+                                            job.partials[i].integer);
+        if (job.partials[i].flag) {
+            product.value = 0;
+            break;
+        }
+    }
+    release(&job, local);
+    if (product.overflow) {
+        return SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = product.value;
+    return 0;
+}
+
+#define UINTMAX_T_EXTREMUM(name, better) \
+static void uintmax_t_ ## name ## _task(void *const context, \
+                                        const uintmax_t index) { \
+    const struct job *const job = context; \
+    const uintmax_t *const values = (const uintmax_t *) job->values \
+                                    + index * CHUNK; \
+    const uintmax_t count = chunk_count(job, index); \
+    uintmax_t lanes[LANES]; \
+    for (uintmax_t j = 0; j < LANES; j++) { \
+        lanes[j] = values[0]; \
+    } \
+    uintmax_t i = 0; \
+    for (; i + LANES <= count; i += LANES) { \
+        for (uintmax_t j = 0; j < LANES; j++) { \
+            const uintmax_t value = values[i + j]; \
+            lanes[j] = value better lanes[j] ? value : lanes[j]; \
+        } \
+    } \
+    uintmax_t result = values[0]; \
+    for (uintmax_t j = 0; j < LANES; j++) { \
+        result = lanes[j] better result ? lanes[j] : result; \
+    } \
+    for (; i < count; i++) { \
+        result = values[i] better result ? values[i] : result; \
+    } \
+    job->partials[index] = (struct partial) {.integer = result}; \
+} \
+\
+int seagrass_parallel_uintmax_t_ ## name(const uintmax_t *const values, \
+                                         const uintmax_t count, \
+                                         uintmax_t *const out) { \
+    if (!values) { \
+        return SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL; \
+    } \
+    if (!count) { \
+        return SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO; \
+    } \
+    if (!out) { \
+        return SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL; \
+    } \
+    struct partial local[LOCAL]; \
+    struct job job = {.values = values, .count = count}; \
+    int error; \
+    if ((error = reduce(&job, local, uintmax_t_ ## name ## _task))) { \
+        return error; \
+    } \
+    uintmax_t result = job.partials[0].integer; \
+    const uintmax_t chunks = count / CHUNK + (count % CHUNK != 0); \
+    for (uintmax_t i = 1; i < chunks; i++) { \
+        const uintmax_t value = job.partials[i].integer; \
+        result = value better result ? value : result; \
+    } \
+    release(&job, local); \
+    *out = result; \
+    return 0; \
+}
+
+UINTMAX_T_EXTREMUM(minimum, <)
+
+UINTMAX_T_EXTREMUM(maximum, >)
+
+static void float_sum_task(void *const context, const uintmax_t index) {
+    const struct job *const job = context;
+    struct partial *const partial = &job->partials[index];
+    partial->error = seagrass_float_sum_n(
+            (const float *) job->values + index * CHUNK,
+            chunk_count(job, index),
+            job->summation,
+            &partial->real,
+            &partial->bound);
+}
+
+int seagrass_parallel_float_sum(const float *const values,
+                                const uintmax_t count,
+                                const enum seagrass_float_summation summation,
+                                float *const out,
+                                float *const error) {
+    if (!values && count) {
+        return SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL;
+    }
+    switch (summation & ~SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS) {
+        default: {
+            return SEAGRASS_PARALLEL_ERROR_SUMMATION_IS_INVALID;
+        }
+        case SEAGRASS_FLOAT_SUMMATION_COMPENSATED:
+        case SEAGRASS_FLOAT_SUMMATION_PAIRWISE:
+        case SEAGRASS_FLOAT_SUMMATION_DOUBLE: {
+            break;
+        }
+    }
+    if (count <= CHUNK) {
+        return seagrass_float_sum_n(values, count, summation, out, error);
+    }
+    const uintmax_t chunks = count / CHUNK + (count % CHUNK != 0);
+    float local_sums[LOCAL];
+    float *const sums = chunks <= LOCAL
+                        ? local_sums
+                        : malloc(chunks * sizeof(float));
+    if (!sums) {
+        return SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    struct partial local[LOCAL];
+    struct job job = {
+            .values = values,
+            .count = count,
+            .summation = summation
+    };
+    int result;
+    if ((result = reduce(&job, local, float_sum_task))) {
+        if (sums != local_sums) {
+            free(sums);
+        }
+        return result;
+    }
+    double bound = 0;
+    for (uintmax_t i = 0; i < chunks && !result; i++) {
+        result = job.partials[i].error;
+        bound += job.partials[i].bound;
+        sums[i] = job.partials[i].real;
+    }
+    release(&job, local);
+    float sum, last;
+    if (!result) {
+        result = seagrass_float_sum_n(sums, chunks, summation, &sum, &last);
+    }
+    if (sums != local_sums) {
+        free(sums);
+    }
+    if (result) {
+        return SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = sum;
+    if (error) {
+        /* the chunk sums are each off by at most their own bound */
+        *error = seagrass_round_up(bound + last);
+    }
+    return 0;
+}
+
+static void float_product_task(void *const context, const uintmax_t index) {
+    const struct job *const job = context;
+    const float *const values = (const float *) job->values + index * CHUNK;
+    const uintmax_t count = chunk_count(job, index);
+    float lanes[LANES] = {1, 1, 1, 1, 1, 1, 1, 1};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (uintmax_t j = 0; j < LANES; j++) {
+            lanes[j] *= values[i + j];
+        }
+    }
+    float product = 1;
+    for (uintmax_t j = 0; j < LANES; j++) {
+        product *= lanes[j];
+    }
+    for (; i < count; i++) {
+        product *= values[i];
+    }
+    job->partials[index] = (struct partial) {.real = product};
+}
+
+int seagrass_parallel_float_product(const float *const values,
+                                    const uintmax_t count,
+                                    float *const out) {
+    if (!values && count) {
+        return SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL;
+    }
+    struct partial local[LOCAL];
+    struct job job = {.values = values, .count = count};
+    int error;
+    if ((error = reduce(&job, local, float_product_task))) {
+        return error;
+    }
+    float product = 1;
+    const uintmax_t chunks = count / CHUNK + (count % CHUNK != 0);
+    for (uintmax_t i = 0; i < chunks; i++) {
+        product *= job.partials[i].real;
+    }
+    release(&job, local);
+    /* infinities and NaN propagate through the remaining multiplications,
+     * either as themselves or as NaN when multiplied by zero */
+    if (!isfinite(product)) {
+        return SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = product;
+    return 0;
+}
+
+#define FLOAT_EXTREMUM(name, better) \
+static void float_ ## name ## _task(void *const context, \
+                                    const uintmax_t index) { \
+    const struct job *const job = context; \
+    const float *const values = (const float *) job->values \
+                                + index * CHUNK; \
+    const uintmax_t count = chunk_count(job, index); \
+    float lanes[LANES]; \
+    bool nan[LANES] = {false}; \
+    for (uintmax_t j = 0; j < LANES; j++) { \
+        lanes[j] = values[0]; \
+    } \
+    uintmax_t i = 0; \
+    for (; i + LANES <= count; i += LANES) { \
+        for (uintmax_t j = 0; j < LANES; j++) { \
+            const float value = values[i + j]; \
+            lanes[j] = value better lanes[j] ? value : lanes[j]; \
+            nan[j] |= value != value; \
+        } \
+    } \
+    float result = values[0]; \
+    bool flag = result != result; \
+    for (uintmax_t j = 0; j < LANES; j++) { \
+        result = lanes[j] better result ? lanes[j] : result; \
+        flag |= nan[j]; \
+    } \
+    for (; i < count; i++) { \
+        result = values[i] better result ? values[i] : result; \
+        flag |= values[i] != values[i]; \
+    } \
+    job->partials[index] = (struct partial) { \
+            .real = result, \
+            .flag = flag \
+    }; \
+} \
+\
+int seagrass_parallel_float_ ## name(const float *const values, \
+                                     const uintmax_t count, \
+                                     float *const out) { \
+    if (!values) { \
+        return SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL; \
+    } \
+    if (!count) { \
+        return SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO; \
+    } \
+    if (!out) { \
+        return SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL; \
+    } \
+    struct partial local[LOCAL]; \
+    struct job job = {.values = values, .count = count}; \
+    int error; \
+    if ((error = reduce(&job, local, float_ ## name ## _task))) { \
+        return error; \
+    } \
+    float result = job.partials[0].real; \
+    bool flag = false; \
+    const uintmax_t chunks = count / CHUNK + (count % CHUNK != 0); \
+    for (uintmax_t i = 0; i < chunks; i++) { \
+        const float value = job.partials[i].real; \
+        result = value better result ? value : result; \
+        flag |= job.partials[i].flag; \
+    } \
+    release(&job, local); \
+    if (flag) { \
+        return SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT; \
+    } \
+    *out = result; \
+    return 0; \
+}
+
+FLOAT_EXTREMUM(minimum, <)
+
+FLOAT_EXTREMUM(maximum, >)
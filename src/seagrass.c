@@ -1,16 +1,48 @@
 #include <stdlib.h>
+#include <stdio.h>
+#include <stdatomic.h>
 #include <seagrass.h>
 
 #ifdef TEST
 #include <test/cmocka.h>
 #endif
 
-void seagrass_required(const void *object) {
-    seagrass_required_true(NULL != object);
+static _Atomic(seagrass_required_handler) handler;
+
+seagrass_required_handler seagrass_required_set_handler(
+        const seagrass_required_handler value) {
+    return atomic_exchange(&handler, value);
+}
+
+static void report(const char *const file, const int line,
+                   const char *const expression) {
+    const seagrass_required_handler hook = atomic_load(&handler);
+    if (hook) {
+        hook(file, line, expression);
+    } else if (file) {
+        fprintf(stderr, "%s:%d: requirement failed: %s\n",
+                file, line, expression);
+    } else {
+        fprintf(stderr, "requirement failed: %s\n", expression);
+    }
+}
+
+void seagrass_required_failed(const char *const file, const int line,
+                              const char *const expression) {
+    report(file, line, expression);
+    abort();
+}
+
+void (seagrass_required)(const void *object) {
+    if (!object) {
+        report(NULL, 0, "object is NULL");
+        abort();
+    }
 }
 
-void seagrass_required_true(const int check) {
+void (seagrass_required_true)(const int check) {
     if (!check) {
+        report(NULL, 0, "check");
         abort();
     }
 }
@@ -0,0 +1,18 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "instrumentation.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define SEAGRASS_TEMPLATE_TYPE size_t
+#define SEAGRASS_TEMPLATE_SIGNED 0
+#define SEAGRASS_TEMPLATE_MIN 0
+#define SEAGRASS_TEMPLATE_MAX SIZE_MAX
+#define SEAGRASS_TEMPLATE_FUNCTION(name) seagrass_size_t_ ## name
+#define SEAGRASS_TEMPLATE_ERROR(name) SEAGRASS_SIZE_T_ERROR_ ## name
+#define SEAGRASS_TEMPLATE_INSTRUMENTATION(name) \
+    SEAGRASS_INSTRUMENTATION_SIZE_T_ ## name
+#include "integer_template.h"
@@ -0,0 +1,246 @@
+#include <stdlib.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "kernel.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define LANES 8
+/* Samples summarized before they are merged into the accumulator, small
+ * enough for the second pass over them to hit the cache. */
+#define BLOCK 1024
+
+int seagrass_stats_init(struct seagrass_stats *const object) {
+    if (!object) {
+        return SEAGRASS_STATS_ERROR_OBJECT_IS_NULL;
+    }
+    *object = (struct seagrass_stats) {0};
+    return 0;
+}
+
+/* Welford's update. */
+static void add(struct seagrass_stats *const object, const double value) {
+    object->count++;
+    const double delta = value - object->mean;
+    object->mean += delta / (double) object->count;
+    object->m2 += delta * (value - object->mean);
+    if (object->count == 1) {
+        object->minimum = object->maximum = value;
+    } else {
+        object->minimum = value < object->minimum ? value : object->minimum;
+        object->maximum = value > object->maximum ? value : object->maximum;
+    }
+}
+
+/* Chan, Golub and LeVeque's pairwise update. */
+static void merge(struct seagrass_stats *const object,
+                  const struct seagrass_stats *const other) {
+    if (!other->count) {
+        return;
+    }
+    if (!object->count) {
+        *object = *other;
+        return;
+    }
+    const double a = (double) object->count;
+    const double b = (double) other->count;
+    const double n = a + b;
+    const double delta = other->mean - object->mean;
+    object->count += other->count;
+    object->mean += delta * (b / n);
+    object->m2 += other->m2 + delta * delta * (a * b / n);
+    object->minimum = other->minimum < object->minimum
+                      ? other->minimum : object->minimum;
+    object->maximum = other->maximum > object->maximum
+                      ? other->maximum : object->maximum;
+}
+
+/* Corrected two-pass algorithm. The first pass yields the mean, the second
+ * sums the deviations from it whose sum, zero were it not for rounding,
+ * corrects both the mean and the sum of their squares. */
+#define MOMENTS(name, type) \
+SEAGRASS_KERNEL \
+static void name(const type *const values, const uintmax_t count, \
+                 struct seagrass_stats *const out) { \
+    double sum[LANES] = {0}; \
+    uintmax_t i = 0; \
+    for (; i + LANES <= count; i += LANES) { \
+        for (uintmax_t j = 0; j < LANES; j++) { \
+            sum[j] += (double) values[i + j]; \
+        } \
+    } \
+    for (; i < count; i++) { \
+        sum[0] += (double) values[i]; \
+    } \
+    double total = 0; \
+    for (uintmax_t j = 0; j < LANES; j++) { \
+        total += sum[j]; \
+    } \
+    const double mean = total / (double) count; \
+    double deviation[LANES] = {0}; \
+    double square[LANES] = {0}; \
+    for (i = 0; i + LANES <= count; i += LANES) { \
+        for (uintmax_t j = 0; j < LANES; j++) { \
+            const double d = (double) values[i + j] - mean; \
+            deviation[j] += d; \
+            square[j] += d * d; \
+        } \
+    } \
+    for (; i < count; i++) { \
+        const double d = (double) values[i] - mean; \
+        deviation[0] += d; \
+        square[0] += d * d; \
+    } \
+    double deviations = 0; \
+    double squares = 0; \
+    for (uintmax_t j = 0; j < LANES; j++) { \
+        deviations += deviation[j]; \
+        squares += square[j]; \
+    } \
+    out->count = count; \
+    out->mean = mean + deviations / (double) count; \
+    out->m2 = squares - deviations * deviations / (double) count; \
+}
+
+MOMENTS(uintmax_t_moments, uintmax_t)
+
+MOMENTS(float_moments, float)
+
+int seagrass_stats_add_uintmax_t(struct seagrass_stats *const object,
+                                 const uintmax_t value) {
+    if (!object) {
+        return SEAGRASS_STATS_ERROR_OBJECT_IS_NULL;
+    }
+    if (object->count == UINTMAX_MAX) {
+        return SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    add(object, (double) value);
+    return 0;
+}
+
+int seagrass_stats_add_uintmax_t_n(struct seagrass_stats *const object,
+                                   const uintmax_t *const values,
+                                   const uintmax_t count) {
+    if (!object) {
+        return SEAGRASS_STATS_ERROR_OBJECT_IS_NULL;
+    }
+    if (!values && count) {
+        return SEAGRASS_STATS_ERROR_VALUES_IS_NULL;
+    }
+    if (count > UINTMAX_MAX - object->count) {
+        return SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    for (uintmax_t i = 0; i < count; i += BLOCK) {
+        const uintmax_t n = count - i < BLOCK ? count - i : BLOCK;
+        struct seagrass_stats block;
+        uintmax_t minimum, maximum;
+        seagrass_required_true(!seagrass_uintmax_t_minmax_n(
+                values + i, n, &minimum, NULL, &maximum, NULL));
+        uintmax_t_moments(values + i, n, &block);
+        block.minimum = (double) minimum;
+        block.maximum = (double) maximum;
+        merge(object, &block);
+    }
+    return 0;
+}
+
+int seagrass_stats_add_float(struct seagrass_stats *const object,
+                             const float value) {
+    if (!object) {
+        return SEAGRASS_STATS_ERROR_OBJECT_IS_NULL;
+    }
+    if (object->count == UINTMAX_MAX || !isfinite(value)) {
+        return SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    add(object, value);
+    return 0;
+}
+
+int seagrass_stats_add_float_n(struct seagrass_stats *const object,
+                               const float *const values,
+                               const uintmax_t count) {
+    if (!object) {
+        return SEAGRASS_STATS_ERROR_OBJECT_IS_NULL;
+    }
+    if (!values && count) {
+        return SEAGRASS_STATS_ERROR_VALUES_IS_NULL;
+    }
+    if (count > UINTMAX_MAX - object->count) {
+        return SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    /* accumulate separately so that a sample that is not finite leaves the
+     * accumulator unchanged */
+    struct seagrass_stats result = *object;
+    for (uintmax_t i = 0; i < count; i += BLOCK) {
+        const uintmax_t n = count - i < BLOCK ? count - i : BLOCK;
+        struct seagrass_stats block;
+        float minimum, maximum;
+        if (seagrass_float_minmax_n(values + i, n, &minimum, NULL,
+                                    &maximum, NULL)
+            || isinf(minimum) || isinf(maximum)) {
+            return SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT;
+        }
+        float_moments(values + i, n, &block);
+        block.minimum = minimum;
+        block.maximum = maximum;
+        merge(&result, &block);
+    }
+    *object = result;
+    return 0;
+}
+
+int seagrass_stats_merge(struct seagrass_stats *const object,
+                         const struct seagrass_stats *const other) {
+    if (!object) {
+        return SEAGRASS_STATS_ERROR_OBJECT_IS_NULL;
+    }
+    if (!other) {
+        return SEAGRASS_STATS_ERROR_OTHER_IS_NULL;
+    }
+    if (other->count > UINTMAX_MAX - object->count) {
+        return SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    merge(object, other);
+    return 0;
+}
+
+int seagrass_stats_count(const struct seagrass_stats *const object,
+                         uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_STATS_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_STATS_ERROR_OUT_IS_NULL;
+    }
+    *out = object->count;
+    return 0;
+}
+
+#define GETTER(name, minimum_count, expression) \
+int seagrass_stats_ ## name(const struct seagrass_stats *const object, \
+                            double *const out) { \
+    if (!object) { \
+        return SEAGRASS_STATS_ERROR_OBJECT_IS_NULL; \
+    } \
+    if (!out) { \
+        return SEAGRASS_STATS_ERROR_OUT_IS_NULL; \
+    } \
+    if (object->count < (minimum_count)) { \
+        return SEAGRASS_STATS_ERROR_COUNT_IS_ZERO; \
+    } \
+    *out = (expression); \
+    return 0; \
+}
+
+GETTER(mean, 1, object->mean)
+
+GETTER(variance, 1, object->m2 / (double) object->count)
+
+GETTER(sample_variance, 2, object->m2 / (double) (object->count - 1))
+
+GETTER(minimum, 1, object->minimum)
+
+GETTER(maximum, 1, object->maximum)
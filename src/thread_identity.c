@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <seagrass.h>
+
+#include "thread_identity.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* The identity of the calling thread plus one, zero until assigned. */
+static _Thread_local uintmax_t identity;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static pthread_key_t key;
+static bool taken[SEAGRASS_THREAD_IDENTITY_MAXIMUM];
+
+static void release(void *const value) {
+    seagrass_required_true(!pthread_mutex_lock(&lock));
+    taken[(uintptr_t) value - 1] = false;
+    seagrass_required_true(!pthread_mutex_unlock(&lock));
+}
+
+static void initialize(void) {
+    seagrass_required_true(!pthread_key_create(&key, release));
+}
+
+static void assign(void) {
+    seagrass_required_true(!pthread_once(&once, initialize));
+    seagrass_required_true(!pthread_mutex_lock(&lock));
+    uintmax_t i = 0;
+    for (; i < SEAGRASS_THREAD_IDENTITY_MAXIMUM && taken[i]; i++);
+    if (i < SEAGRASS_THREAD_IDENTITY_MAXIMUM) {
+        taken[i] = true;
+    }
+    seagrass_required_true(!pthread_mutex_unlock(&lock));
+    if (i == SEAGRASS_THREAD_IDENTITY_MAXIMUM) {
+        identity = SEAGRASS_THREAD_IDENTITY_NONE + 1;
+        return;
+    }
+    identity = i + 1;
+    /* released by the destructor of the key as the thread exits */
+    seagrass_required_true(!pthread_setspecific(
+            key, (void *) (uintptr_t) identity));
+}
+
+uintmax_t seagrass_thread_identity(void) {
+    if (!identity) {
+        assign();
+    }
+    return identity - 1;
+}
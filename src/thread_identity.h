@@ -0,0 +1,26 @@
+#ifndef _SEAGRASS_THREAD_IDENTITY_H_
+#define _SEAGRASS_THREAD_IDENTITY_H_
+
+#include <stdint.h>
+
+#define SEAGRASS_THREAD_IDENTITY_MAXIMUM 1024
+/* Identity of a thread started while all the others are in use. It is above
+ * any number of shards, so that such threads always fall back to a shared
+ * shard, and stays below UINTMAX_MAX, so that callers can keep it plus one
+ * in a thread local that is zero until assigned. */
+#define SEAGRASS_THREAD_IDENTITY_NONE (UINTMAX_MAX - 1)
+
+/**
+ * @brief Identity of the calling thread.
+ * <p>A thread is handed the lowest identity not in use on its first call and
+ * gives it back when it exits, which keeps the identities below the number
+ * of threads using them at once. Per-thread shards can hence be indexed by
+ * identity.</p>
+ * @return identity below SEAGRASS_THREAD_IDENTITY_MAXIMUM, or
+ * SEAGRASS_THREAD_IDENTITY_NONE if all of them are in use.
+ * @note Callers on a fast path should keep the identity in a thread local of
+ * their own.
+ */
+uintmax_t seagrass_thread_identity(void);
+
+#endif /* _SEAGRASS_THREAD_IDENTITY_H_ */
@@ -0,0 +1,213 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <seagrass.h>
+
+#include "thread_pool.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+struct range {
+    pthread_mutex_t lock;
+    uintmax_t begin;
+    uintmax_t end;
+    /* keep the ranges of different threads on different cache lines */
+    char padding[64];
+};
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    /* held by the thread that is currently running a job */
+    pthread_mutex_t busy;
+    unsigned int concurrency;
+    unsigned int threads;
+    unsigned int participants;
+    unsigned int pending;
+    uintmax_t generation;
+    /* last generation each worker has seen */
+    uintmax_t seen[SEAGRASS_THREAD_POOL_MAXIMUM];
+    seagrass_thread_pool_task task;
+    void *context;
+    struct range ranges[SEAGRASS_THREAD_POOL_MAXIMUM];
+} pool = {
+        .lock = PTHREAD_MUTEX_INITIALIZER,
+        .work = PTHREAD_COND_INITIALIZER,
+        .done = PTHREAD_COND_INITIALIZER,
+        .busy = PTHREAD_MUTEX_INITIALIZER
+};
+
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+static void initialize(void) {
+    for (unsigned int i = 0; i < SEAGRASS_THREAD_POOL_MAXIMUM; i++) {
+        seagrass_required_true(!pthread_mutex_init(&pool.ranges[i].lock,
+                                                   NULL));
+    }
+}
+
+static unsigned int clamp(const long concurrency) {
+    if (concurrency < 1) {
+        return 1;
+    } else if (concurrency > SEAGRASS_THREAD_POOL_MAXIMUM) {
+        return SEAGRASS_THREAD_POOL_MAXIMUM;
+    }
+    return (unsigned int) concurrency;
+}
+
+static bool take(struct range *const range, uintmax_t *const index) {
+    seagrass_required_true(!pthread_mutex_lock(&range->lock));
+    const bool result = range->begin < range->end;
+    if (result) {
+        *index = range->begin++;
+    }
+    seagrass_required_true(!pthread_mutex_unlock(&range->lock));
+    return result;
+}
+
+static bool steal(const unsigned int id, const unsigned int participants,
+                  uintmax_t *const index) {
+    for (unsigned int i = 1; i < participants; i++) {
+        struct range *const victim = &pool.ranges[(id + i) % participants];
+        seagrass_required_true(!pthread_mutex_lock(&victim->lock));
+        const uintmax_t end = victim->end;
+        const uintmax_t remaining = end - victim->begin;
+        const uintmax_t middle = victim->begin + remaining / 2;
+        if (remaining) {
+            victim->end = middle;
+        }
+        seagrass_required_true(!pthread_mutex_unlock(&victim->lock));
+        if (!remaining) {
+            continue;
+        }
+        struct range *const own = &pool.ranges[id];
+        seagrass_required_true(!pthread_mutex_lock(&own->lock));
+        own->begin = middle + 1;
+        own->end = end;
+        seagrass_required_true(!pthread_mutex_unlock(&own->lock));
+        *index = middle;
+        return true;
+    }
+    return false;
+}
+
+static void participate(const unsigned int id,
+                        const unsigned int participants,
+                        const seagrass_thread_pool_task task,
+                        void *const context) {
+    uintmax_t index;
+    while (take(&pool.ranges[id], &index)
+           || steal(id, participants, &index)) {
+        task(context, index);
+    }
+}
+
+static void *worker(void *const argument) {
+    const unsigned int id = (unsigned int) (uintptr_t) argument;
+    seagrass_required_true(!pthread_mutex_lock(&pool.lock));
+    for (;;) {
+        while (pool.seen[id] == pool.generation) {
+            seagrass_required_true(!pthread_cond_wait(&pool.work,
+                                                      &pool.lock));
+        }
+        pool.seen[id] = pool.generation;
+        if (id >= pool.participants) {
+            continue;
+        }
+        const unsigned int participants = pool.participants;
+        const seagrass_thread_pool_task task = pool.task;
+        void *const context = pool.context;
+        seagrass_required_true(!pthread_mutex_unlock(&pool.lock));
+        participate(id, participants, task, context);
+        seagrass_required_true(!pthread_mutex_lock(&pool.lock));
+        if (!--pool.pending) {
+            seagrass_required_true(!pthread_cond_signal(&pool.done));
+        }
+    }
+    return NULL;
+}
+
+/* Start workers until there are enough for the given participants, the
+ * calling thread being participant 0. Returns the participants that can be
+ * served should a thread fail to start. */
+static unsigned int start(const unsigned int participants) {
+    pthread_attr_t attributes;
+    seagrass_required_true(!pthread_attr_init(&attributes));
+    seagrass_required_true(!pthread_attr_setdetachstate(
+            &attributes, PTHREAD_CREATE_DETACHED));
+    while (pool.threads + 1 < participants) {
+        pthread_t thread;
+        const uintptr_t id = pool.threads + 1;
+        /* the job about to be published is the first one it is to serve */
+        pool.seen[id] = pool.generation;
+        if (pthread_create(&thread, &attributes, worker, (void *) id)) {
+            break;
+        }
+        pool.threads++;
+    }
+    seagrass_required_true(!pthread_attr_destroy(&attributes));
+    return pool.threads + 1 < participants ? pool.threads + 1 : participants;
+}
+
+void seagrass_thread_pool_for(const uintmax_t count,
+                              const seagrass_thread_pool_task task,
+                              void *const context) {
+    seagrass_required(task);
+    if (!count) {
+        return;
+    }
+    seagrass_required_true(!pthread_once(&once, initialize));
+    unsigned int participants = seagrass_thread_pool_get_concurrency();
+    if (participants > count) {
+        participants = (unsigned int) count;
+    }
+    if (participants < 2 || pthread_mutex_trylock(&pool.busy)) {
+        for (uintmax_t i = 0; i < count; i++) {
+            task(context, i);
+        }
+        return;
+    }
+    seagrass_required_true(!pthread_mutex_lock(&pool.lock));
+    participants = start(participants);
+    const uintmax_t share = count / participants;
+    const uintmax_t extra = count % participants;
+    uintmax_t begin = 0;
+    for (unsigned int i = 0; i < participants; i++) {
+        struct range *const range = &pool.ranges[i];
+        range->begin = begin;
+        range->end = begin += share + (i < extra);
+    }
+    pool.participants = participants;
+    pool.pending = participants - 1;
+    pool.task = task;
+    pool.context = context;
+    pool.generation++;
+    seagrass_required_true(!pthread_cond_broadcast(&pool.work));
+    seagrass_required_true(!pthread_mutex_unlock(&pool.lock));
+    participate(0, participants, task, context);
+    seagrass_required_true(!pthread_mutex_lock(&pool.lock));
+    while (pool.pending) {
+        seagrass_required_true(!pthread_cond_wait(&pool.done, &pool.lock));
+    }
+    seagrass_required_true(!pthread_mutex_unlock(&pool.lock));
+    seagrass_required_true(!pthread_mutex_unlock(&pool.busy));
+}
+
+void seagrass_thread_pool_set_concurrency(const unsigned int concurrency) {
+    seagrass_required_true(!pthread_mutex_lock(&pool.lock));
+    pool.concurrency = concurrency ? clamp(concurrency) : 0;
+    seagrass_required_true(!pthread_mutex_unlock(&pool.lock));
+}
+
+unsigned int seagrass_thread_pool_get_concurrency(void) {
+    seagrass_required_true(!pthread_mutex_lock(&pool.lock));
+    const unsigned int concurrency = pool.concurrency
+                                     ? pool.concurrency
+                                     : clamp(sysconf(_SC_NPROCESSORS_ONLN));
+    seagrass_required_true(!pthread_mutex_unlock(&pool.lock));
+    return concurrency;
+}
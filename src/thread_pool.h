@@ -0,0 +1,47 @@
+#ifndef _SEAGRASS_THREAD_POOL_H_
+#define _SEAGRASS_THREAD_POOL_H_
+
+#include <stdint.h>
+
+#define SEAGRASS_THREAD_POOL_MAXIMUM 64
+
+/**
+ * @brief Task invoked once for each index of a range.
+ * @param [in] context given to seagrass_thread_pool_for().
+ * @param [in] index of the task.
+ */
+typedef void (*seagrass_thread_pool_task)(void *context, uintmax_t index);
+
+/**
+ * @brief Invoke task for every index in [0, count).
+ * <p>The process wide pool is started on first use. The indexes are split
+ * evenly between the participating threads, the calling thread being one of
+ * them, and a thread that runs out of indexes steals the upper half of the
+ * remaining indexes of another.</p>
+ * @param [in] count number of indexes.
+ * @param [in] task to invoke for each index.
+ * @param [in] context passed on to task.
+ * @note The order in which the indexes are processed is unspecified, results
+ * should therefore be stored by index and combined afterwards.
+ * @note If the pool is already busy, for instance when called from within a
+ * task, then the calling thread processes all the indexes itself.
+ */
+void seagrass_thread_pool_for(uintmax_t count,
+                              seagrass_thread_pool_task task,
+                              void *context);
+
+/**
+ * @brief Set the number of threads participating in seagrass_thread_pool_for.
+ * @param [in] concurrency number of threads including the calling thread,
+ * <i>0</i> restores the default of one per online processor.
+ * @note Values are clamped to [1, SEAGRASS_THREAD_POOL_MAXIMUM].
+ */
+void seagrass_thread_pool_set_concurrency(unsigned int concurrency);
+
+/**
+ * @brief Number of threads participating in seagrass_thread_pool_for.
+ * @return number of threads including the calling thread.
+ */
+unsigned int seagrass_thread_pool_get_concurrency(void);
+
+#endif /* _SEAGRASS_THREAD_POOL_H_ */
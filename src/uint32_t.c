@@ -0,0 +1,18 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "instrumentation.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define SEAGRASS_TEMPLATE_TYPE uint32_t
+#define SEAGRASS_TEMPLATE_SIGNED 0
+#define SEAGRASS_TEMPLATE_MIN 0
+#define SEAGRASS_TEMPLATE_MAX UINT32_MAX
+#define SEAGRASS_TEMPLATE_FUNCTION(name) seagrass_uint32_t_ ## name
+#define SEAGRASS_TEMPLATE_ERROR(name) SEAGRASS_UINT32_T_ERROR_ ## name
+#define SEAGRASS_TEMPLATE_INSTRUMENTATION(name) \
+    SEAGRASS_INSTRUMENTATION_UINT32_T_ ## name
+#include "integer_template.h"
@@ -1,124 +1,298 @@
 #include <stdlib.h>
 #include <seagrass.h>
 
+#include "bits.h"
+#include "kernel.h"
+#include "instrumentation.h"
+
 #ifdef TEST
 #include <test/cmocka.h>
 #endif
 
-int seagrass_uintmax_t_ptr_compare(const uintmax_t *a, const uintmax_t *b) {
-    seagrass_required_true(a || b);
-    if (!b) {
-        return (-1);
-    } else if (!a) {
-        return 1;
+#define SEAGRASS_TEMPLATE_TYPE uintmax_t
+#define SEAGRASS_TEMPLATE_SIGNED 0
+#define SEAGRASS_TEMPLATE_MIN 0
+#define SEAGRASS_TEMPLATE_MAX UINTMAX_MAX
+#define SEAGRASS_TEMPLATE_FUNCTION(name) seagrass_uintmax_t_ ## name
+#define SEAGRASS_TEMPLATE_ERROR(name) SEAGRASS_UINTMAX_T_ERROR_ ## name
+#define SEAGRASS_TEMPLATE_INSTRUMENTATION(name) \
+    SEAGRASS_INSTRUMENTATION_UINTMAX_T_ ## name
+#include "integer_template.h"
+
+int seagrass_uintmax_t_times_and_a_half_even(const uintmax_t current,
+                                             uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
     }
-    return seagrass_uintmax_t_compare(*a, *b);
+    /* increase capacity by times and a half and then use the next even
+     * number */
+    uintmax_t i = current >> 1;
+    /* even numbers */
+    if ((current & 1) ^ (i & 1)) {
+        i += 1;
+    }
+    *out = current ? seagrass_uintmax_t_saturating_add(current, i) : 2;
+    return 0;
 }
 
-int seagrass_uintmax_t_compare(const uintmax_t a, const uintmax_t b) {
-    if (a == b) {
-        return 0;
-    } else if (a > b) {
-        return 1;
+/* Lanes of the array reductions. Thirty-two of them give the compiler
+ * enough independent work to fill several vector registers. */
+#define LANES 32
+/* Values reduced between updates of the running extremes. The index of an
+ * extreme is only searched for within the block that holds it. */
+#define BLOCK 1024
+
+struct extremes {
+    uintmax_t minimum;
+    uintmax_t maximum;
+};
+
+/* count is a nonzero multiple of LANES. */
+static inline struct extremes lanes(const uintmax_t *const values,
+                                    const uintmax_t count,
+                                    const bool minimum,
+                                    const bool maximum) {
+    uintmax_t low[LANES];
+    uintmax_t high[LANES];
+    for (uintmax_t j = 0; j < LANES; j++) {
+        low[j] = values[j];
+        high[j] = values[j];
+    }
+    for (uintmax_t i = LANES; i < count; i += LANES) {
+        for (uintmax_t j = 0; j < LANES; j++) {
+            const uintmax_t value = values[i + j];
+            if (minimum) {
+                low[j] = value < low[j] ? value : low[j];
+            }
+            if (maximum) {
+                high[j] = value > high[j] ? value : high[j];
+            }
+        }
     }
-    return (-1);
+    struct extremes result = {low[0], high[0]};
+    for (uintmax_t j = 1; j < LANES; j++) {
+        result.minimum = low[j] < result.minimum ? low[j] : result.minimum;
+        result.maximum = high[j] > result.maximum ? high[j] : result.maximum;
+    }
+    return result;
 }
 
-int seagrass_uintmax_t_minimum(const uintmax_t a, const uintmax_t b,
-                               uintmax_t *const out) {
-    if (!out) {
-        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+SEAGRASS_KERNEL
+static struct extremes lanes_minimum(const uintmax_t *const values,
+                                     const uintmax_t count) {
+    return lanes(values, count, true, false);
+}
+
+SEAGRASS_KERNEL
+static struct extremes lanes_maximum(const uintmax_t *const values,
+                                     const uintmax_t count) {
+    return lanes(values, count, false, true);
+}
+
+SEAGRASS_KERNEL
+static struct extremes lanes_minmax(const uintmax_t *const values,
+                                    const uintmax_t count) {
+    return lanes(values, count, true, true);
+}
+
+/* Only the requested extremes of the result are valid. */
+static struct extremes extremes(const uintmax_t *const values,
+                                const uintmax_t count,
+                                const bool minimum,
+                                const bool maximum,
+                                uintmax_t *const minimum_index,
+                                uintmax_t *const maximum_index) {
+    struct extremes result = {values[0], values[0]};
+    uintmax_t low = 0;
+    uintmax_t high = 0;
+    for (uintmax_t i = 0; i < count; i += BLOCK) {
+        const uintmax_t n = count - i < BLOCK ? count - i : BLOCK;
+        const uintmax_t m = n - n % LANES;
+        struct extremes block = {values[i], values[i]};
+        if (m) {
+            block = minimum
+                    ? maximum
+                      ? lanes_minmax(values + i, m)
+                      : lanes_minimum(values + i, m)
+                    : lanes_maximum(values + i, m);
+        }
+        for (uintmax_t j = m; j < n; j++) {
+            const uintmax_t value = values[i + j];
+            block.minimum = value < block.minimum ? value : block.minimum;
+            block.maximum = value > block.maximum ? value : block.maximum;
+        }
+        if (block.minimum < result.minimum) {
+            result.minimum = block.minimum;
+            low = i;
+        }
+        if (block.maximum > result.maximum) {
+            result.maximum = block.maximum;
+            high = i;
+        }
     }
-    *out = a < b ? a : b;
-    return 0;
+    if (minimum && minimum_index) {
+        for (; values[low] != result.minimum; low++);
+        *minimum_index = low;
+    }
+    if (maximum && maximum_index) {
+        for (; values[high] != result.maximum; high++);
+        *maximum_index = high;
+    }
+    return result;
 }
 
-int seagrass_uintmax_t_maximum(const uintmax_t a, const uintmax_t b,
-                               uintmax_t *const out) {
+int seagrass_uintmax_t_minimum_n(const uintmax_t *const values,
+                                 const uintmax_t count,
+                                 uintmax_t *const out,
+                                 uintmax_t *const index) {
+    if (!values) {
+        return SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL;
+    }
+    if (!count) {
+        return SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO;
+    }
     if (!out) {
         return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
     }
-    *out = a > b ? a : b;
+    *out = extremes(values, count, true, false, index, NULL).minimum;
     return 0;
 }
 
-int seagrass_uintmax_t_add(const uintmax_t a, const uintmax_t b,
-                           uintmax_t *const out) {
+int seagrass_uintmax_t_maximum_n(const uintmax_t *const values,
+                                 const uintmax_t count,
+                                 uintmax_t *const out,
+                                 uintmax_t *const index) {
+    if (!values) {
+        return SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL;
+    }
+    if (!count) {
+        return SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO;
+    }
     if (!out) {
         return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
     }
-    const uintmax_t c = a + b;
-    if (c < a) {
-        return SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT;
-    }
-    *out = c;
+    *out = extremes(values, count, false, true, NULL, index).maximum;
     return 0;
 }
 
-int seagrass_uintmax_t_subtract(const uintmax_t a, const uintmax_t b,
-                                uintmax_t *const out) {
-    if (!out) {
-        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+int seagrass_uintmax_t_minmax_n(const uintmax_t *const values,
+                                const uintmax_t count,
+                                uintmax_t *const minimum,
+                                uintmax_t *const minimum_index,
+                                uintmax_t *const maximum,
+                                uintmax_t *const maximum_index) {
+    if (!values) {
+        return SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL;
     }
-    if (a < b) {
-        return SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT;
+    if (!count) {
+        return SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO;
+    }
+    if (!minimum || !maximum) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
     }
-    *out = a - b;
+    const struct extremes result = extremes(values, count, true, true,
+                                            minimum_index, maximum_index);
+    *minimum = result.minimum;
+    *maximum = result.maximum;
     return 0;
 }
 
-int seagrass_uintmax_t_multiply(const uintmax_t a, const uintmax_t b,
-                                uintmax_t *const out) {
-    if (!out) {
-        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+/* A value is outside of [minimum, maximum] if its distance above minimum,
+ * which wraps around for values below it, exceeds the width of the range. */
+static inline bool out_of_range(const uintmax_t value,
+                                const uintmax_t minimum,
+                                const uintmax_t width) {
+    return value - minimum > width;
+}
+
+/* Returns whether any of the values is outside of the range. */
+SEAGRASS_KERNEL
+static bool any_out_of_range(const uintmax_t *const values,
+                             const uintmax_t count,
+                             const uintmax_t minimum,
+                             const uintmax_t width) {
+    uint8_t found[LANES] = {0};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (uintmax_t j = 0; j < LANES; j++) {
+            found[j] |= out_of_range(values[i + j], minimum, width);
+        }
     }
-    if (!a || !b) {
-        *out = 0;
-        return 0;
+    uint8_t result = 0;
+    for (; i < count; i++) {
+        result |= out_of_range(values[i], minimum, width);
     }
-    const uintmax_t c = a * b;
-    if (c / a != b) {
-        return SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT;
+    for (uintmax_t j = 0; j < LANES; j++) {
+        result |= found[j];
     }
-    *out = c;
-    return 0;
+    return result;
+}
+
+/* A byte per value first, which vectorizes as plain compares with a loop of
+ * constant length, and then the bytes gathered into the word. */
+static inline uint64_t out_of_range_word(const uintmax_t *const values,
+                                         const uintmax_t minimum,
+                                         const uintmax_t width) {
+    uint8_t lanes[64];
+    for (unsigned int j = 0; j < 64; j++) {
+        lanes[j] = out_of_range(values[j], minimum, width);
+    }
+    return seagrass_bits_gather(lanes);
 }
 
-int seagrass_uintmax_t_divide(const uintmax_t a, const uintmax_t b,
-                              uintmax_t *const quotient,
-                              uintmax_t *const remainder) {
-    if (!quotient) {
-        return SEAGRASS_UINTMAX_T_ERROR_QUOTIENT_IS_NULL;
+int seagrass_uintmax_t_find_out_of_range_n(const uintmax_t *const values,
+                                           const uintmax_t count,
+                                           const uintmax_t minimum,
+                                           const uintmax_t maximum,
+                                           uintmax_t *const out) {
+    if (!values && count) {
+        return SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
     }
-    if (!b) {
-        return SEAGRASS_UINTMAX_T_ERROR_DIVIDE_BY_ZERO;
+    if (minimum > maximum) {
+        return SEAGRASS_UINTMAX_T_ERROR_RANGE_IS_INVALID;
     }
-    *quotient = a / b;
-    if (remainder) {
-        *remainder = a % b;
+    const uintmax_t width = maximum - minimum;
+    for (uintmax_t i = 0; i < count; i += BLOCK) {
+        const uintmax_t n = count - i < BLOCK ? count - i : BLOCK;
+        if (any_out_of_range(values + i, n, minimum, width)) {
+            for (; !out_of_range(values[i], minimum, width); i++);
+            *out = i;
+            return 0;
+        }
     }
+    *out = count;
     return 0;
 }
 
-int seagrass_uintmax_t_times_and_a_half_even(const uintmax_t current,
-                                             uintmax_t *const out) {
-    if (!out) {
+int seagrass_uintmax_t_out_of_range_mask_n(const uintmax_t *const values,
+                                           const uintmax_t count,
+                                           const uintmax_t minimum,
+                                           const uintmax_t maximum,
+                                           uint64_t *const out) {
+    if (!values && count) {
+        return SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL;
+    }
+    if (!out && count) {
         return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
     }
-    /* increase capacity by times and a half and then use the next even
-     * number */
-    uintmax_t i = current >> 1;
-    /* even numbers */
-    if ((current & 1) ^ (i & 1)) {
-        i += 1;
+    if (minimum > maximum) {
+        return SEAGRASS_UINTMAX_T_ERROR_RANGE_IS_INVALID;
+    }
+    const uintmax_t width = maximum - minimum;
+    uintmax_t i = 0;
+    for (; i + 64 <= count; i += 64) {
+        out[i / 64] = out_of_range_word(values + i, minimum, width);
     }
-    int error;
-    if ((error = seagrass_uintmax_t_add(current, i, out))) {
-        seagrass_required_true(SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT
-                               == error);
-        *out = UINTMAX_MAX;
-    } else if (!current) {
-        *out = 2;
+    if (i < count) {
+        uint64_t bits = 0;
+        for (uintmax_t j = 0; i + j < count; j++) {
+            bits |= (uint64_t) out_of_range(values[i + j], minimum, width)
+                    << j;
+        }
+        out[i / 64] = bits;
     }
     return 0;
 }
@@ -0,0 +1,79 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+typedef int (*arithmetic)(uintmax_t a, uintmax_t b, uintmax_t *out);
+
+static inline int update(atomic_uintmax_t *const object,
+                         const uintmax_t value,
+                         uintmax_t *const out,
+                         const arithmetic operation) {
+    uintmax_t expected = atomic_load_explicit(object, memory_order_relaxed);
+    uintmax_t desired;
+    do {
+        if (operation(expected, value, &desired)) {
+            return SEAGRASS_UINTMAX_T_ATOMIC_ERROR_RESULT_IS_INCONSISTENT;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(
+            object, &expected, desired, memory_order_acq_rel,
+            memory_order_relaxed));
+    if (out) {
+        *out = desired;
+    }
+    return 0;
+}
+
+/* The value is left as it is. */
+static int unchanged(atomic_uintmax_t *const object, uintmax_t *const out) {
+    const uintmax_t value = atomic_load_explicit(object, memory_order_acquire);
+    if (out) {
+        *out = value;
+    }
+    return 0;
+}
+
+int seagrass_uintmax_t_atomic_add(atomic_uintmax_t *const object,
+                                  const uintmax_t value,
+                                  uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL;
+    }
+    if (!value) {
+        return unchanged(object, out);
+    }
+    return update(object, value, out, seagrass_uintmax_t_add);
+}
+
+int seagrass_uintmax_t_atomic_subtract(atomic_uintmax_t *const object,
+                                       const uintmax_t value,
+                                       uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL;
+    }
+    if (!value) {
+        return unchanged(object, out);
+    }
+    return update(object, value, out, seagrass_uintmax_t_subtract);
+}
+
+int seagrass_uintmax_t_atomic_multiply(atomic_uintmax_t *const object,
+                                       const uintmax_t value,
+                                       uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL;
+    }
+    if (1 == value) {
+        return unchanged(object, out);
+    }
+    if (!value) {
+        atomic_exchange_explicit(object, 0, memory_order_acq_rel);
+        if (out) {
+            *out = 0;
+        }
+        return 0;
+    }
+    return update(object, value, out, seagrass_uintmax_t_multiply);
+}
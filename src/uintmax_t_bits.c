@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "bits.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+int seagrass_uintmax_t_is_power_of_two(const uintmax_t a, bool *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    *out = a && !(a & (a - 1));
+    return 0;
+}
+
+int seagrass_uintmax_t_next_power_of_two(const uintmax_t a,
+                                         uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    if (a <= 1) {
+        *out = 1;
+        return 0;
+    }
+    const unsigned int log2 = SEAGRASS_BITS_WIDTH - seagrass_bits_clz(a - 1);
+    if (log2 >= SEAGRASS_BITS_WIDTH) {
+        return SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = (uintmax_t) 1 << log2;
+    return 0;
+}
+
+int seagrass_uintmax_t_floor_log2(const uintmax_t a, uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    if (!a) {
+        return SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID;
+    }
+    *out = SEAGRASS_BITS_WIDTH - 1 - seagrass_bits_clz(a);
+    return 0;
+}
+
+int seagrass_uintmax_t_ceil_log2(const uintmax_t a, uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    if (!a) {
+        return SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID;
+    }
+    *out = 1 == a ? 0 : SEAGRASS_BITS_WIDTH - seagrass_bits_clz(a - 1);
+    return 0;
+}
+
+int seagrass_uintmax_t_popcount(const uintmax_t a, uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    *out = seagrass_bits_popcount(a);
+    return 0;
+}
+
+int seagrass_uintmax_t_count_leading_zeros(const uintmax_t a,
+                                           uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    *out = a ? seagrass_bits_clz(a) : SEAGRASS_BITS_WIDTH;
+    return 0;
+}
+
+int seagrass_uintmax_t_count_trailing_zeros(const uintmax_t a,
+                                            uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    *out = a ? seagrass_bits_ctz(a) : SEAGRASS_BITS_WIDTH;
+    return 0;
+}
+
+int seagrass_uintmax_t_align_up(const uintmax_t a, const uintmax_t alignment,
+                                uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    if (!alignment || (alignment & (alignment - 1))) {
+        return SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID;
+    }
+    const uintmax_t mask = alignment - 1;
+    if (a > UINTMAX_MAX - mask) {
+        return SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = (a + mask) & ~mask;
+    return 0;
+}
+
+int seagrass_uintmax_t_align_down(const uintmax_t a,
+                                  const uintmax_t alignment,
+                                  uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    if (!alignment || (alignment & (alignment - 1))) {
+        return SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID;
+    }
+    *out = a & ~(alignment - 1);
+    return 0;
+}
+
+int seagrass_uintmax_t_power(uintmax_t base, uintmax_t exponent,
+                             uintmax_t *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL;
+    }
+    /* powers of two are a shift */
+    if (base && !(base & (base - 1))) {
+        const uintmax_t log2 = SEAGRASS_BITS_WIDTH - 1
+                               - seagrass_bits_clz(base);
+        if (exponent && log2 > (SEAGRASS_BITS_WIDTH - 1) / exponent) {
+            return SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT;
+        }
+        *out = (uintmax_t) 1 << (log2 * exponent);
+        return 0;
+    }
+    /* exponentiation by squaring */
+    uintmax_t result = 1;
+    while (exponent) {
+        if (exponent & 1) {
+            if (seagrass_uintmax_t_multiply(result, base, &result)) {
+                return SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT;
+            }
+        }
+        exponent >>= 1;
+        if (exponent && seagrass_uintmax_t_multiply(base, base, &base)) {
+            return SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT;
+        }
+    }
+    *out = result;
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+#define LANES 8
+
+int seagrass_uintmax_t_checked_get(
+        const struct seagrass_uintmax_t_checked *const object,
+        uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_CHECKED_ERROR_OUT_IS_NULL;
+    }
+    if (object->overflow) {
+        return SEAGRASS_UINTMAX_T_CHECKED_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    *out = object->value;
+    return 0;
+}
+
+int seagrass_uintmax_t_checked_sum(
+        struct seagrass_uintmax_t_checked *const object,
+        const uintmax_t *const values,
+        const uintmax_t count) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL;
+    }
+    if (!values && count) {
+        return SEAGRASS_UINTMAX_T_CHECKED_ERROR_VALUES_IS_NULL;
+    }
+    /* independent lanes without any loop carried branches so that the
+     * compiler is able to vectorize the loop. As all the values are unsigned
+     * an overflow within any lane implies that the total overflows too. */
+    uintmax_t sum[LANES] = {0};
+    uintmax_t carry[LANES] = {0};
+    uintmax_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (uintmax_t j = 0; j < LANES; j++) {
+            const uintmax_t value = values[i + j];
+            sum[j] += value;
+            carry[j] |= sum[j] < value;
+        }
+    }
+    for (uintmax_t j = 0; j < LANES; j++) {
+        object->overflow |= carry[j];
+        seagrass_uintmax_t_checked_add(object, sum[j]);
+    }
+    for (; i < count; i++) {
+        seagrass_uintmax_t_checked_add(object, values[i]);
+    }
+    return 0;
+}
+
+int seagrass_uintmax_t_checked_product(
+        struct seagrass_uintmax_t_checked *const object,
+        const uintmax_t *const values,
+        const uintmax_t count) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL;
+    }
+    if (!values && count) {
+        return SEAGRASS_UINTMAX_T_CHECKED_ERROR_VALUES_IS_NULL;
+    }
+    struct seagrass_uintmax_t_checked product = *object;
+    for (uintmax_t i = 0; i < count; i++) {
+        seagrass_uintmax_t_checked_multiply(&product, values[i]);
+    }
+    *object = product;
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "wide.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+int seagrass_uintmax_t_divider_init(
+        struct seagrass_uintmax_t_divider *const object,
+        const uintmax_t divisor) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL;
+    }
+    if (!divisor) {
+        return SEAGRASS_UINTMAX_T_DIVIDER_ERROR_DIVIDE_BY_ZERO;
+    }
+    const unsigned int log2 = SEAGRASS_WIDE_BITS - 1
+                              - seagrass_bits_clz(divisor);
+    object->divisor = divisor;
+    object->shift = (unsigned char) log2;
+    object->add = false;
+    /* powers of two only need a shift */
+    if (!(divisor & (divisor - 1))) {
+        object->magic = 0;
+        return 0;
+    }
+    /* round-up reciprocal, see Granlund and Montgomery, "Division by
+     * Invariant Integers using Multiplication" and libdivide */
+    uintmax_t remainder;
+    uintmax_t magic = seagrass_wide_divide((uintmax_t) 1 << log2, 0,
+                                           divisor, &remainder);
+    const uintmax_t error = divisor - remainder;
+    if (error >= ((uintmax_t) 1 << log2)) {
+        /* the reciprocal needs one more bit than a uintmax_t has */
+        magic += magic;
+        const uintmax_t twice = remainder + remainder;
+        if (twice >= divisor || twice < remainder) {
+            magic += 1;
+        }
+        object->add = true;
+    }
+    object->magic = 1 + magic;
+    return 0;
+}
+
+static inline uintmax_t divide(
+        const struct seagrass_uintmax_t_divider *const object,
+        const uintmax_t value) {
+    if (!object->magic) {
+        return value >> object->shift;
+    }
+    const uintmax_t q = seagrass_wide_multiply_high(value, object->magic);
+    if (object->add) {
+        return (((value - q) >> 1) + q) >> object->shift;
+    }
+    return q >> object->shift;
+}
+
+int seagrass_uintmax_t_divider_divide(
+        const struct seagrass_uintmax_t_divider *const object,
+        const uintmax_t value,
+        uintmax_t *const quotient,
+        uintmax_t *const remainder) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL;
+    }
+    if (!quotient) {
+        return SEAGRASS_UINTMAX_T_DIVIDER_ERROR_QUOTIENT_IS_NULL;
+    }
+    const uintmax_t q = divide(object, value);
+    *quotient = q;
+    if (remainder) {
+        *remainder = value - q * object->divisor;
+    }
+    return 0;
+}
+
+int seagrass_uintmax_t_divider_modulo(
+        const struct seagrass_uintmax_t_divider *const object,
+        const uintmax_t value,
+        uintmax_t *const out) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OUT_IS_NULL;
+    }
+    *out = value - divide(object, value) * object->divisor;
+    return 0;
+}
+
+int seagrass_uintmax_t_divider_divide_n(
+        const struct seagrass_uintmax_t_divider *const object,
+        const uintmax_t *const values,
+        const uintmax_t count,
+        uintmax_t *const quotients,
+        uintmax_t *const remainders) {
+    if (!object) {
+        return SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL;
+    }
+    if (!count) {
+        return 0;
+    }
+    if (!values) {
+        return SEAGRASS_UINTMAX_T_DIVIDER_ERROR_VALUES_IS_NULL;
+    }
+    if (!quotients) {
+        return SEAGRASS_UINTMAX_T_DIVIDER_ERROR_QUOTIENT_IS_NULL;
+    }
+    const uintmax_t divisor = object->divisor;
+    const uintmax_t magic = object->magic;
+    const unsigned char shift = object->shift;
+    /* one loop per strategy so that there are no branches in the loops */
+    if (!magic) {
+        for (uintmax_t i = 0; i < count; i++) {
+            const uintmax_t value = values[i];
+            quotients[i] = value >> shift;
+            if (remainders) {
+                remainders[i] = value & (divisor - 1);
+            }
+        }
+    } else if (object->add) {
+        for (uintmax_t i = 0; i < count; i++) {
+            const uintmax_t value = values[i];
+            const uintmax_t q = seagrass_wide_multiply_high(value, magic);
+            const uintmax_t quotient = (((value - q) >> 1) + q) >> shift;
+            quotients[i] = quotient;
+            if (remainders) {
+                remainders[i] = value - quotient * divisor;
+            }
+        }
+    } else {
+        for (uintmax_t i = 0; i < count; i++) {
+            const uintmax_t value = values[i];
+            const uintmax_t quotient
+                    = seagrass_wide_multiply_high(value, magic) >> shift;
+            quotients[i] = quotient;
+            if (remainders) {
+                remainders[i] = value - quotient * divisor;
+            }
+        }
+    }
+    return 0;
+}
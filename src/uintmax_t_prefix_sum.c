@@ -0,0 +1,205 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "thread_pool.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* Smallest count that is scanned in parallel. */
+#define PARALLEL ((uintmax_t) 1 << 16)
+/* Blocks per participating thread, more blocks even out the load. */
+#define BLOCKS_PER_THREAD 4
+#define BLOCKS (SEAGRASS_THREAD_POOL_MAXIMUM * BLOCKS_PER_THREAD)
+
+/* Scan count values onto out starting from *sum, which receives the sum
+ * of the values scanned. Returns the index of the value at which the sum
+ * overflows, otherwise count. For an exclusive scan the element of out at
+ * the returned index has been written too. */
+static inline uintmax_t scan(const uintmax_t *const values,
+                             const uintmax_t count,
+                             const bool exclusive,
+                             uintmax_t *const sum,
+                             uintmax_t *const out) {
+    uintmax_t carry = *sum;
+    uintmax_t i = 0;
+    /* Four values are scanned within registers, which leaves one addition
+     * per four values on the chain through carry. As the values are
+     * unsigned the sums only grow, an overflow of any of the partial sums
+     * is hence an overflow of the prefix sum and the block is rescanned one
+     * value at a time to find it. */
+    for (; i + 4 <= count; i += 4) {
+        const uintmax_t a = values[i];
+        const uintmax_t b = values[i + 1];
+        const uintmax_t c = values[i + 2];
+        const uintmax_t d = values[i + 3];
+        const uintmax_t ab = a + b;
+        const uintmax_t cd = c + d;
+        const uintmax_t abc = ab + c;
+        const uintmax_t abcd = ab + cd;
+        const uintmax_t last = carry + abcd;
+        if ((ab < a) | (cd < c) | (abc < ab) | (abcd < ab) | (last < carry)) {
+            break;
+        }
+        if (exclusive) {
+            out[i] = carry;
+            out[i + 1] = carry + a;
+            out[i + 2] = carry + ab;
+            out[i + 3] = carry + abc;
+        } else {
+            out[i] = carry + a;
+            out[i + 1] = carry + ab;
+            out[i + 2] = carry + abc;
+            out[i + 3] = last;
+        }
+        carry = last;
+    }
+    for (; i < count; i++) {
+        const uintmax_t value = values[i];
+        if (exclusive) {
+            out[i] = carry;
+        }
+        carry += value;
+        if (carry < value) {
+            break;
+        }
+        if (!exclusive) {
+            out[i] = carry;
+        }
+    }
+    *sum = carry;
+    return i;
+}
+
+struct block {
+    uintmax_t sum;
+    bool overflow;
+};
+
+struct job {
+    const uintmax_t *values;
+    uintmax_t count;
+    uintmax_t size;
+    bool exclusive;
+    uintmax_t *out;
+    struct block blocks[BLOCKS];
+};
+
+static uintmax_t block_count(const struct job *const job,
+                             const uintmax_t index) {
+    const uintmax_t remaining = job->count - index * job->size;
+    return remaining < job->size ? remaining : job->size;
+}
+
+static void sum_task(void *const context, const uintmax_t index) {
+    struct job *const job = context;
+    struct seagrass_uintmax_t_checked sum;
+    seagrass_uintmax_t_checked_init(&sum, 0);
+    seagrass_required_true(!seagrass_uintmax_t_checked_sum(
+            &sum, job->values + index * job->size, block_count(job, index)));
+    job->blocks[index].sum = sum.value;
+    job->blocks[index].overflow = sum.overflow;
+}
+
+/* Only blocks that do not overflow are scanned, their sums have been
+ * replaced by the sum of the blocks before them. */
+static void scan_task(void *const context, const uintmax_t index) {
+    struct job *const job = context;
+    const uintmax_t begin = index * job->size;
+    uintmax_t sum = job->blocks[index].sum;
+    seagrass_required_true(
+            scan(job->values + begin, block_count(job, index),
+                 job->exclusive, &sum, job->out + begin)
+            == block_count(job, index));
+}
+
+/* Returns the index at which the scan overflows, otherwise the count. */
+static uintmax_t parallel_scan(struct job *const job,
+                               const unsigned int concurrency) {
+    const uintmax_t blocks = (uintmax_t) concurrency * BLOCKS_PER_THREAD;
+    job->size = job->count / blocks + (job->count % blocks != 0);
+    const uintmax_t count = job->count / job->size
+                            + (job->count % job->size != 0);
+    seagrass_thread_pool_for(count, sum_task, job);
+    /* turn the block sums into the sums of the blocks before them */
+    struct seagrass_uintmax_t_checked sum;
+    seagrass_uintmax_t_checked_init(&sum, 0);
+    uintmax_t i = 0;
+    for (; i < count; i++) {
+        const struct block block = job->blocks[i];
+        job->blocks[i].sum = sum.value;
+        sum.overflow |= block.overflow;
+        seagrass_uintmax_t_checked_add(&sum, block.sum);
+        if (sum.overflow) {
+            break;
+        }
+    }
+    seagrass_thread_pool_for(i, scan_task, job);
+    if (i == count) {
+        return job->count;
+    }
+    /* the block in which the scan overflows */
+    const uintmax_t begin = i * job->size;
+    uintmax_t carry = job->blocks[i].sum;
+    return begin + scan(job->values + begin, block_count(job, i),
+                        job->exclusive, &carry, job->out + begin);
+}
+
+int seagrass_uintmax_t_prefix_sum(
+        const uintmax_t *const values,
+        const uintmax_t count,
+        const enum seagrass_uintmax_t_prefix_sum_mode mode,
+        uintmax_t *const out,
+        uintmax_t *const index) {
+    if (!values && count) {
+        return SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_VALUES_IS_NULL;
+    }
+    if (!out && count) {
+        return SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_OUT_IS_NULL;
+    }
+    bool exclusive;
+    switch (mode) {
+        default: {
+            return SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_MODE_IS_INVALID;
+        }
+        case SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE: {
+            exclusive = false;
+            break;
+        }
+        case SEAGRASS_UINTMAX_T_PREFIX_SUM_EXCLUSIVE: {
+            exclusive = true;
+            break;
+        }
+    }
+    uintmax_t at;
+    const unsigned int concurrency = count < PARALLEL
+                                     ? 1
+                                     : seagrass_thread_pool_get_concurrency();
+    if (concurrency < 2) {
+        uintmax_t sum = 0;
+        at = exclusive
+             ? scan(values, count, true, &sum, out)
+             : scan(values, count, false, &sum, out);
+    } else {
+        struct job job = {
+                .values = values,
+                .count = count,
+                .exclusive = exclusive,
+                .out = out
+        };
+        at = parallel_scan(&job, concurrency);
+    }
+    /* an exclusive scan leaves out the last value and an overflow caused by
+     * the value at the index first shows in the element after it */
+    if (exclusive && at < count) {
+        at++;
+    }
+    if (at == count) {
+        return 0;
+    }
+    if (index) {
+        *index = at;
+    }
+    return SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_RESULT_IS_INCONSISTENT;
+}
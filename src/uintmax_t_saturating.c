@@ -0,0 +1,102 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+/* The results are selected with masks rather than branches so that the
+ * array loops map onto vector compare and blend instructions. */
+
+static inline uintmax_t add(const uintmax_t a, const uintmax_t b) {
+    const uintmax_t c = a + b;
+    return c | -(uintmax_t) (c < a);
+}
+
+static inline uintmax_t subtract(const uintmax_t a, const uintmax_t b) {
+    const uintmax_t c = a - b;
+    return c & -(uintmax_t) (a >= b);
+}
+
+static inline uintmax_t multiply(const uintmax_t a, const uintmax_t b) {
+    uintmax_t c;
+#if defined(__GNUC__) || defined(__clang__)
+    const bool overflow = __builtin_mul_overflow(a, b, &c);
+#else
+    c = a * b;
+    const bool overflow = a && c / a != b;
+#endif
+    return c | -(uintmax_t) overflow;
+}
+
+uintmax_t seagrass_uintmax_t_saturating_add(const uintmax_t a,
+                                            const uintmax_t b) {
+    return add(a, b);
+}
+
+uintmax_t seagrass_uintmax_t_saturating_subtract(const uintmax_t a,
+                                                 const uintmax_t b) {
+    return subtract(a, b);
+}
+
+uintmax_t seagrass_uintmax_t_saturating_multiply(const uintmax_t a,
+                                                 const uintmax_t b) {
+    return multiply(a, b);
+}
+
+int seagrass_uintmax_t_saturating_add_n(const uintmax_t *const a,
+                                        const uintmax_t *const b,
+                                        const uintmax_t count,
+                                        uintmax_t *const out) {
+    if (!count) {
+        return 0;
+    }
+    if (!a || !b) {
+        return SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL;
+    }
+    for (uintmax_t i = 0; i < count; i++) {
+        out[i] = add(a[i], b[i]);
+    }
+    return 0;
+}
+
+int seagrass_uintmax_t_saturating_subtract_n(const uintmax_t *const a,
+                                             const uintmax_t *const b,
+                                             const uintmax_t count,
+                                             uintmax_t *const out) {
+    if (!count) {
+        return 0;
+    }
+    if (!a || !b) {
+        return SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL;
+    }
+    for (uintmax_t i = 0; i < count; i++) {
+        out[i] = subtract(a[i], b[i]);
+    }
+    return 0;
+}
+
+int seagrass_uintmax_t_saturating_multiply_n(const uintmax_t *const a,
+                                             const uintmax_t *const b,
+                                             const uintmax_t count,
+                                             uintmax_t *const out) {
+    if (!count) {
+        return 0;
+    }
+    if (!a || !b) {
+        return SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL;
+    }
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL;
+    }
+    for (uintmax_t i = 0; i < count; i++) {
+        out[i] = multiply(a[i], b[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include <seagrass.h>
+
+#include "wide.h"
+
+#ifdef TEST
+#include <test/cmocka.h>
+#endif
+
+int seagrass_uintmax_t_multiply_wide(
+        const uintmax_t a, const uintmax_t b,
+        struct seagrass_uintmax_t_wide *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL;
+    }
+    out->lo = seagrass_wide_multiply(a, b, &out->hi);
+    return 0;
+}
+
+int seagrass_uintmax_t_muldiv(const uintmax_t a, const uintmax_t b,
+                              const uintmax_t c, uintmax_t *const quotient,
+                              uintmax_t *const remainder) {
+    if (!quotient) {
+        return SEAGRASS_UINTMAX_T_WIDE_ERROR_QUOTIENT_IS_NULL;
+    }
+    if (!c) {
+        return SEAGRASS_UINTMAX_T_WIDE_ERROR_DIVIDE_BY_ZERO;
+    }
+    uintmax_t hi;
+    const uintmax_t lo = seagrass_wide_multiply(a, b, &hi);
+    if (hi >= c) {
+        return SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    uintmax_t r;
+    *quotient = seagrass_wide_divide(hi, lo, c, &r);
+    if (remainder) {
+        *remainder = r;
+    }
+    return 0;
+}
+
+int seagrass_uintmax_t_wide_compare(const struct seagrass_uintmax_t_wide a,
+                                    const struct seagrass_uintmax_t_wide b) {
+    if (a.hi != b.hi) {
+        return seagrass_uintmax_t_compare(a.hi, b.hi);
+    }
+    return seagrass_uintmax_t_compare(a.lo, b.lo);
+}
+
+int seagrass_uintmax_t_wide_add(const struct seagrass_uintmax_t_wide a,
+                                const struct seagrass_uintmax_t_wide b,
+                                struct seagrass_uintmax_t_wide *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL;
+    }
+    const uintmax_t lo = a.lo + b.lo;
+    const uintmax_t carry = lo < a.lo;
+    const uintmax_t hi = a.hi + b.hi;
+    if (hi < a.hi || hi + carry < hi) {
+        return SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    out->hi = hi + carry;
+    out->lo = lo;
+    return 0;
+}
+
+int seagrass_uintmax_t_wide_subtract(
+        const struct seagrass_uintmax_t_wide a,
+        const struct seagrass_uintmax_t_wide b,
+        struct seagrass_uintmax_t_wide *const out) {
+    if (!out) {
+        return SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL;
+    }
+    if (seagrass_uintmax_t_wide_compare(a, b) < 0) {
+        return SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT;
+    }
+    const uintmax_t borrow = a.lo < b.lo;
+    out->lo = a.lo - b.lo;
+    out->hi = a.hi - b.hi - borrow;
+    return 0;
+}
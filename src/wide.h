@@ -0,0 +1,121 @@
+#ifndef _SEAGRASS_WIDE_H_
+#define _SEAGRASS_WIDE_H_
+
+#include <limits.h>
+#include <stdint.h>
+
+#include "bits.h"
+
+#if defined(__SIZEOF_INT128__) && UINTMAX_MAX == UINT64_MAX
+#define SEAGRASS_WIDE_INT128
+#endif
+
+#define SEAGRASS_WIDE_BITS SEAGRASS_BITS_WIDTH
+#define SEAGRASS_WIDE_HALF_BITS (SEAGRASS_WIDE_BITS / 2)
+#define SEAGRASS_WIDE_HALF_MASK \
+    (((uintmax_t) 1 << SEAGRASS_WIDE_HALF_BITS) - 1)
+
+/**
+ * @brief Full width multiplication.
+ * @param [in] a first uintmax_t.
+ * @param [in] b second uintmax_t.
+ * @param [out] hi receive the high word of the product.
+ * @return low word of the product.
+ */
+static inline uintmax_t seagrass_wide_multiply(const uintmax_t a,
+                                               const uintmax_t b,
+                                               uintmax_t *const hi) {
+#if defined(SEAGRASS_WIDE_INT128)
+    const unsigned __int128 c = (unsigned __int128) a * b;
+    *hi = (uintmax_t) (c >> 64);
+    return (uintmax_t) c;
+#else
+    const uintmax_t a1 = a >> SEAGRASS_WIDE_HALF_BITS;
+    const uintmax_t a0 = a & SEAGRASS_WIDE_HALF_MASK;
+    const uintmax_t b1 = b >> SEAGRASS_WIDE_HALF_BITS;
+    const uintmax_t b0 = b & SEAGRASS_WIDE_HALF_MASK;
+    const uintmax_t p00 = a0 * b0;
+    const uintmax_t p01 = a0 * b1;
+    const uintmax_t p10 = a1 * b0;
+    const uintmax_t p11 = a1 * b1;
+    /* cannot overflow: at most 3 * (2^h - 1) */
+    const uintmax_t middle = (p00 >> SEAGRASS_WIDE_HALF_BITS)
+                             + (p01 & SEAGRASS_WIDE_HALF_MASK)
+                             + (p10 & SEAGRASS_WIDE_HALF_MASK);
+    *hi = p11 + (p01 >> SEAGRASS_WIDE_HALF_BITS)
+          + (p10 >> SEAGRASS_WIDE_HALF_BITS)
+          + (middle >> SEAGRASS_WIDE_HALF_BITS);
+    return (middle << SEAGRASS_WIDE_HALF_BITS)
+           | (p00 & SEAGRASS_WIDE_HALF_MASK);
+#endif
+}
+
+/**
+ * @brief High word of the full width multiplication.
+ * @param [in] a first uintmax_t.
+ * @param [in] b second uintmax_t.
+ * @return high word of the product.
+ */
+static inline uintmax_t seagrass_wide_multiply_high(const uintmax_t a,
+                                                    const uintmax_t b) {
+    uintmax_t hi;
+    (void) seagrass_wide_multiply(a, b, &hi);
+    return hi;
+}
+
+/**
+ * @brief Divide a double width value by a single width value.
+ * @param [in] hi high word of the dividend.
+ * @param [in] lo low word of the dividend.
+ * @param [in] d divisor.
+ * @param [out] remainder receive the remainder.
+ * @return quotient.
+ * @note <b>hi</b> must be less than <b>d</b> so that the quotient fits.
+ */
+static inline uintmax_t seagrass_wide_divide(const uintmax_t hi,
+                                             const uintmax_t lo,
+                                             uintmax_t d,
+                                             uintmax_t *const remainder) {
+#if defined(SEAGRASS_WIDE_INT128)
+    const unsigned __int128 n = ((unsigned __int128) hi << 64) | lo;
+    *remainder = (uintmax_t) (n % d);
+    return (uintmax_t) (n / d);
+#else
+    /* Hacker's Delight, divlu */
+    const uintmax_t b = (uintmax_t) 1 << SEAGRASS_WIDE_HALF_BITS;
+    const unsigned int s = seagrass_bits_clz(d);
+    uintmax_t un32 = hi, un10 = lo;
+    if (s) {
+        d <<= s;
+        un32 = (hi << s) | (lo >> (SEAGRASS_WIDE_BITS - s));
+        un10 = lo << s;
+    }
+    const uintmax_t vn1 = d >> SEAGRASS_WIDE_HALF_BITS;
+    const uintmax_t vn0 = d & SEAGRASS_WIDE_HALF_MASK;
+    const uintmax_t un1 = un10 >> SEAGRASS_WIDE_HALF_BITS;
+    const uintmax_t un0 = un10 & SEAGRASS_WIDE_HALF_MASK;
+    uintmax_t q1 = un32 / vn1;
+    uintmax_t rhat = un32 - q1 * vn1;
+    while (q1 >= b || q1 * vn0 > b * rhat + un1) {
+        q1 -= 1;
+        rhat += vn1;
+        if (rhat >= b) {
+            break;
+        }
+    }
+    const uintmax_t un21 = un32 * b + un1 - q1 * d;
+    uintmax_t q0 = un21 / vn1;
+    rhat = un21 - q0 * vn1;
+    while (q0 >= b || q0 * vn0 > b * rhat + un0) {
+        q0 -= 1;
+        rhat += vn1;
+        if (rhat >= b) {
+            break;
+        }
+    }
+    *remainder = (un21 * b + un0 - q0 * d) >> s;
+    return q1 * b + q0;
+#endif
+}
+
+#endif /* _SEAGRASS_WIDE_H_ */
@@ -0,0 +1,7 @@
+#include <stdint.h>
+#include <seagrass.h>
+
+int main(int argc, char *argv[]) {
+    uint32_t out;
+    return seagrass_add((uintmax_t) 1 << 40, (uintmax_t) 0, &out);
+}
@@ -0,0 +1,20 @@
+#include <stdint.h>
+#include <seagrass.h>
+
+#if defined(FAIL_ADD)
+#define VALUE SEAGRASS_UINTMAX_T_CONST_ADD(UINTMAX_MAX, 1)
+#elif defined(FAIL_SUB)
+#define VALUE SEAGRASS_UINTMAX_T_CONST_SUB(1, 2)
+#elif defined(FAIL_MUL)
+#define VALUE SEAGRASS_UINTMAX_T_CONST_MUL(UINTMAX_MAX, 2)
+#elif defined(FAIL_DIV)
+#define VALUE SEAGRASS_UINTMAX_T_CONST_DIV(1, 0)
+#elif defined(FAIL_NEGATIVE)
+#define VALUE SEAGRASS_UINTMAX_T_CONST_ADD(-1, 0)
+#endif
+
+static char buffer[VALUE ? 1 : 2];
+
+int main(int argc, char *argv[]) {
+    return (int) sizeof(buffer);
+}
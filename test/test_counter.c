@@ -0,0 +1,243 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <seagrass.h>
+
+#include "thread_identity.h"
+
+#include <test/cmocka.h>
+
+#define THREADS 4
+#define COUNT 100000
+
+static void check_counter_init_error_on_object_is_null(void **state) {
+    assert_int_equal(seagrass_counter_init(NULL, 1),
+                     SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_counter_init_error_on_slots_is_zero(void **state) {
+    struct seagrass_counter object;
+    assert_int_equal(seagrass_counter_init(&object, 0),
+                     SEAGRASS_COUNTER_ERROR_SLOTS_IS_ZERO);
+}
+
+static void check_counter_init_error_on_memory_allocation_failed(
+        void **state) {
+    struct seagrass_counter object;
+    assert_int_equal(seagrass_counter_init(&object, UINTMAX_MAX),
+                     SEAGRASS_COUNTER_ERROR_MEMORY_ALLOCATION_FAILED);
+    assert_int_equal(seagrass_counter_init(&object, UINTMAX_MAX / 64),
+                     SEAGRASS_COUNTER_ERROR_MEMORY_ALLOCATION_FAILED);
+    posix_memalign_is_overridden = true;
+    assert_int_equal(seagrass_counter_init(&object, 1),
+                     SEAGRASS_COUNTER_ERROR_MEMORY_ALLOCATION_FAILED);
+    posix_memalign_is_overridden = false;
+}
+
+static void check_counter_init_invalidate(void **state) {
+    struct seagrass_counter object;
+    assert_int_equal(seagrass_counter_init(&object, 8), 0);
+    assert_int_equal(object.slots, 8);
+    assert_int_equal((uintptr_t) object.counts % 64, 0);
+    uintmax_t out = 1;
+    assert_int_equal(seagrass_counter_value(&object, &out), 0);
+    assert_int_equal(out, 0);
+    assert_int_equal(seagrass_counter_invalidate(&object), 0);
+    assert_null(object.counts);
+}
+
+static void check_counter_invalidate_error_on_object_is_null(void **state) {
+    assert_int_equal(seagrass_counter_invalidate(NULL),
+                     SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_counter_add_error_on_object_is_null(void **state) {
+    assert_int_equal(seagrass_counter_add(NULL, 1),
+                     SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_counter_value_error_on_object_is_null(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_counter_value(NULL, &out),
+                     SEAGRASS_COUNTER_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_counter_value_error_on_out_is_null(void **state) {
+    struct seagrass_counter object;
+    assert_int_equal(seagrass_counter_init(&object, 1), 0);
+    assert_int_equal(seagrass_counter_value(&object, NULL),
+                     SEAGRASS_COUNTER_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_counter_invalidate(&object), 0);
+}
+
+static void check_counter_add(void **state) {
+    struct seagrass_counter object;
+    assert_int_equal(seagrass_counter_init(&object, 2), 0);
+    assert_int_equal(seagrass_counter_add(&object, 5), 0);
+    assert_int_equal(seagrass_counter_add(&object, 0), 0);
+    assert_int_equal(seagrass_counter_add(&object, 37), 0);
+    uintmax_t out;
+    assert_int_equal(seagrass_counter_value(&object, &out), 0);
+    assert_int_equal(out, 42);
+    assert_int_equal(seagrass_counter_invalidate(&object), 0);
+}
+
+static void check_counter_add_error_on_overflow(void **state) {
+    struct seagrass_counter object;
+    assert_int_equal(seagrass_counter_init(&object, 1), 0);
+    assert_int_equal(seagrass_counter_add(&object, UINTMAX_MAX - 1), 0);
+    assert_int_equal(seagrass_counter_add(&object, 2),
+                     SEAGRASS_COUNTER_ERROR_RESULT_IS_INCONSISTENT);
+    uintmax_t out;
+    assert_int_equal(seagrass_counter_value(&object, &out), 0);
+    assert_int_equal(out, UINTMAX_MAX - 1);
+    assert_int_equal(seagrass_counter_invalidate(&object), 0);
+}
+
+static void *overflow_shared(void *const argument) {
+    struct seagrass_counter *const object = argument;
+    seagrass_required_true(!seagrass_counter_add(object, UINTMAX_MAX - 1));
+    seagrass_required_true(
+            seagrass_counter_add(object, 2)
+            == SEAGRASS_COUNTER_ERROR_RESULT_IS_INCONSISTENT);
+    return NULL;
+}
+
+static void check_counter_add_error_on_overflow_of_shared_slot(
+        void **state) {
+    struct seagrass_counter object;
+    assert_int_equal(seagrass_counter_init(&object, 1), 0);
+    /* the calling thread owns the only slot */
+    assert_int_equal(seagrass_counter_add(&object, 0), 0);
+    pthread_t thread;
+    assert_int_equal(pthread_create(&thread, NULL, overflow_shared, &object),
+                     0);
+    assert_int_equal(pthread_join(thread, NULL), 0);
+    assert_int_equal(atomic_load(&object.counts[0]), 0);
+    uintmax_t out;
+    assert_int_equal(seagrass_counter_value(&object, &out), 0);
+    assert_int_equal(out, UINTMAX_MAX - 1);
+    assert_int_equal(seagrass_counter_invalidate(&object), 0);
+}
+
+static void check_counter_value_error_on_overflow(void **state) {
+    struct seagrass_counter object;
+    assert_int_equal(seagrass_counter_init(&object, 2), 0);
+    assert_int_equal(seagrass_counter_add(&object, UINTMAX_MAX), 0);
+    uintmax_t out = 0;
+    assert_int_equal(seagrass_counter_value(&object, &out), 0);
+    assert_int_equal(out, UINTMAX_MAX);
+    /* another slot */
+    atomic_store(&object.counts[64 / sizeof(uintmax_t)], 1);
+    out = 7;
+    assert_int_equal(seagrass_counter_value(&object, &out),
+                     SEAGRASS_COUNTER_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(out, 7);
+    assert_int_equal(seagrass_counter_invalidate(&object), 0);
+}
+
+static void *add(void *const argument) {
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        seagrass_required_true(!seagrass_counter_add(argument, 1));
+    }
+    return NULL;
+}
+
+static void check_counter_add_concurrently(void **state) {
+    /* with fewer slots than threads some threads share a slot */
+    const uintmax_t slots[] = {1, 2, THREADS + 1};
+    for (size_t s = 0; s < sizeof(slots) / sizeof(slots[0]); s++) {
+        struct seagrass_counter object;
+        assert_int_equal(seagrass_counter_init(&object, slots[s]), 0);
+        pthread_t threads[THREADS];
+        for (uintmax_t i = 0; i < THREADS; i++) {
+            assert_int_equal(pthread_create(&threads[i], NULL, add, &object),
+                             0);
+        }
+        for (uintmax_t i = 0; i < THREADS; i++) {
+            assert_int_equal(pthread_join(threads[i], NULL), 0);
+        }
+        uintmax_t out;
+        assert_int_equal(seagrass_counter_value(&object, &out), 0);
+        assert_int_equal(out, THREADS * COUNT);
+        assert_int_equal(seagrass_counter_invalidate(&object), 0);
+    }
+}
+
+struct crowd {
+    struct seagrass_counter *counter;
+    pthread_barrier_t *barrier;
+};
+
+static void *add_in_crowd(void *const argument) {
+    struct crowd *const crowd = argument;
+    /* every thread holds its identity before any of them adds more */
+    seagrass_required_true(!seagrass_counter_add(crowd->counter, 1));
+    pthread_barrier_wait(crowd->barrier);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        seagrass_required_true(!seagrass_counter_add(crowd->counter, 1));
+    }
+    return NULL;
+}
+
+static void check_counter_add_with_more_threads_than_identities(
+        void **state) {
+    /* the threads past the last identity share the shared slot even
+     * though there are slots enough for them */
+    const uintmax_t count = SEAGRASS_THREAD_IDENTITY_MAXIMUM + THREADS;
+    struct seagrass_counter object;
+    assert_int_equal(seagrass_counter_init(&object, count + 1), 0);
+    pthread_barrier_t barrier;
+    assert_int_equal(pthread_barrier_init(&barrier, NULL, count), 0);
+    struct crowd crowd = {&object, &barrier};
+    pthread_attr_t attributes;
+    assert_int_equal(pthread_attr_init(&attributes), 0);
+    assert_int_equal(pthread_attr_setstacksize(&attributes, 1 << 16), 0);
+    pthread_t *const threads = malloc(count * sizeof(pthread_t));
+    assert_non_null(threads);
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_int_equal(pthread_create(&threads[i], &attributes,
+                                        add_in_crowd, &crowd), 0);
+    }
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_int_equal(pthread_join(threads[i], NULL), 0);
+    }
+    free(threads);
+    assert_int_equal(pthread_attr_destroy(&attributes), 0);
+    assert_int_equal(pthread_barrier_destroy(&barrier), 0);
+    const uintmax_t shared = atomic_load(
+            &object.counts[object.slots * 64 / sizeof(uintmax_t)]);
+    assert_true(shared && !(shared % 1001));
+    uintmax_t out;
+    assert_int_equal(seagrass_counter_value(&object, &out), 0);
+    assert_int_equal(out, count * 1001);
+    assert_int_equal(seagrass_counter_invalidate(&object), 0);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_counter_init_error_on_object_is_null),
+            cmocka_unit_test(check_counter_init_error_on_slots_is_zero),
+            cmocka_unit_test(
+                    check_counter_init_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_counter_init_invalidate),
+            cmocka_unit_test(check_counter_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_counter_add_error_on_object_is_null),
+            cmocka_unit_test(check_counter_value_error_on_object_is_null),
+            cmocka_unit_test(check_counter_value_error_on_out_is_null),
+            cmocka_unit_test(check_counter_add),
+            cmocka_unit_test(check_counter_add_error_on_overflow),
+            cmocka_unit_test(
+                    check_counter_add_error_on_overflow_of_shared_slot),
+            cmocka_unit_test(check_counter_value_error_on_overflow),
+            cmocka_unit_test(check_counter_add_concurrently),
+            cmocka_unit_test(
+                    check_counter_add_with_more_threads_than_identities),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,689 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+static void check_double_ptr_compare(void **state) {
+    const double q[] = {
+            0,
+            1
+    };
+    const double *i[] = {
+            &q[0],
+            &q[1]
+    };
+    assert_int_equal((-1), seagrass_double_ptr_compare(i[0], i[1]));
+    assert_int_equal((-1), seagrass_double_ptr_compare(i[1], NULL));
+    assert_int_equal((-1), seagrass_double_ptr_compare(i[0], NULL));
+    assert_int_equal(0, seagrass_double_ptr_compare(i[0], i[0]));
+    assert_int_equal(0, seagrass_double_ptr_compare(i[1], i[1]));
+    assert_int_equal(1, seagrass_double_ptr_compare(i[1], i[0]));
+    assert_int_equal(1, seagrass_double_ptr_compare(NULL, i[0]));
+    assert_int_equal(1, seagrass_double_ptr_compare(NULL, i[1]));
+
+    abort_is_overridden = true;
+    expect_function_call(cmocka_test_abort);
+    seagrass_double_ptr_compare(NULL, NULL);
+    abort_is_overridden = false;
+}
+
+static void check_double_compare(void **state) {
+    const double i[] = {
+            0,
+            1
+    };
+    assert_int_equal((-1), seagrass_double_compare(i[0], i[1]));
+    assert_int_equal(0, seagrass_double_compare(i[0], i[0]));
+    assert_int_equal(0, seagrass_double_compare(i[1], i[1]));
+    assert_int_equal(1, seagrass_double_compare(i[1], i[0]));
+}
+
+static void check_double_minimum_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_minimum(0, 1, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_minimum(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_minimum(-DBL_EPSILON, 0, &result), 0);
+    assert_float_equal(result, -DBL_EPSILON, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_minimum(0, -DBL_EPSILON, &result), 0);
+    assert_float_equal(result, -DBL_EPSILON, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_minimum(DBL_MAX, 0, &result), 0);
+    assert_float_equal(result, 0, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_minimum(0, DBL_MAX, &result), 0);
+    assert_float_equal(result, 0, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_minimum(-DBL_MAX, 0, &result), 0);
+    assert_float_equal(result, -DBL_MAX, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_minimum(0, -DBL_MAX, &result), 0);
+    assert_float_equal(result, -DBL_MAX, DBL_EPSILON);
+}
+
+static void check_double_maximum_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_maximum(0, 1, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_maximum(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_maximum(DBL_EPSILON, 0, &result), 0);
+    assert_float_equal(result, DBL_EPSILON, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_maximum(0, DBL_EPSILON, &result), 0);
+    assert_float_equal(result, DBL_EPSILON, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_maximum(DBL_MAX, 0, &result), 0);
+    assert_float_equal(result, DBL_MAX, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_maximum(0, DBL_MAX, &result), 0);
+    assert_float_equal(result, DBL_MAX, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_maximum(-DBL_MAX, 0, &result), 0);
+    assert_float_equal(result, 0, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_maximum(0, -DBL_MAX, &result), 0);
+    assert_float_equal(result, 0, DBL_EPSILON);
+}
+
+static void check_double_add_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_add(0, 0, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_add_error_on_result_is_inconsistent(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_add(DBL_MAX, DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_add(-DBL_MAX, -DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_double_add_error_on_result_is_unchanged(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_add(DBL_MAX, 1, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED);
+    assert_int_equal(
+            seagrass_double_add(1, DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED);
+}
+
+static void check_double_add(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_add(1, 1, &result), 0);
+    assert_float_equal(result, 2, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_add(100000, 100000, &result), 0);
+    assert_float_equal(result, 200000, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_add(1000000000, 1000000000, &result), 0);
+    assert_float_equal(result, 2000000000, DBL_EPSILON);
+}
+
+static void check_double_subtract_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_subtract(0, 0, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_subtract_error_on_result_is_inconsistent(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_subtract(DBL_MAX, -DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_subtract(-DBL_MAX, DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_double_subtract_error_on_result_is_unchanged(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_subtract(-DBL_MAX, 1, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED);
+    assert_int_equal(
+            seagrass_double_subtract(-1, DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED);
+}
+
+static void check_double_subtract(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_subtract(1, 1, &result), 0);
+    assert_float_equal(result, 0, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_subtract(100000, 1000000, &result), 0);
+    assert_float_equal(result, -900000, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_subtract(1000000000, -1000000000, &result), 0);
+    assert_float_equal(result, 2000000000, DBL_EPSILON);
+}
+
+static void check_double_multiply_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_multiply(0, 1, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_multiply_error_on_result_is_inconsistent(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_multiply(2, DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_multiply(DBL_MAX, 2, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_multiply(2, -DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_multiply(-DBL_MAX, 2, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_double_multiply(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_multiply(2, 2, &result), 0);
+    assert_float_equal(4, result, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_multiply(20000, 20000, &result), 0);
+    assert_float_equal(400000000, result, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_multiply(20000, -20000, &result), 0);
+    assert_float_equal(-400000000, result, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_multiply(400000000, 0, &result), 0);
+    assert_float_equal(0, result, DBL_EPSILON);
+    assert_int_equal(
+            seagrass_double_multiply(0, 400000000, &result), 0);
+    assert_float_equal(0, result, DBL_EPSILON);
+}
+
+static void check_double_divide_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_divide(2, 1, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_divide_error_on_divide_by_zero(void **state) {
+    assert_int_equal(
+            seagrass_double_divide(1, 0, (void *) 1),
+            SEAGRASS_DOUBLE_ERROR_DIVIDE_BY_ZERO);
+}
+
+static void check_double_divide_error_on_result_is_inconsistent(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_divide(DBL_MAX, 0.00001, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_double_divide(void **state) {
+    double result;
+    assert_int_equal(seagrass_double_divide(1, -0.1, &result), 0);
+    assert_float_equal(-10, result, DBL_EPSILON);
+}
+
+static void check_double_add_exact_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_add_exact(1, 2, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_add_exact_error_on_result_is_inconsistent(
+        void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_add_exact(DBL_MAX, DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_add_exact(-DBL_MAX, -DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_add_exact(INFINITY, 1, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_add_exact(NAN, 1, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    /* rounded to 10000000000000004 */
+    assert_int_equal(
+            seagrass_double_add_exact(1e16, 3, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_double_add_exact_error_on_result_is_unchanged(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_add_exact(1, DBL_EPSILON / 4, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED);
+    assert_int_equal(
+            seagrass_double_add_exact(DBL_EPSILON / 4, 1, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED);
+}
+
+static void check_double_add_exact(void **state) {
+    double result;
+    assert_int_equal(seagrass_double_add_exact(1, 2, &result), 0);
+    assert_true(3 == result);
+    assert_int_equal(seagrass_double_add_exact(1, -1, &result), 0);
+    assert_true(0 == result);
+    assert_int_equal(seagrass_double_add_exact(0, 0, &result), 0);
+    assert_true(0 == result);
+    /* within the tolerance of add but still a change */
+    assert_int_equal(seagrass_double_add_exact(1, DBL_EPSILON, &result), 0);
+    assert_true(1 + DBL_EPSILON == result);
+}
+
+static void check_double_subtract_exact_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_subtract_exact(1, 2, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_subtract_exact_error_on_result_is_inconsistent(
+        void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_subtract_exact(DBL_MAX, -DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_subtract_exact(INFINITY, INFINITY, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_subtract_exact(1e16, -3, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_double_subtract_exact_error_on_result_is_unchanged(
+        void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_subtract_exact(1, DBL_EPSILON / 4, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED);
+    assert_int_equal(
+            seagrass_double_subtract_exact(DBL_EPSILON / 4, 1, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_UNCHANGED);
+}
+
+static void check_double_subtract_exact(void **state) {
+    double result;
+    assert_int_equal(seagrass_double_subtract_exact(1, 2, &result), 0);
+    assert_true(-1 == result);
+    assert_int_equal(seagrass_double_subtract_exact(2, 2, &result), 0);
+    assert_true(0 == result);
+}
+
+static void check_double_multiply_exact_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_multiply_exact(1, 2, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_multiply_exact_error_on_result_is_inconsistent(
+        void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_multiply_exact(2, DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_multiply_exact(-DBL_MAX, 2, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_multiply_exact(DBL_MIN, DBL_MIN, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_multiply_exact(INFINITY, 0, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    /* rounded to a subnormal number */
+    assert_int_equal(
+            seagrass_double_multiply_exact(3e-160, 1e-160, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_multiply_exact(1.1, 1.1, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_double_multiply_exact(void **state) {
+    double result;
+    assert_int_equal(seagrass_double_multiply_exact(20000, -20000, &result),
+                     0);
+    assert_true(-400000000 == result);
+    assert_int_equal(seagrass_double_multiply_exact(0, DBL_MAX, &result), 0);
+    assert_true(0 == result);
+    /* zero for multiply but representable */
+    assert_int_equal(seagrass_double_multiply_exact(DBL_EPSILON,
+                                                    DBL_EPSILON, &result),
+                     0);
+    assert_true(DBL_EPSILON * DBL_EPSILON == result);
+    /* subnormal but exact */
+    assert_int_equal(seagrass_double_multiply_exact(DBL_MIN, 0.5, &result), 0);
+    assert_true(DBL_MIN / 2 == result);
+}
+
+static void check_double_divide_exact_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_divide_exact(1, 2, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_divide_exact_error_on_divide_by_zero(void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_divide_exact(1, 0, &result),
+            SEAGRASS_DOUBLE_ERROR_DIVIDE_BY_ZERO);
+    assert_int_equal(
+            seagrass_double_divide_exact(1, -0.0, &result),
+            SEAGRASS_DOUBLE_ERROR_DIVIDE_BY_ZERO);
+}
+
+static void check_double_divide_exact_error_on_result_is_inconsistent(
+        void **state) {
+    double result;
+    assert_int_equal(
+            seagrass_double_divide_exact(DBL_MAX, 0.5, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_divide_exact(DBL_MIN, DBL_MAX, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_divide_exact(NAN, 1, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_divide_exact(1, 3, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_double_divide_exact(DBL_MIN, 3, &result),
+            SEAGRASS_DOUBLE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_double_divide_exact(void **state) {
+    double result;
+    assert_int_equal(seagrass_double_divide_exact(1, -0.125, &result), 0);
+    assert_true(-8 == result);
+    assert_int_equal(seagrass_double_divide_exact(0, 3, &result), 0);
+    assert_true(0 == result);
+    /* division by zero for divide but not exactly zero */
+    assert_int_equal(seagrass_double_divide_exact(DBL_EPSILON,
+                                                  DBL_EPSILON, &result),
+                     0);
+    assert_true(1 == result);
+    /* subnormal but exact */
+    assert_int_equal(seagrass_double_divide_exact(DBL_MIN, 4, &result), 0);
+    assert_true(DBL_MIN / 4 == result);
+}
+
+static void check_double_is_equal_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_is_equal(0, 0, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_is_equal(void **state) {
+    bool result;
+    assert_int_equal(
+            seagrass_double_is_equal(1.0, 1.0, &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_double_is_equal(1.1, 1.0, &result), 0);
+    assert_false(result);
+}
+
+static void check_double_is_greater_than_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_is_greater_than(0, 1.2, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_is_greater_than(void **state) {
+    bool result;
+    assert_int_equal(
+            seagrass_double_is_greater_than(0.12, 1.0, &result), 0);
+    assert_false(result);
+    assert_int_equal(
+            seagrass_double_is_greater_than(1.0, 0.12, &result), 0);
+    assert_true(result);
+}
+
+static void check_double_is_less_than_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_is_less_than(1.0, 0, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_is_less_than(void **state) {
+    bool result;
+    assert_int_equal(
+            seagrass_double_is_less_than(2.1, 1.2, &result), 0);
+    assert_false(result);
+    assert_int_equal(
+            seagrass_double_is_less_than(1.1, 1.2, &result), 0);
+    assert_true(result);
+}
+
+static void check_double_is_greater_or_equal_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_is_greater_or_equal(1.0, 0, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_is_greater_or_equal(void **state) {
+    bool result;
+    assert_int_equal(
+            seagrass_double_is_greater_or_equal(1.1, 1.0, &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_double_is_greater_or_equal(1.0, 1.0, &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_double_is_greater_or_equal(0.9, 1.0, &result), 0);
+    assert_false(result);
+}
+
+static void
+check_double_is_less_than_or_equal_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_is_greater_or_equal(1.0, 1.1, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void check_double_is_less_than_or_equal(void **state) {
+    bool result;
+    assert_int_equal(
+            seagrass_double_is_less_or_equal(1.1, 2.1, &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_double_is_less_or_equal(1.1, 1.1, &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_double_is_less_or_equal(1.0, 0.9, &result), 0);
+    assert_false(result);
+}
+
+static void check_double_to_uintmax_t_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(0, 0, NULL),
+            SEAGRASS_DOUBLE_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_double_to_uintmax_t_error_on_rounding_mode_is_invalid(void **state) {
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(0, ~0, (void *) 1),
+            SEAGRASS_DOUBLE_ERROR_ROUNDING_MODE_IS_INVALID);
+}
+
+static void
+check_double_to_uintmax_t_error_on_double_value_is_negative(void **state) {
+    uintmax_t result;
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    -DBL_EPSILON,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_TOWARDS_ZERO,
+                    &result),
+                    SEAGRASS_DOUBLE_ERROR_FLOAT_VALUE_IS_NEGATIVE);
+}
+
+static void
+check_double_to_uintmax_t_error_on_double_value_too_large(void **state) {
+    uintmax_t result;
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    DBL_MAX,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_NEAREST,
+                    &result),
+                    SEAGRASS_DOUBLE_ERROR_FLOAT_VALUE_TOO_LARGE);
+}
+
+static void check_double_to_uintmax_t_with_rounding_mode_nearest(void **state) {
+    uintmax_t result;
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    6.2,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_NEAREST,
+                    &result), 0);
+    assert_int_equal(6, result);
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    18.7,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_NEAREST,
+                    &result), 0);
+    assert_int_equal(19, result);
+}
+
+static void
+check_double_to_uintmax_t_with_rounding_mode_downward(void **state) {
+    uintmax_t result;
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    6.2,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_DOWNWARD,
+                    &result), 0);
+    assert_int_equal(6, result);
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    19.7,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_DOWNWARD,
+                    &result), 0);
+    assert_int_equal(19, result);
+}
+
+static void check_double_to_uintmax_t_with_rounding_mode_upward(void **state) {
+    uintmax_t result;
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    6.2,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_UPWARD,
+                    &result), 0);
+    assert_int_equal(7, result);
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    19.7,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_UPWARD,
+                    &result), 0);
+    assert_int_equal(20, result);
+}
+
+static void
+check_double_to_uintmax_t_with_rounding_mode_towards_zero(void **state) {
+    uintmax_t result;
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    6.2,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_TOWARDS_ZERO,
+                    &result), 0);
+    assert_int_equal(6, result);
+    assert_int_equal(
+            seagrass_double_to_uintmax_t(
+                    19.7,
+                    SEAGRASS_FLOAT_ROUNDING_MODE_TOWARDS_ZERO,
+                    &result), 0);
+    assert_int_equal(19, result);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_double_ptr_compare),
+            cmocka_unit_test(check_double_compare),
+            cmocka_unit_test(check_double_minimum_error_on_out_is_null),
+            cmocka_unit_test(check_double_minimum),
+            cmocka_unit_test(check_double_maximum_error_on_out_is_null),
+            cmocka_unit_test(check_double_maximum),
+            cmocka_unit_test(check_double_add_error_on_out_is_null),
+            cmocka_unit_test(check_double_add_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_double_add_error_on_result_is_unchanged),
+            cmocka_unit_test(check_double_add),
+            cmocka_unit_test(check_double_subtract_error_on_out_is_null),
+            cmocka_unit_test(check_double_subtract_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_double_subtract_error_on_result_is_unchanged),
+            cmocka_unit_test(check_double_subtract),
+            cmocka_unit_test(check_double_multiply_error_on_out_is_null),
+            cmocka_unit_test(check_double_multiply_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_double_multiply),
+            cmocka_unit_test(check_double_divide_error_on_out_is_null),
+            cmocka_unit_test(check_double_divide_error_on_divide_by_zero),
+            cmocka_unit_test(check_double_divide_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_double_divide),
+            cmocka_unit_test(check_double_add_exact_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_double_add_exact_error_on_result_is_inconsistent),
+            cmocka_unit_test(
+                    check_double_add_exact_error_on_result_is_unchanged),
+            cmocka_unit_test(check_double_add_exact),
+            cmocka_unit_test(check_double_subtract_exact_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_double_subtract_exact_error_on_result_is_inconsistent),
+            cmocka_unit_test(
+                    check_double_subtract_exact_error_on_result_is_unchanged),
+            cmocka_unit_test(check_double_subtract_exact),
+            cmocka_unit_test(check_double_multiply_exact_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_double_multiply_exact_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_double_multiply_exact),
+            cmocka_unit_test(check_double_divide_exact_error_on_out_is_null),
+            cmocka_unit_test(check_double_divide_exact_error_on_divide_by_zero),
+            cmocka_unit_test(
+                    check_double_divide_exact_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_double_divide_exact),
+            cmocka_unit_test(check_double_is_equal_error_on_out_is_null),
+            cmocka_unit_test(check_double_is_equal),
+            cmocka_unit_test(check_double_is_greater_than_error_on_out_is_null),
+            cmocka_unit_test(check_double_is_greater_than),
+            cmocka_unit_test(check_double_is_less_than_error_on_out_is_null),
+            cmocka_unit_test(check_double_is_less_than),
+            cmocka_unit_test(check_double_is_greater_or_equal_error_on_out_is_null),
+            cmocka_unit_test(check_double_is_greater_or_equal),
+            cmocka_unit_test(check_double_is_less_than_or_equal_error_on_out_is_null),
+            cmocka_unit_test(check_double_is_less_than_or_equal),
+            cmocka_unit_test(check_double_to_uintmax_t_error_on_out_is_null),
+            cmocka_unit_test(check_double_to_uintmax_t_error_on_rounding_mode_is_invalid),
+            cmocka_unit_test(check_double_to_uintmax_t_error_on_double_value_is_negative),
+            cmocka_unit_test(check_double_to_uintmax_t_error_on_double_value_too_large),
+            cmocka_unit_test(check_double_to_uintmax_t_with_rounding_mode_nearest),
+            cmocka_unit_test(check_double_to_uintmax_t_with_rounding_mode_downward),
+            cmocka_unit_test(check_double_to_uintmax_t_with_rounding_mode_upward),
+            cmocka_unit_test(check_double_to_uintmax_t_with_rounding_mode_towards_zero),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -5,6 +5,9 @@
 #include <cmocka.h>
 #include <string.h>
 #include <float.h>
+#include <errno.h>
+#include <math.h>
+#include <fenv.h>
 #include <seagrass.h>
 
 #include <test/cmocka.h>
@@ -244,6 +247,194 @@ static void check_float_divide(void **state) {
     assert_float_equal(-10, result, FLT_EPSILON);
 }
 
+static void check_float_add_exact_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_add_exact(1, 2, NULL),
+            SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_add_exact_error_on_result_is_inconsistent(
+        void **state) {
+    float result;
+    assert_int_equal(
+            seagrass_float_add_exact(FLT_MAX, FLT_MAX, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_add_exact(-FLT_MAX, -FLT_MAX, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_add_exact(INFINITY, 1, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_add_exact(NAN, 1, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    /* rounded to 100000008 */
+    assert_int_equal(
+            seagrass_float_add_exact(1e8f, 5, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_float_add_exact_error_on_result_is_unchanged(void **state) {
+    float result;
+    assert_int_equal(
+            seagrass_float_add_exact(1, FLT_EPSILON / 4, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED);
+    assert_int_equal(
+            seagrass_float_add_exact(FLT_EPSILON / 4, 1, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED);
+}
+
+static void check_float_add_exact(void **state) {
+    float result;
+    assert_int_equal(seagrass_float_add_exact(1, 2, &result), 0);
+    assert_true(3 == result);
+    assert_int_equal(seagrass_float_add_exact(1, -1, &result), 0);
+    assert_true(0 == result);
+    assert_int_equal(seagrass_float_add_exact(0, 0, &result), 0);
+    assert_true(0 == result);
+    /* within the tolerance of add but still a change */
+    assert_int_equal(seagrass_float_add_exact(1, FLT_EPSILON, &result), 0);
+    assert_true(1 + FLT_EPSILON == result);
+}
+
+static void check_float_subtract_exact_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_subtract_exact(1, 2, NULL),
+            SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_subtract_exact_error_on_result_is_inconsistent(
+        void **state) {
+    float result;
+    assert_int_equal(
+            seagrass_float_subtract_exact(FLT_MAX, -FLT_MAX, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_subtract_exact(INFINITY, INFINITY, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_subtract_exact(1e8f, -5, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_float_subtract_exact_error_on_result_is_unchanged(
+        void **state) {
+    float result;
+    assert_int_equal(
+            seagrass_float_subtract_exact(1, FLT_EPSILON / 4, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED);
+    assert_int_equal(
+            seagrass_float_subtract_exact(FLT_EPSILON / 4, 1, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED);
+}
+
+static void check_float_subtract_exact(void **state) {
+    float result;
+    assert_int_equal(seagrass_float_subtract_exact(1, 2, &result), 0);
+    assert_true(-1 == result);
+    assert_int_equal(seagrass_float_subtract_exact(2, 2, &result), 0);
+    assert_true(0 == result);
+}
+
+static void check_float_multiply_exact_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_multiply_exact(1, 2, NULL),
+            SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_multiply_exact_error_on_result_is_inconsistent(
+        void **state) {
+    float result;
+    assert_int_equal(
+            seagrass_float_multiply_exact(2, FLT_MAX, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_multiply_exact(-FLT_MAX, 2, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_multiply_exact(FLT_MIN, FLT_MIN, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_multiply_exact(INFINITY, 0, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    /* rounded to a subnormal number */
+    assert_int_equal(
+            seagrass_float_multiply_exact(3e-20f, 1e-19f, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_multiply_exact(1.1f, 1.1f, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_float_multiply_exact(void **state) {
+    float result;
+    assert_int_equal(seagrass_float_multiply_exact(20000, -20000, &result),
+                     0);
+    assert_true(-400000000 == result);
+    assert_int_equal(seagrass_float_multiply_exact(0, FLT_MAX, &result), 0);
+    assert_true(0 == result);
+    /* zero for multiply but representable */
+    assert_int_equal(seagrass_float_multiply_exact(FLT_EPSILON,
+                                                    FLT_EPSILON, &result),
+                     0);
+    assert_true(FLT_EPSILON * FLT_EPSILON == result);
+    /* subnormal but exact */
+    assert_int_equal(seagrass_float_multiply_exact(FLT_MIN, 0.5, &result), 0);
+    assert_true(FLT_MIN / 2 == result);
+}
+
+static void check_float_divide_exact_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_divide_exact(1, 2, NULL),
+            SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_divide_exact_error_on_divide_by_zero(void **state) {
+    float result;
+    assert_int_equal(
+            seagrass_float_divide_exact(1, 0, &result),
+            SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO);
+    assert_int_equal(
+            seagrass_float_divide_exact(1, -0.0, &result),
+            SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO);
+}
+
+static void check_float_divide_exact_error_on_result_is_inconsistent(
+        void **state) {
+    float result;
+    assert_int_equal(
+            seagrass_float_divide_exact(FLT_MAX, 0.5, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_divide_exact(FLT_MIN, FLT_MAX, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_divide_exact(NAN, 1, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_divide_exact(1, 3, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_float_divide_exact(FLT_MIN, 3, &result),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_float_divide_exact(void **state) {
+    float result;
+    assert_int_equal(seagrass_float_divide_exact(1, -0.125, &result), 0);
+    assert_true(-8 == result);
+    assert_int_equal(seagrass_float_divide_exact(0, 3, &result), 0);
+    assert_true(0 == result);
+    /* division by zero for divide but not exactly zero */
+    assert_int_equal(seagrass_float_divide_exact(FLT_EPSILON,
+                                                  FLT_EPSILON, &result),
+                     0);
+    assert_true(1 == result);
+    /* subnormal but exact */
+    assert_int_equal(seagrass_float_divide_exact(FLT_MIN, 4, &result), 0);
+    assert_true(FLT_MIN / 4 == result);
+}
+
 static void check_float_is_equal_error_on_out_is_null(void **state) {
     assert_int_equal(
             seagrass_float_is_equal(0, 0, NULL),
@@ -432,6 +623,964 @@ check_float_to_uintmax_t_with_rounding_mode_towards_zero(void **state) {
     assert_int_equal(19, result);
 }
 
+static void check_float_sum_n_error_on_values_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_sum_n(NULL, 1, SEAGRASS_FLOAT_SUMMATION_PAIRWISE,
+                                 (void *) 1, NULL),
+            SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+}
+
+static void check_float_sum_n_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_sum_n((void *) 1, 1,
+                                 SEAGRASS_FLOAT_SUMMATION_PAIRWISE,
+                                 NULL, NULL),
+            SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_sum_n_error_on_summation_is_invalid(void **state) {
+    const float values[] = {1.0f};
+    float out;
+    assert_int_equal(
+            seagrass_float_sum_n(values, 1, 3, &out, NULL),
+            SEAGRASS_FLOAT_ERROR_SUMMATION_IS_INVALID);
+}
+
+static void check_float_sum_n_error_on_result_is_inconsistent(void **state) {
+    const float values[] = {1.0f, INFINITY, 2.0f};
+    const float overflow[] = {FLT_MAX, FLT_MAX};
+    float out;
+    for (int i = 0; i <= SEAGRASS_FLOAT_SUMMATION_DOUBLE; i++) {
+        assert_int_equal(
+                seagrass_float_sum_n(values, 3, i, &out, NULL),
+                SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+        assert_int_equal(
+                seagrass_float_sum_n(overflow, 2, i, &out, NULL),
+                SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    }
+}
+
+static void check_float_sum_n(void **state) {
+    const uintmax_t count = 100003;
+    float *values = malloc(count * sizeof(*values));
+    assert_non_null(values);
+    values[0] = 1e8f;
+    double exact = values[0];
+    for (uintmax_t i = 1; i < count; i++) {
+        values[i] = (float) (i % 7) * 0.1f + 0.25f;
+        exact += values[i];
+    }
+    float out, error;
+    /* where repeated addition would not be able to make any progress */
+    assert_int_equal(
+            seagrass_float_add(values[0], values[1], &out),
+            SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED);
+    for (int i = 0; i <= SEAGRASS_FLOAT_SUMMATION_DOUBLE; i++) {
+        assert_int_equal(
+                seagrass_float_sum_n(values, count, i, &out, &error), 0);
+        assert_true(fabs(out - exact) <= error);
+        /* within two units in the last place */
+        assert_true(fabs(out - exact) <= 2 * (nextafterf(out, INFINITY) - out));
+        assert_int_equal(
+                seagrass_float_sum_n(values, count, i, &out, NULL), 0);
+    }
+    free(values);
+}
+
+static void check_float_sum_n_short(void **state) {
+    const float values[] = {1.0f, -2.0f, 3.0f, 4.0f, 0.5f};
+    float out, error;
+    for (int i = 0; i <= SEAGRASS_FLOAT_SUMMATION_DOUBLE; i++) {
+        for (uintmax_t count = 0; count <= 5; count++) {
+            float expected = 0;
+            for (uintmax_t j = 0; j < count; j++) {
+                expected += values[j];
+            }
+            assert_int_equal(
+                    seagrass_float_sum_n(values, count, i, &out, &error), 0);
+            assert_true(expected == out);
+            assert_true(error >= 0);
+        }
+    }
+}
+
+static void check_float_extremes_n_error_on_values_is_null(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_minimum_n(NULL, 1, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_float_maximum_n(NULL, 1, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_float_minmax_n(NULL, 1, &out, NULL, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+}
+
+static void check_float_extremes_n_error_on_count_is_zero(void **state) {
+    const float values[] = {1};
+    float out;
+    assert_int_equal(seagrass_float_minimum_n(values, 0, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_float_maximum_n(values, 0, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_float_minmax_n(values, 0, &out, NULL,
+                                             &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_COUNT_IS_ZERO);
+}
+
+static void check_float_extremes_n_error_on_out_is_null(void **state) {
+    const float values[] = {1};
+    float out;
+    assert_int_equal(seagrass_float_minimum_n(values, 1, NULL, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_float_maximum_n(values, 1, NULL, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_float_minmax_n(values, 1, NULL, NULL,
+                                             &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_float_minmax_n(values, 1, &out, NULL,
+                                             NULL, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_float_extremes_n_error_on_result_is_inconsistent(void **state) {
+    float values[100] = {0};
+    float out;
+    for (uintmax_t i = 0; i < 100; i += 33) {
+        values[i] = i % 2 ? NAN : -NAN;
+        assert_int_equal(seagrass_float_minimum_n(values, 100, &out, NULL),
+                         SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+        assert_int_equal(seagrass_float_maximum_n(values, 100, &out, NULL),
+                         SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+        assert_int_equal(seagrass_float_minmax_n(values, 100, &out, NULL,
+                                                 &out, NULL),
+                         SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+        values[i] = 0;
+    }
+}
+
+static void check_float_extremes_n(void **state) {
+    enum {
+        COUNT = 2500
+    };
+    static float values[COUNT];
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = (float) ((i * 2654435761u) % 1000003) * 0.001f - 500.0f;
+    }
+    /* repeated extremes in different blocks and lanes */
+    values[1500] = values[2100] = -INFINITY;
+    values[1700] = values[2400] = 1e30f;
+    /* ordered exactly rather than within FLT_EPSILON */
+    values[3] = 1e30f - 1e23f;
+    for (uintmax_t count = 1; count <= COUNT; count += 37) {
+        uintmax_t low = 0, high = 0;
+        for (uintmax_t i = 1; i < count; i++) {
+            low = values[i] < values[low] ? i : low;
+            high = values[i] > values[high] ? i : high;
+        }
+        float out;
+        uintmax_t index;
+        assert_int_equal(
+                seagrass_float_minimum_n(values, count, &out, &index), 0);
+        assert_true(out == values[low]);
+        assert_int_equal(index, low);
+        assert_int_equal(
+                seagrass_float_maximum_n(values, count, &out, &index), 0);
+        assert_true(out == values[high]);
+        assert_int_equal(index, high);
+        float minimum, maximum;
+        uintmax_t minimum_index, maximum_index;
+        assert_int_equal(
+                seagrass_float_minmax_n(values, count,
+                                        &minimum, &minimum_index,
+                                        &maximum, &maximum_index), 0);
+        assert_true(minimum == values[low]);
+        assert_int_equal(minimum_index, low);
+        assert_true(maximum == values[high]);
+        assert_int_equal(maximum_index, high);
+    }
+}
+
+static void check_float_extremes_n_signed_zero(void **state) {
+    const float values[] = {0.0f, 1.0f, -0.0f, 0.0f};
+    float out;
+    uintmax_t index;
+    assert_int_equal(seagrass_float_minimum_n(values, 4, &out, &index), 0);
+    assert_true(signbit(out));
+    assert_int_equal(index, 2);
+    assert_int_equal(seagrass_float_maximum_n(values, 4, &out, &index), 0);
+    assert_true(out == 1.0f);
+    assert_int_equal(index, 1);
+}
+
+static void check_float_sum_n_error_on_summation_is_invalid_with_fast_denormals(
+        void **state) {
+    const float values[] = {1.0f};
+    float out;
+    assert_int_equal(
+            seagrass_float_sum_n(values, 1,
+                                 3 | SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS,
+                                 &out, NULL),
+            SEAGRASS_FLOAT_ERROR_SUMMATION_IS_INVALID);
+}
+
+static void check_float_sum_n_fast_denormals(void **state) {
+    const uintmax_t count = 1001;
+    float *values = malloc(count * sizeof(*values));
+    assert_non_null(values);
+    /* subnormal values and a single normal one */
+    double exact = 0;
+    for (uintmax_t i = 0; i < count; i++) {
+        values[i] = i == count / 2 ? 1.0f : FLT_MIN / (float) (2 + i % 5);
+        exact += values[i];
+    }
+    bool supported;
+    assert_int_equal(seagrass_float_fast_denormals_is_supported(&supported),
+                     0);
+    float out, error;
+    for (int i = 0; i <= SEAGRASS_FLOAT_SUMMATION_DOUBLE; i++) {
+        assert_int_equal(
+                seagrass_float_sum_n(
+                        values, count,
+                        i | SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS,
+                        &out, &error), 0);
+        assert_true(fabs(out - exact) <= error);
+        if (supported) {
+            assert_true(1.0f == out);
+        }
+    }
+    /* subnormal numbers are back once the sum is done */
+    volatile float tiny = FLT_MIN;
+    assert_true(tiny / 4 > 0);
+    free(values);
+}
+
+static void check_float_fast_denormals_is_supported_error_on_out_is_null(
+        void **state) {
+    assert_int_equal(seagrass_float_fast_denormals_is_supported(NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_fast_denormals_begin_error_on_out_is_null(
+        void **state) {
+    assert_int_equal(seagrass_float_fast_denormals_begin(NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_fast_denormals_end_error_on_object_is_null(
+        void **state) {
+    assert_int_equal(seagrass_float_fast_denormals_end(NULL),
+                     SEAGRASS_FLOAT_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_float_fast_denormals(void **state) {
+    bool supported;
+    assert_int_equal(seagrass_float_fast_denormals_is_supported(&supported),
+                     0);
+    volatile float tiny = FLT_MIN;
+    volatile double tinier = DBL_MIN;
+    struct seagrass_float_fast_denormals outer, inner;
+    assert_int_equal(seagrass_float_fast_denormals_begin(&outer), 0);
+    assert_true(supported == (0 == tiny / 4));
+    assert_true(supported == (0 == tinier / 4));
+    assert_int_equal(seagrass_float_fast_denormals_begin(&inner), 0);
+    assert_true(supported == (0 == tiny / 4));
+    assert_int_equal(seagrass_float_fast_denormals_end(&inner), 0);
+    /* still within the outer scope */
+    assert_true(supported == (0 == tiny / 4));
+    feclearexcept(FE_ALL_EXCEPT);
+    volatile float one = 1.0f;
+    assert_true(one / 3 > 0);
+    assert_int_equal(seagrass_float_fast_denormals_end(&outer), 0);
+    assert_true(fetestexcept(FE_INEXACT));
+    assert_true(tiny / 4 > 0);
+    assert_true(tinier / 4 > 0);
+}
+
+static void check_float_fast_denormals_add(void **state) {
+    bool supported;
+    assert_int_equal(seagrass_float_fast_denormals_is_supported(&supported),
+                     0);
+    float out;
+    struct seagrass_float_fast_denormals scope;
+    assert_int_equal(seagrass_float_fast_denormals_begin(&scope), 0);
+    const int result = seagrass_float_add(1.0f, FLT_MIN / 4, &out);
+    assert_int_equal(seagrass_float_fast_denormals_end(&scope), 0);
+    if (supported) {
+        /* the subnormal operand reads as zero */
+        assert_int_equal(result, 0);
+        assert_true(1.0f == out);
+    } else {
+        assert_int_equal(result, SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED);
+    }
+    assert_int_equal(seagrass_float_add(1.0f, FLT_MIN / 4, &out),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED);
+}
+
+static void check_float_dot_error_on_values_is_null(void **state) {
+    const float values[] = {1.0f};
+    float out;
+    assert_int_equal(seagrass_float_dot(NULL, values, 1, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_float_dot(values, NULL, 1, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+}
+
+static void check_float_dot_error_on_out_is_null(void **state) {
+    const float values[] = {1.0f};
+    assert_int_equal(seagrass_float_dot(values, values, 1, NULL, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_dot_error_on_result_is_inconsistent(void **state) {
+    float a[] = {1.0f, FLT_MAX, FLT_MAX, 1.0f};
+    const float b[] = {1.0f, 2.0f, 2.0f, 1.0f};
+    float out = 5;
+    assert_int_equal(seagrass_float_dot(a, b, 4, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_true(5 == out);
+    a[1] = 1.0f;
+    a[2] = NAN;
+    assert_int_equal(seagrass_float_dot(a, b, 4, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    a[2] = INFINITY;
+    assert_int_equal(seagrass_float_dot(a, b, 4, &out, NULL),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_float_dot(void **state) {
+    const uintmax_t count = 10007;
+    float *a = malloc(count * sizeof(*a));
+    float *b = malloc(count * sizeof(*b));
+    assert_non_null(a);
+    assert_non_null(b);
+    double exact = 0;
+    for (uintmax_t i = 0; i < count; i++) {
+        a[i] = (float) (i % 13) * 0.1f - 0.6f;
+        b[i] = (float) (i % 7) * 0.3f + 0.25f;
+        exact += (double) a[i] * b[i];
+    }
+    float out, error;
+    assert_int_equal(seagrass_float_dot(a, b, count, &out, &error), 0);
+    assert_true(fabs(out - exact) <= error);
+    assert_true(error < 1);
+    /* every length of the tail */
+    for (uintmax_t n = 0; n <= 17; n++) {
+        float expected = 0;
+        for (uintmax_t i = 0; i < n; i++) {
+            expected += a[i] * b[i];
+        }
+        assert_int_equal(seagrass_float_dot(a, b, n, &out, &error), 0);
+        assert_true(fabsf(out - expected) <= 2 * error);
+        assert_true(error >= 0);
+    }
+    assert_int_equal(seagrass_float_dot(NULL, NULL, 0, &out, NULL), 0);
+    assert_true(0 == out);
+    free(a);
+    free(b);
+}
+
+static void check_float_axpy_error_on_values_is_null(void **state) {
+    float values[] = {1.0f};
+    assert_int_equal(seagrass_float_axpy(1, NULL, 1, values, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_float_axpy(1, values, 1, NULL, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+}
+
+static void check_float_axpy_error_on_result_is_inconsistent(void **state) {
+    const uintmax_t count = 3000;
+    float *x = malloc(count * sizeof(*x));
+    float *y = malloc(count * sizeof(*y));
+    assert_non_null(x);
+    assert_non_null(y);
+    for (uintmax_t i = 0; i < count; i++) {
+        x[i] = 1.0f;
+        y[i] = (float) i;
+    }
+    y[2500] = FLT_MAX;
+    uintmax_t index;
+    assert_int_equal(seagrass_float_axpy(FLT_MAX, x, count, y, &index),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(index, 2500);
+    for (uintmax_t i = 0; i < index; i++) {
+        assert_true(FLT_MAX + (float) i == y[i]);
+    }
+    assert_true(FLT_MAX == y[index]);
+    for (uintmax_t i = index + 1; i < count; i++) {
+        assert_true((float) i == y[i]);
+    }
+    x[7] = NAN;
+    assert_int_equal(seagrass_float_axpy(0, x, count, y, &index),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(index, 7);
+    assert_true(FLT_MAX + 7.0f == y[7]);
+    assert_true(2501.0f == y[2501]);
+    free(x);
+    free(y);
+}
+
+static void check_float_axpy(void **state) {
+    const uintmax_t count = 2053;
+    float *x = malloc(count * sizeof(*x));
+    float *y = malloc(count * sizeof(*y));
+    assert_non_null(x);
+    assert_non_null(y);
+    for (uintmax_t i = 0; i < count; i++) {
+        x[i] = (float) (i % 11) - 5.0f;
+        y[i] = (float) i;
+    }
+    assert_int_equal(seagrass_float_axpy(2.0f, x, count, y, NULL), 0);
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_true(2.0f * ((float) (i % 11) - 5.0f) + (float) i == y[i]);
+    }
+    /* x and y may be the same array */
+    assert_int_equal(seagrass_float_axpy(1.0f, y, count, y, NULL), 0);
+    assert_true(184.0f == y[100]);
+    assert_int_equal(seagrass_float_axpy(1.0f, NULL, 0, NULL, NULL), 0);
+    free(x);
+    free(y);
+}
+
+static void check_float_gemv_error_on_values_is_null(void **state) {
+    float values[] = {1.0f};
+    assert_int_equal(seagrass_float_gemv(1, NULL, 1, 1, values, 0, values,
+                                         NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_float_gemv(1, values, 1, 1, NULL, 0, values,
+                                         NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+}
+
+static void check_float_gemv_error_on_out_is_null(void **state) {
+    float values[] = {1.0f};
+    assert_int_equal(seagrass_float_gemv(1, values, 1, 1, values, 0, NULL,
+                                         NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_gemv_error_on_result_is_inconsistent(void **state) {
+    const float matrix[] = {
+            1.0f, 2.0f,
+            FLT_MAX, FLT_MAX,
+            3.0f, 4.0f
+    };
+    const float x[] = {1.0f, 1.0f};
+    float y[] = {-1.0f, -1.0f, -1.0f};
+    uintmax_t index;
+    assert_int_equal(seagrass_float_gemv(1, matrix, 3, 2, x, 0, y, &index),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(index, 1);
+    assert_true(3.0f == y[0]);
+    assert_true(-1.0f == y[1]);
+    assert_true(-1.0f == y[2]);
+    y[0] = FLT_MAX;
+    assert_int_equal(seagrass_float_gemv(1, matrix, 1, 2, x, 2, y, &index),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(index, 0);
+}
+
+static void check_float_gemv(void **state) {
+    const uintmax_t rows = 5;
+    const uintmax_t columns = 19;
+    float matrix[5 * 19];
+    float x[19];
+    for (uintmax_t j = 0; j < columns; j++) {
+        x[j] = (float) j * 0.5f;
+        for (uintmax_t i = 0; i < rows; i++) {
+            matrix[i * columns + j] = (float) (i + j % 3);
+        }
+    }
+    /* not read with beta zero */
+    float y[] = {NAN, NAN, NAN, NAN, NAN};
+    assert_int_equal(seagrass_float_gemv(2, matrix, rows, columns, x, 0, y,
+                                         NULL), 0);
+    for (uintmax_t i = 0; i < rows; i++) {
+        float expected = 0;
+        for (uintmax_t j = 0; j < columns; j++) {
+            expected += matrix[i * columns + j] * x[j];
+        }
+        assert_true(2 * expected == y[i]);
+    }
+    float z[] = {1, 2, 3, 4, 5};
+    assert_int_equal(seagrass_float_gemv(1, matrix, rows, columns, x, -1, z,
+                                         NULL), 0);
+    for (uintmax_t i = 0; i < rows; i++) {
+        assert_true(y[i] / 2 - (float) (i + 1) == z[i]);
+    }
+    /* without columns the update only scales y */
+    assert_int_equal(seagrass_float_gemv(1, NULL, rows, 0, NULL, 2, z, NULL),
+                     0);
+    assert_true(2 * (y[0] / 2 - 1) == z[0]);
+    assert_int_equal(seagrass_float_gemv(1, NULL, 0, 0, NULL, 0, NULL, NULL),
+                     0);
+}
+
+static void check_float_find_invalid_n_error_on_values_is_null(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_float_find_invalid_n(
+            NULL, 1, SEAGRASS_FLOAT_RULE_FINITE, 0, 0, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+}
+
+static void check_float_find_invalid_n_error_on_out_is_null(void **state) {
+    const float values[] = {1.0f};
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, 1, SEAGRASS_FLOAT_RULE_FINITE, 0, 0, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_find_invalid_n_error_on_rules_is_invalid(
+        void **state) {
+    const float values[] = {1.0f};
+    uintmax_t out;
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, 1, 0x10, 0, 0, &out),
+                     SEAGRASS_FLOAT_ERROR_RULES_IS_INVALID);
+}
+
+static void check_float_find_invalid_n_error_on_range_is_invalid(
+        void **state) {
+    const float values[] = {1.0f};
+    uintmax_t out;
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, 1, SEAGRASS_FLOAT_RULE_RANGE, 2, 1, &out),
+                     SEAGRASS_FLOAT_ERROR_RANGE_IS_INVALID);
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, 1, SEAGRASS_FLOAT_RULE_RANGE, NAN, 1, &out),
+                     SEAGRASS_FLOAT_ERROR_RANGE_IS_INVALID);
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, 1, SEAGRASS_FLOAT_RULE_RANGE, 0, NAN, &out),
+                     SEAGRASS_FLOAT_ERROR_RANGE_IS_INVALID);
+    /* the bounds are ignored without the range rule */
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, 1, SEAGRASS_FLOAT_RULE_FINITE, NAN, NAN, &out), 0);
+    assert_int_equal(out, 1);
+}
+
+static void check_float_find_invalid_n_rules(void **state) {
+    const float values[] = {1.0f, -0.0f, -INFINITY, -2.0f, NAN, 5.0f};
+    const uintmax_t count = sizeof(values) / sizeof(values[0]);
+    uintmax_t out;
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, count, 0, 0, 0, &out), 0);
+    assert_int_equal(out, count);
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, count, SEAGRASS_FLOAT_RULE_NOT_NAN, 0, 0, &out), 0);
+    assert_int_equal(out, 4);
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, count, SEAGRASS_FLOAT_RULE_FINITE, 0, 0, &out), 0);
+    assert_int_equal(out, 2);
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, count, SEAGRASS_FLOAT_RULE_NON_NEGATIVE, 0, 0, &out), 0);
+    assert_int_equal(out, 2);
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values + 3, count - 3, SEAGRASS_FLOAT_RULE_RANGE, -2, 4, &out),
+                     0);
+    assert_int_equal(out, 2);
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, 2, SEAGRASS_FLOAT_RULE_RANGE
+                       | SEAGRASS_FLOAT_RULE_NON_NEGATIVE, -1, 1, &out), 0);
+    assert_int_equal(out, 2);
+    assert_int_equal(seagrass_float_find_invalid_n(
+            NULL, 0, SEAGRASS_FLOAT_RULE_FINITE, 0, 0, &out), 0);
+    assert_int_equal(out, 0);
+}
+
+static void check_float_find_invalid_n(void **state) {
+    const uintmax_t count = 5000;
+    float *values = malloc(count * sizeof(*values));
+    assert_non_null(values);
+    for (uintmax_t i = 0; i < count; i++) {
+        values[i] = (float) i;
+    }
+    const unsigned int rules = SEAGRASS_FLOAT_RULE_FINITE
+                               | SEAGRASS_FLOAT_RULE_RANGE;
+    uintmax_t out;
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, count, rules, 0, (float) count, &out), 0);
+    assert_int_equal(out, count);
+    /* the first of several invalid values, in every position of a block */
+    for (uintmax_t i = 1000; i < 1100; i++) {
+        values[i] = INFINITY;
+        values[i + 2000] = NAN;
+        assert_int_equal(seagrass_float_find_invalid_n(
+                values, count, rules, 0, (float) count, &out), 0);
+        assert_int_equal(out, i);
+        values[i] = (float) i;
+        values[i + 2000] = (float) (i + 2000);
+    }
+    assert_int_equal(seagrass_float_find_invalid_n(
+            values, count, rules, 0, 4321, &out), 0);
+    assert_int_equal(out, 4322);
+    free(values);
+}
+
+static void check_float_invalid_mask_n_error_on_values_is_null(
+        void **state) {
+    uint64_t out;
+    assert_int_equal(seagrass_float_invalid_mask_n(
+            NULL, 1, SEAGRASS_FLOAT_RULE_FINITE, 0, 0, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+}
+
+static void check_float_invalid_mask_n_error_on_out_is_null(void **state) {
+    const float values[] = {1.0f};
+    assert_int_equal(seagrass_float_invalid_mask_n(
+            values, 1, SEAGRASS_FLOAT_RULE_FINITE, 0, 0, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_invalid_mask_n_error_on_rules_is_invalid(
+        void **state) {
+    const float values[] = {1.0f};
+    uint64_t out;
+    assert_int_equal(seagrass_float_invalid_mask_n(
+            values, 1, ~0u, 0, 0, &out),
+                     SEAGRASS_FLOAT_ERROR_RULES_IS_INVALID);
+    assert_int_equal(seagrass_float_invalid_mask_n(
+            values, 1, SEAGRASS_FLOAT_RULE_RANGE, 1, 0, &out),
+                     SEAGRASS_FLOAT_ERROR_RANGE_IS_INVALID);
+}
+
+static void check_float_invalid_mask_n(void **state) {
+    float values[130];
+    for (uintmax_t i = 0; i < 130; i++) {
+        values[i] = (float) i - 10.0f;
+    }
+    values[70] = NAN;
+    values[129] = INFINITY;
+    uint64_t out[3];
+    assert_int_equal(seagrass_float_invalid_mask_n(
+            values, 130, SEAGRASS_FLOAT_RULE_NOT_NAN, 0, 0, out), 0);
+    assert_true(0 == out[0]);
+    assert_true((uint64_t) 1 << 6 == out[1]);
+    assert_true(0 == out[2]);
+    assert_int_equal(seagrass_float_invalid_mask_n(
+            values, 130, SEAGRASS_FLOAT_RULE_FINITE
+                         | SEAGRASS_FLOAT_RULE_NON_NEGATIVE, 0, 0, out), 0);
+    assert_true(UINT64_C(0x3ff) == out[0]);
+    assert_true((uint64_t) 1 << 6 == out[1]);
+    assert_true(2 == out[2]);
+    assert_int_equal(seagrass_float_invalid_mask_n(
+            values, 130, SEAGRASS_FLOAT_RULE_RANGE, -9, 100, out), 0);
+    assert_true(1 == out[0]);
+    assert_true(~UINT64_C(0) << (111 - 64) == out[1]);
+    assert_true(3 == out[2]);
+    assert_int_equal(seagrass_float_invalid_mask_n(
+            NULL, 0, SEAGRASS_FLOAT_RULE_FINITE, 0, 0, NULL), 0);
+}
+
+static void check_float_sqrt_error_on_out_is_null(void **state) {
+    assert_int_equal(seagrass_float_sqrt(1, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_sqrt_error_on_value_is_invalid(void **state) {
+    float out = 7;
+    assert_int_equal(seagrass_float_sqrt(NAN, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+    assert_int_equal(seagrass_float_sqrt(INFINITY, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+    assert_int_equal(seagrass_float_sqrt(-INFINITY, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+    assert_true(7 == out);
+}
+
+static void check_float_sqrt_error_on_float_value_is_negative(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_sqrt(-1, &out),
+                     SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE);
+    assert_int_equal(seagrass_float_sqrt(-FLT_TRUE_MIN, &out),
+                     SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE);
+}
+
+static void check_float_sqrt(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_sqrt(4, &out), 0);
+    assert_true(2 == out);
+    assert_int_equal(seagrass_float_sqrt(-0.0f, &out), 0);
+    assert_true(0 == out && signbit(out));
+    assert_int_equal(seagrass_float_sqrt(FLT_MAX, &out), 0);
+    assert_true(sqrtf(FLT_MAX) == out);
+}
+
+static void check_float_log_error_on_out_is_null(void **state) {
+    assert_int_equal(seagrass_float_log(1, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_log_error_on_value_is_invalid(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_log(NAN, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+    assert_int_equal(seagrass_float_log(INFINITY, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+}
+
+static void check_float_log_error_on_divide_by_zero(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_log(0, &out),
+                     SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO);
+    assert_int_equal(seagrass_float_log(-0.0f, &out),
+                     SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO);
+}
+
+static void check_float_log_error_on_float_value_is_negative(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_log(-1, &out),
+                     SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE);
+}
+
+static void check_float_log(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_log(1, &out), 0);
+    assert_true(0 == out);
+    assert_int_equal(seagrass_float_log(FLT_TRUE_MIN, &out), 0);
+    assert_true(logf(FLT_TRUE_MIN) == out);
+}
+
+static void check_float_exp_error_on_out_is_null(void **state) {
+    assert_int_equal(seagrass_float_exp(1, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_exp_error_on_value_is_invalid(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_exp(NAN, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+    assert_int_equal(seagrass_float_exp(-INFINITY, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+}
+
+static void check_float_exp_error_on_result_is_inconsistent(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_exp(89, &out),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_float_exp(FLT_MAX, &out),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_float_exp(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_exp(0, &out), 0);
+    assert_true(1 == out);
+    assert_int_equal(seagrass_float_exp(88.72f, &out), 0);
+    assert_true(isfinite(out));
+    /* underflows to zero without an error */
+    assert_int_equal(seagrass_float_exp(-200, &out), 0);
+    assert_true(0 == out);
+    assert_int_equal(seagrass_float_exp(-FLT_MAX, &out), 0);
+    assert_true(0 == out);
+}
+
+static void check_float_exp_pow_errno(void **state) {
+    float out;
+    errno = 0;
+    assert_int_equal(seagrass_float_exp(-103.9f, &out), 0);
+    assert_true(out >= 0 && out < FLT_MIN);
+    assert_int_equal(seagrass_float_exp(89, &out),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_float_pow(10, -50, &out), 0);
+    assert_true(0 == out);
+    assert_int_equal(seagrass_float_pow(0.5f, 200, &out), 0);
+    assert_true(0 == out);
+    assert_int_equal(seagrass_float_pow(1e-30f, 5, &out), 0);
+    assert_true(0 == out);
+    assert_int_equal(seagrass_float_pow(10, 50, &out),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(errno, 0);
+}
+
+static void check_float_pow_error_on_out_is_null(void **state) {
+    assert_int_equal(seagrass_float_pow(1, 1, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_pow_error_on_value_is_invalid(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_pow(NAN, 0, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+    assert_int_equal(seagrass_float_pow(1, INFINITY, &out),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+}
+
+static void check_float_pow_error_on_divide_by_zero(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_pow(0, -1, &out),
+                     SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO);
+    assert_int_equal(seagrass_float_pow(-0.0f, -0.5f, &out),
+                     SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO);
+}
+
+static void check_float_pow_error_on_float_value_is_negative(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_pow(-2, 0.5f, &out),
+                     SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE);
+}
+
+static void check_float_pow_error_on_result_is_inconsistent(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_pow(2, 128, &out),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_float_pow(-10, 39, &out),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_float_pow(void **state) {
+    float out;
+    assert_int_equal(seagrass_float_pow(-2, 3, &out), 0);
+    assert_true(-8 == out);
+    assert_int_equal(seagrass_float_pow(-2, 2, &out), 0);
+    assert_true(4 == out);
+    assert_int_equal(seagrass_float_pow(0, 0, &out), 0);
+    assert_true(1 == out);
+    assert_int_equal(seagrass_float_pow(-0.0f, 3, &out), 0);
+    assert_true(0 == out && signbit(out));
+    assert_int_equal(seagrass_float_pow(2, -151, &out), 0);
+    assert_true(0 == out);
+}
+
+/* Distance of the result from the exact one in units of the last place of
+ * the float nearest to the exact one. */
+static double ulps(const float result, const double exact) {
+    int exponent;
+    frexp(exact, &exponent);
+    exponent = exponent < FLT_MIN_EXP ? FLT_MIN_EXP : exponent;
+    return fabs(result - exact) / ldexp(1, exponent - FLT_MANT_DIG);
+}
+
+static void check_float_math_n_error_on_values_is_null(void **state) {
+    float values[] = {1.0f};
+    assert_int_equal(seagrass_float_sqrt_n(NULL, 1, values, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_float_log_n(NULL, 1, values, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_float_exp_n(NULL, 1, values, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_float_pow_n(NULL, values, 1, values, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_float_pow_n(values, NULL, 1, values, NULL),
+                     SEAGRASS_FLOAT_ERROR_VALUES_IS_NULL);
+}
+
+static void check_float_math_n_error_on_out_is_null(void **state) {
+    float values[] = {1.0f};
+    assert_int_equal(seagrass_float_sqrt_n(values, 1, NULL, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_float_log_n(values, 1, NULL, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_float_exp_n(values, 1, NULL, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_float_pow_n(values, values, 1, NULL, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_math_n_error(void **state) {
+    const uintmax_t count = 3000;
+    float *values = malloc(count * sizeof(*values));
+    float *out = malloc(count * sizeof(*out));
+    assert_non_null(values);
+    assert_non_null(out);
+    for (uintmax_t i = 0; i < count; i++) {
+        values[i] = 1.0f + (float) i;
+        out[i] = -1;
+    }
+    values[2500] = -2;
+    uintmax_t index;
+    assert_int_equal(seagrass_float_sqrt_n(values, count, out, &index),
+                     SEAGRASS_FLOAT_ERROR_FLOAT_VALUE_IS_NEGATIVE);
+    assert_int_equal(index, 2500);
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_true(i < index ? sqrtf(values[i]) == out[i] : -1 == out[i]);
+    }
+    values[1500] = 0;
+    out[1500] = -1;
+    assert_int_equal(seagrass_float_log_n(values, count, out, &index),
+                     SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO);
+    assert_int_equal(index, 1500);
+    assert_true(-1 == out[1500]);
+    for (uintmax_t i = 0; i < count; i++) {
+        values[i] = (float) (i % 50);
+    }
+    values[1030] = NAN;
+    assert_int_equal(seagrass_float_exp_n(values, count, out, &index),
+                     SEAGRASS_FLOAT_ERROR_VALUE_IS_INVALID);
+    assert_int_equal(index, 1030);
+    values[1030] = 89;
+    assert_int_equal(seagrass_float_exp_n(values, count, out, NULL),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    for (uintmax_t i = 0; i < count; i++) {
+        values[i] = 1.0f + (float) i;
+        out[i] = 2;
+    }
+    values[3] = 0.5f;
+    assert_int_equal(seagrass_float_pow_n(values, values, count, out,
+                                          &index),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(index, 26);
+    assert_true(sqrtf(0.5f) == out[3]);
+    assert_true(2 == out[26]);
+    out[5] = 0;
+    values[5] = -1;
+    assert_int_equal(seagrass_float_pow_n(out, values, count, out, &index),
+                     SEAGRASS_FLOAT_ERROR_DIVIDE_BY_ZERO);
+    assert_int_equal(index, 5);
+    free(values);
+    free(out);
+}
+
+static void check_float_math_n(void **state) {
+    const uintmax_t count = 20011;
+    float *a = malloc(count * sizeof(*a));
+    float *b = malloc(count * sizeof(*b));
+    float *out = malloc(count * sizeof(*out));
+    assert_non_null(a);
+    assert_non_null(b);
+    assert_non_null(out);
+    for (uintmax_t i = 0; i < count; i++) {
+        a[i] = ldexpf(1.0f + (float) i / (float) count, (int) (i % 250) - 135);
+        b[i] = ((float) i / (float) count - 0.5f) * 32;
+    }
+    assert_int_equal(seagrass_float_sqrt_n(a, count, out, NULL), 0);
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_true(sqrtf(a[i]) == out[i]);
+    }
+    assert_int_equal(seagrass_float_log_n(a, count, out, NULL), 0);
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_true(ulps(out[i], log(a[i])) < 1);
+    }
+    for (uintmax_t i = 0; i < count; i++) {
+        out[i] = (float) ((double) i / (double) count * 198 - 110);
+    }
+    /* out may be the same array as values */
+    assert_int_equal(seagrass_float_exp_n(out, count, out, NULL), 0);
+    for (uintmax_t i = 0; i < count; i++) {
+        const float value = (float) ((double) i / (double) count * 198
+                                     - 110);
+        assert_true(ulps(out[i], value < -104 ? 0 : exp(value)) < 1);
+    }
+    for (uintmax_t i = 0; i < count; i++) {
+        a[i] = (float) (i % 1000 + 1) / 100;
+    }
+    assert_int_equal(seagrass_float_pow_n(a, b, count, out, NULL), 0);
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_true(ulps(out[i], pow(a[i], b[i])) < 1);
+    }
+    const float base[] = {-2, -0.0f, 0, -3, -0.5f};
+    const float power[] = {3, 3, 0, 2, -3};
+    float result[5];
+    assert_int_equal(seagrass_float_pow_n(base, power, 5, result, NULL), 0);
+    assert_true(-8 == result[0]);
+    assert_true(0 == result[1] && signbit(result[1]));
+    assert_true(1 == result[2]);
+    assert_true(9 == result[3]);
+    assert_true(-8 == result[4]);
+    assert_int_equal(seagrass_float_log_n(NULL, 0, NULL, NULL), 0);
+    free(a);
+    free(b);
+    free(out);
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_float_ptr_compare),
@@ -455,6 +1604,27 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_float_divide_error_on_divide_by_zero),
             cmocka_unit_test(check_float_divide_error_on_result_is_inconsistent),
             cmocka_unit_test(check_float_divide),
+            cmocka_unit_test(check_float_add_exact_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_float_add_exact_error_on_result_is_inconsistent),
+            cmocka_unit_test(
+                    check_float_add_exact_error_on_result_is_unchanged),
+            cmocka_unit_test(check_float_add_exact),
+            cmocka_unit_test(check_float_subtract_exact_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_float_subtract_exact_error_on_result_is_inconsistent),
+            cmocka_unit_test(
+                    check_float_subtract_exact_error_on_result_is_unchanged),
+            cmocka_unit_test(check_float_subtract_exact),
+            cmocka_unit_test(check_float_multiply_exact_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_float_multiply_exact_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_float_multiply_exact),
+            cmocka_unit_test(check_float_divide_exact_error_on_out_is_null),
+            cmocka_unit_test(check_float_divide_exact_error_on_divide_by_zero),
+            cmocka_unit_test(
+                    check_float_divide_exact_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_float_divide_exact),
             cmocka_unit_test(check_float_is_equal_error_on_out_is_null),
             cmocka_unit_test(check_float_is_equal),
             cmocka_unit_test(check_float_is_greater_than_error_on_out_is_null),
@@ -473,6 +1643,74 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_float_to_uintmax_t_with_rounding_mode_downward),
             cmocka_unit_test(check_float_to_uintmax_t_with_rounding_mode_upward),
             cmocka_unit_test(check_float_to_uintmax_t_with_rounding_mode_towards_zero),
+            cmocka_unit_test(check_float_sum_n_error_on_values_is_null),
+            cmocka_unit_test(check_float_sum_n_error_on_out_is_null),
+            cmocka_unit_test(check_float_sum_n_error_on_summation_is_invalid),
+            cmocka_unit_test(check_float_sum_n_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_float_sum_n),
+            cmocka_unit_test(check_float_sum_n_short),
+            cmocka_unit_test(check_float_extremes_n_error_on_values_is_null),
+            cmocka_unit_test(check_float_extremes_n_error_on_count_is_zero),
+            cmocka_unit_test(check_float_extremes_n_error_on_out_is_null),
+            cmocka_unit_test(check_float_extremes_n_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_float_extremes_n),
+            cmocka_unit_test(check_float_extremes_n_signed_zero),
+            cmocka_unit_test(
+                    check_float_sum_n_error_on_summation_is_invalid_with_fast_denormals),
+            cmocka_unit_test(check_float_sum_n_fast_denormals),
+            cmocka_unit_test(
+                    check_float_fast_denormals_is_supported_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_float_fast_denormals_begin_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_float_fast_denormals_end_error_on_object_is_null),
+            cmocka_unit_test(check_float_fast_denormals),
+            cmocka_unit_test(check_float_fast_denormals_add),
+            cmocka_unit_test(check_float_dot_error_on_values_is_null),
+            cmocka_unit_test(check_float_dot_error_on_out_is_null),
+            cmocka_unit_test(check_float_dot_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_float_dot),
+            cmocka_unit_test(check_float_axpy_error_on_values_is_null),
+            cmocka_unit_test(check_float_axpy_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_float_axpy),
+            cmocka_unit_test(check_float_gemv_error_on_values_is_null),
+            cmocka_unit_test(check_float_gemv_error_on_out_is_null),
+            cmocka_unit_test(check_float_gemv_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_float_gemv),
+            cmocka_unit_test(check_float_find_invalid_n_error_on_values_is_null),
+            cmocka_unit_test(check_float_find_invalid_n_error_on_out_is_null),
+            cmocka_unit_test(check_float_find_invalid_n_error_on_rules_is_invalid),
+            cmocka_unit_test(check_float_find_invalid_n_error_on_range_is_invalid),
+            cmocka_unit_test(check_float_find_invalid_n_rules),
+            cmocka_unit_test(check_float_find_invalid_n),
+            cmocka_unit_test(check_float_invalid_mask_n_error_on_values_is_null),
+            cmocka_unit_test(check_float_invalid_mask_n_error_on_out_is_null),
+            cmocka_unit_test(check_float_invalid_mask_n_error_on_rules_is_invalid),
+            cmocka_unit_test(check_float_invalid_mask_n),
+            cmocka_unit_test(check_float_sqrt_error_on_out_is_null),
+            cmocka_unit_test(check_float_sqrt_error_on_value_is_invalid),
+            cmocka_unit_test(check_float_sqrt_error_on_float_value_is_negative),
+            cmocka_unit_test(check_float_sqrt),
+            cmocka_unit_test(check_float_log_error_on_out_is_null),
+            cmocka_unit_test(check_float_log_error_on_value_is_invalid),
+            cmocka_unit_test(check_float_log_error_on_divide_by_zero),
+            cmocka_unit_test(check_float_log_error_on_float_value_is_negative),
+            cmocka_unit_test(check_float_log),
+            cmocka_unit_test(check_float_exp_error_on_out_is_null),
+            cmocka_unit_test(check_float_exp_error_on_value_is_invalid),
+            cmocka_unit_test(check_float_exp_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_float_exp),
+            cmocka_unit_test(check_float_exp_pow_errno),
+            cmocka_unit_test(check_float_pow_error_on_out_is_null),
+            cmocka_unit_test(check_float_pow_error_on_value_is_invalid),
+            cmocka_unit_test(check_float_pow_error_on_divide_by_zero),
+            cmocka_unit_test(check_float_pow_error_on_float_value_is_negative),
+            cmocka_unit_test(check_float_pow_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_float_pow),
+            cmocka_unit_test(check_float_math_n_error_on_values_is_null),
+            cmocka_unit_test(check_float_math_n_error_on_out_is_null),
+            cmocka_unit_test(check_float_math_n_error),
+            cmocka_unit_test(check_float_math_n),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
@@ -0,0 +1,372 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+static void check_float_tolerance_init_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_tolerance_init_absolute(NULL, FLT_EPSILON),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(
+            seagrass_float_tolerance_init_relative(NULL, FLT_EPSILON),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(
+            seagrass_float_tolerance_init_ulp(NULL, 4),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL);
+}
+
+static void
+check_float_tolerance_init_error_on_value_is_invalid(void **state) {
+    struct seagrass_float_tolerance object;
+    assert_int_equal(
+            seagrass_float_tolerance_init_absolute(&object, -1.0f),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUE_IS_INVALID);
+    assert_int_equal(
+            seagrass_float_tolerance_init_absolute(&object, NAN),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUE_IS_INVALID);
+    assert_int_equal(
+            seagrass_float_tolerance_init_relative(&object, INFINITY),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUE_IS_INVALID);
+}
+
+static void check_float_tolerance_is_equal_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(NULL, 1, 1, (void *) 1),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_float_tolerance_is_equal_error_on_out_is_null(void **state) {
+    struct seagrass_float_tolerance object;
+    assert_int_equal(seagrass_float_tolerance_init_ulp(&object, 4), 0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, 1, 1, NULL),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_tolerance_is_equal_absolute(void **state) {
+    struct seagrass_float_tolerance object;
+    bool result;
+    assert_int_equal(
+            seagrass_float_tolerance_init_absolute(&object, 0.5f), 0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, 1.0f, 1.5f, &result),
+            0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, 1.0f, 1.75f, &result),
+            0);
+    assert_false(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, INFINITY, INFINITY,
+                                              &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, NAN, NAN, &result), 0);
+    assert_false(result);
+}
+
+static void check_float_tolerance_is_equal_relative(void **state) {
+    struct seagrass_float_tolerance object;
+    bool result;
+    assert_int_equal(
+            seagrass_float_tolerance_init_relative(&object, 0.01f), 0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, 1e20f, 1.005e20f,
+                                              &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, 1e-20f, 1.02e-20f,
+                                              &result), 0);
+    assert_false(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, -1.0f, 1.0f, &result),
+            0);
+    assert_false(result);
+}
+
+static void check_float_tolerance_is_equal_ulp(void **state) {
+    struct seagrass_float_tolerance object;
+    bool result;
+    assert_int_equal(seagrass_float_tolerance_init_ulp(&object, 2), 0);
+    const float a = 1e30f;
+    const float b = nextafterf(nextafterf(a, INFINITY), INFINITY);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, a, b, &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, a,
+                                              nextafterf(b, INFINITY),
+                                              &result), 0);
+    assert_false(result);
+    /* across zero */
+    const float c = nextafterf(0.0f, 1.0f);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, -c, c, &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, -0.0f, 0.0f, &result),
+            0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, NAN, NAN, &result), 0);
+    assert_false(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, FLT_MAX, INFINITY,
+                                              &result), 0);
+    assert_false(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal(&object, -INFINITY, INFINITY,
+                                              &result), 0);
+    assert_false(result);
+}
+
+static void
+check_float_tolerance_is_less_than_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_tolerance_is_less_than(NULL, 1, 1, (void *) 1),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL);
+}
+
+static void
+check_float_tolerance_is_less_than_error_on_out_is_null(void **state) {
+    struct seagrass_float_tolerance object;
+    assert_int_equal(seagrass_float_tolerance_init_ulp(&object, 4), 0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_less_than(&object, 1, 1, NULL),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_tolerance_is_less_than(void **state) {
+    struct seagrass_float_tolerance object;
+    bool result;
+    assert_int_equal(
+            seagrass_float_tolerance_init_absolute(&object, 0.5f), 0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_less_than(&object, 1.0f, 1.5f,
+                                                  &result), 0);
+    assert_false(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_less_than(&object, 1.0f, 1.75f,
+                                                  &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_less_than(&object, 1.75f, 1.0f,
+                                                  &result), 0);
+    assert_false(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_less_than(&object, NAN, 1.0f,
+                                                  &result), 0);
+    assert_false(result);
+}
+
+static void
+check_float_tolerance_is_greater_than_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_tolerance_is_greater_than(NULL, 1, 1, (void *) 1),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL);
+}
+
+static void
+check_float_tolerance_is_greater_than_error_on_out_is_null(void **state) {
+    struct seagrass_float_tolerance object;
+    assert_int_equal(seagrass_float_tolerance_init_ulp(&object, 4), 0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_greater_than(&object, 1, 1, NULL),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL);
+}
+
+static void check_float_tolerance_is_greater_than(void **state) {
+    struct seagrass_float_tolerance object;
+    bool result;
+    assert_int_equal(seagrass_float_tolerance_init_ulp(&object, 1), 0);
+    const float a = 1.0f;
+    const float b = nextafterf(a, INFINITY);
+    assert_int_equal(
+            seagrass_float_tolerance_is_greater_than(&object, b, a, &result),
+            0);
+    assert_false(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_greater_than(
+                    &object, nextafterf(b, INFINITY), a, &result), 0);
+    assert_true(result);
+    assert_int_equal(
+            seagrass_float_tolerance_is_greater_than(&object, a, 2.0f,
+                                                     &result), 0);
+    assert_false(result);
+}
+
+static void
+check_float_tolerance_is_equal_n_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal_n(NULL, (void *) 1, (void *) 1,
+                                                1, (void *) 1),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OBJECT_IS_NULL);
+}
+
+static void
+check_float_tolerance_is_equal_n_error_on_values_is_null(void **state) {
+    struct seagrass_float_tolerance object;
+    assert_int_equal(seagrass_float_tolerance_init_ulp(&object, 4), 0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal_n(&object, NULL, (void *) 1,
+                                                1, (void *) 1),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUES_IS_NULL);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal_n(&object, (void *) 1, NULL,
+                                                1, (void *) 1),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_VALUES_IS_NULL);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal_n(&object, NULL, NULL, 0, NULL),
+            0);
+}
+
+static void
+check_float_tolerance_is_equal_n_error_on_out_is_null(void **state) {
+    struct seagrass_float_tolerance object;
+    assert_int_equal(seagrass_float_tolerance_init_ulp(&object, 4), 0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal_n(&object, (void *) 1,
+                                                (void *) 1, 1, NULL),
+            SEAGRASS_FLOAT_TOLERANCE_ERROR_OUT_IS_NULL);
+}
+
+static void check_infinity(const struct seagrass_float_tolerance *object) {
+    const float values[] = {
+            -INFINITY, -FLT_MAX, -1.0f, 0.0f, 1.0f, FLT_MAX, INFINITY
+    };
+    const uintmax_t count = sizeof(values) / sizeof(values[0]);
+    for (uintmax_t i = 0; i < count; i++) {
+        for (uintmax_t j = 0; j < count; j++) {
+            if (isfinite(values[i]) && isfinite(values[j])) {
+                continue;
+            }
+            bool result;
+            assert_int_equal(
+                    seagrass_float_tolerance_is_equal(
+                            object, values[i], values[j], &result), 0);
+            assert_int_equal(result, i == j);
+            assert_int_equal(
+                    seagrass_float_tolerance_is_less_than(
+                            object, values[i], values[j], &result), 0);
+            assert_int_equal(result, i < j);
+            assert_int_equal(
+                    seagrass_float_tolerance_is_greater_than(
+                            object, values[i], values[j], &result), 0);
+            assert_int_equal(result, i > j);
+            uint64_t mask;
+            assert_int_equal(
+                    seagrass_float_tolerance_is_equal_n(
+                            object, &values[i], &values[j], 1, &mask), 0);
+            assert_int_equal(mask, i == j);
+            assert_int_equal(
+                    seagrass_float_tolerance_is_less_than_n(
+                            object, &values[i], &values[j], 1, &mask), 0);
+            assert_int_equal(mask, i < j);
+            assert_int_equal(
+                    seagrass_float_tolerance_is_greater_than_n(
+                            object, &values[i], &values[j], 1, &mask), 0);
+            assert_int_equal(mask, i > j);
+        }
+    }
+}
+
+static void check_float_tolerance_infinity(void **state) {
+    struct seagrass_float_tolerance object;
+    assert_int_equal(
+            seagrass_float_tolerance_init_absolute(&object, 0.5f), 0);
+    check_infinity(&object);
+    assert_int_equal(
+            seagrass_float_tolerance_init_relative(&object, 0.5f), 0);
+    check_infinity(&object);
+    assert_int_equal(seagrass_float_tolerance_init_ulp(&object, 4), 0);
+    check_infinity(&object);
+    assert_int_equal(
+            seagrass_float_tolerance_init_ulp(&object, UINT32_MAX), 0);
+    check_infinity(&object);
+}
+
+#define COUNT 150
+
+static void check_n(const struct seagrass_float_tolerance *object) {
+    float a[COUNT], b[COUNT];
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        a[i] = (float) i;
+        b[i] = a[i] + (i % 3 == 0 ? 0.0f : i % 3 == 1 ? 10.0f : -10.0f);
+    }
+    a[7] = NAN;
+    uint64_t equal[3], less[3], greater[3];
+    memset(equal, 0xff, sizeof(equal));
+    assert_int_equal(
+            seagrass_float_tolerance_is_equal_n(object, a, b, COUNT, equal),
+            0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_less_than_n(object, a, b, COUNT,
+                                                    less), 0);
+    assert_int_equal(
+            seagrass_float_tolerance_is_greater_than_n(object, a, b, COUNT,
+                                                       greater), 0);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        bool result;
+        assert_int_equal(
+                seagrass_float_tolerance_is_equal(object, a[i], b[i],
+                                                  &result), 0);
+        assert_int_equal(result, (equal[i / 64] >> (i % 64)) & 1);
+        assert_int_equal(
+                seagrass_float_tolerance_is_less_than(object, a[i], b[i],
+                                                      &result), 0);
+        assert_int_equal(result, (less[i / 64] >> (i % 64)) & 1);
+        assert_int_equal(
+                seagrass_float_tolerance_is_greater_than(object, a[i], b[i],
+                                                         &result), 0);
+        assert_int_equal(result, (greater[i / 64] >> (i % 64)) & 1);
+    }
+    assert_int_equal(0, equal[2] >> (COUNT % 64));
+    assert_int_equal(0, (equal[0] >> 7) & 1);
+    assert_int_equal(1, (equal[0] >> 6) & 1);
+    assert_int_equal(1, (less[0] >> 4) & 1);
+    assert_int_equal(1, (greater[0] >> 5) & 1);
+}
+
+static void check_float_tolerance_is_equal_n(void **state) {
+    struct seagrass_float_tolerance object;
+    assert_int_equal(
+            seagrass_float_tolerance_init_absolute(&object, 0.5f), 0);
+    check_n(&object);
+    assert_int_equal(
+            seagrass_float_tolerance_init_relative(&object, 0.01f), 0);
+    check_n(&object);
+    assert_int_equal(seagrass_float_tolerance_init_ulp(&object, 4), 0);
+    check_n(&object);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_float_tolerance_init_error_on_object_is_null),
+            cmocka_unit_test(check_float_tolerance_init_error_on_value_is_invalid),
+            cmocka_unit_test(check_float_tolerance_is_equal_error_on_object_is_null),
+            cmocka_unit_test(check_float_tolerance_is_equal_error_on_out_is_null),
+            cmocka_unit_test(check_float_tolerance_is_equal_absolute),
+            cmocka_unit_test(check_float_tolerance_is_equal_relative),
+            cmocka_unit_test(check_float_tolerance_is_equal_ulp),
+            cmocka_unit_test(check_float_tolerance_is_less_than_error_on_object_is_null),
+            cmocka_unit_test(check_float_tolerance_is_less_than_error_on_out_is_null),
+            cmocka_unit_test(check_float_tolerance_is_less_than),
+            cmocka_unit_test(check_float_tolerance_is_greater_than_error_on_object_is_null),
+            cmocka_unit_test(check_float_tolerance_is_greater_than_error_on_out_is_null),
+            cmocka_unit_test(check_float_tolerance_is_greater_than),
+            cmocka_unit_test(check_float_tolerance_is_equal_n_error_on_object_is_null),
+            cmocka_unit_test(check_float_tolerance_is_equal_n_error_on_values_is_null),
+            cmocka_unit_test(check_float_tolerance_is_equal_n_error_on_out_is_null),
+            cmocka_unit_test(check_float_tolerance_is_equal_n),
+            cmocka_unit_test(check_float_tolerance_infinity),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
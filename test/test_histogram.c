@@ -0,0 +1,523 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <seagrass.h>
+
+#include "thread_identity.h"
+
+#include <test/cmocka.h>
+
+#define THREADS 4
+#define RECORDS 100000
+
+static void check_histogram_init_error_on_object_is_null(void **state) {
+    assert_int_equal(seagrass_histogram_init(NULL, 8, 1),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_histogram_init_error_on_precision_is_invalid(void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(
+            seagrass_histogram_init(
+                    &object, SEAGRASS_HISTOGRAM_PRECISION_MINIMUM - 1, 1),
+            SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID);
+    assert_int_equal(
+            seagrass_histogram_init(
+                    &object, SEAGRASS_HISTOGRAM_PRECISION_MAXIMUM + 1, 1),
+            SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID);
+}
+
+static void check_histogram_init_error_on_shards_is_zero(void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 8, 0),
+                     SEAGRASS_HISTOGRAM_ERROR_SHARDS_IS_ZERO);
+}
+
+static void check_histogram_init_error_on_memory_allocation_failed(
+        void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 8, UINTMAX_MAX),
+                     SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED);
+    posix_memalign_is_overridden = true;
+    assert_int_equal(seagrass_histogram_init(&object, 8, 1),
+                     SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED);
+    posix_memalign_is_overridden = false;
+}
+
+static void check_histogram_init_invalidate(void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 8, 3), 0);
+    assert_int_equal(object.precision, 8);
+    assert_int_equal(object.buckets, 7424);
+    assert_int_equal(object.shards, 3);
+    assert_int_equal(object.stride % 8, 0);
+    assert_int_equal((uintptr_t) object.counts % 64, 0);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+    assert_null(object.counts);
+}
+
+static void check_histogram_invalidate_error_on_object_is_null(void **state) {
+    assert_int_equal(seagrass_histogram_invalidate(NULL),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(NULL),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_histogram_record_error_on_object_is_null(void **state) {
+    assert_int_equal(seagrass_histogram_record(NULL, 1),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_histogram_snapshot_error_on_object_is_null(void **state) {
+    struct seagrass_histogram_snapshot out;
+    assert_int_equal(seagrass_histogram_snapshot(NULL, &out),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_histogram_snapshot_error_on_out_is_null(void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 8, 1), 0);
+    assert_int_equal(seagrass_histogram_snapshot(&object, NULL),
+                     SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+}
+
+static void check_histogram_snapshot_error_on_memory_allocation_failed(
+        void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 8, 1), 0);
+    struct seagrass_histogram_snapshot out;
+    calloc_is_overridden = true;
+    assert_int_equal(seagrass_histogram_snapshot(&object, &out),
+                     SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED);
+    calloc_is_overridden = false;
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+}
+
+static void check_histogram_snapshot_error_on_overflow(void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 8, 2), 0);
+    struct seagrass_histogram_snapshot out;
+    /* a bucket summed over the shards */
+    atomic_store(&object.counts[5], UINTMAX_MAX);
+    atomic_store(&object.counts[object.stride + 5], 1);
+    assert_int_equal(seagrass_histogram_snapshot(&object, &out),
+                     SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT);
+    /* the sum of the buckets */
+    atomic_store(&object.counts[object.stride + 5], 0);
+    atomic_store(&object.counts[6], 1);
+    assert_int_equal(seagrass_histogram_snapshot(&object, &out),
+                     SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+}
+
+static void check_histogram_record(void **state) {
+    const uintmax_t precisions[] = {1, 3, 8, 16};
+    const uintmax_t values[] = {
+            0, 1, 2, 3, 7, 8, 9, 255, 256, 257, 1000, 65535, 65536, 123456789,
+            (uintmax_t) 1 << 62, ((uintmax_t) 1 << 62) - 1, UINTMAX_MAX - 1,
+            UINTMAX_MAX
+    };
+    for (size_t p = 0; p < sizeof(precisions) / sizeof(precisions[0]); p++) {
+        const uintmax_t precision = precisions[p];
+        for (size_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+            const uintmax_t value = values[v];
+            struct seagrass_histogram object;
+            assert_int_equal(seagrass_histogram_init(&object, precision, 1),
+                             0);
+            assert_int_equal(seagrass_histogram_record(&object, value), 0);
+            struct seagrass_histogram_snapshot snapshot;
+            assert_int_equal(seagrass_histogram_snapshot(&object, &snapshot),
+                             0);
+            uintmax_t count, out;
+            assert_int_equal(seagrass_histogram_snapshot_count(&snapshot,
+                                                               &count), 0);
+            assert_int_equal(count, 1);
+            assert_int_equal(
+                    seagrass_histogram_snapshot_percentile(&snapshot, 50,
+                                                           &out),
+                    0);
+            /* the bucket holds the value and is narrow enough */
+            assert_true(out >= value);
+            assert_true(out - value <= value >> (precision - 1));
+            if (value >> precision == 0) {
+                assert_int_equal(out, value);
+            }
+            assert_int_equal(seagrass_histogram_snapshot_invalidate(
+                    &snapshot), 0);
+            assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+        }
+    }
+}
+
+static void check_histogram_snapshot_percentile(void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 8, 1), 0);
+    for (uintmax_t i = 1; i <= 1000; i++) {
+        assert_int_equal(seagrass_histogram_record(&object, i), 0);
+    }
+    struct seagrass_histogram_snapshot snapshot;
+    assert_int_equal(seagrass_histogram_snapshot(&object, &snapshot), 0);
+    const double percentiles[] = {0, 1, 25, 50, 90, 99, 99.9, 100};
+    for (size_t i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]);
+         i++) {
+        uintmax_t out;
+        assert_int_equal(
+                seagrass_histogram_snapshot_percentile(
+                        &snapshot, percentiles[i], &out),
+                0);
+        const double rank = ceil(percentiles[i] / 100 * 1000);
+        const uintmax_t exact = rank < 1 ? 1 : (uintmax_t) rank;
+        assert_true(out >= exact);
+        assert_true(out - exact <= exact / 128);
+    }
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&snapshot), 0);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+}
+
+static void check_histogram_snapshot_percentile_error_on_object_is_null(
+        void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_histogram_snapshot_percentile(NULL, 50, &out),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_histogram_snapshot_percentile_errors(void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 8, 1), 0);
+    struct seagrass_histogram_snapshot snapshot;
+    assert_int_equal(seagrass_histogram_snapshot(&object, &snapshot), 0);
+    uintmax_t out;
+    assert_int_equal(seagrass_histogram_snapshot_percentile(&snapshot, -1,
+                                                            &out),
+                     SEAGRASS_HISTOGRAM_ERROR_PERCENTILE_IS_INVALID);
+    assert_int_equal(seagrass_histogram_snapshot_percentile(&snapshot, 101,
+                                                            &out),
+                     SEAGRASS_HISTOGRAM_ERROR_PERCENTILE_IS_INVALID);
+    assert_int_equal(seagrass_histogram_snapshot_percentile(&snapshot, NAN,
+                                                            &out),
+                     SEAGRASS_HISTOGRAM_ERROR_PERCENTILE_IS_INVALID);
+    assert_int_equal(seagrass_histogram_snapshot_percentile(&snapshot, 50,
+                                                            NULL),
+                     SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_percentile(&snapshot, 50,
+                                                            &out),
+                     SEAGRASS_HISTOGRAM_ERROR_IS_EMPTY);
+    assert_int_equal(seagrass_histogram_snapshot_count(NULL, &out),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_count(&snapshot, NULL),
+                     SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&snapshot), 0);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+}
+
+struct recorder {
+    struct seagrass_histogram *histogram;
+    uintmax_t offset;
+};
+
+static void *record(void *const argument) {
+    const struct recorder *const recorder = argument;
+    for (uintmax_t i = 0; i < RECORDS; i++) {
+        seagrass_required_true(!seagrass_histogram_record(
+                recorder->histogram, recorder->offset + i % 50));
+    }
+    return NULL;
+}
+
+static void check_histogram_record_concurrently(void **state) {
+    /* fewer shards than threads share shards */
+    const uintmax_t shards[] = {1, 2, THREADS};
+    for (size_t s = 0; s < sizeof(shards) / sizeof(shards[0]); s++) {
+        struct seagrass_histogram object;
+        assert_int_equal(seagrass_histogram_init(&object, 8, shards[s]), 0);
+        pthread_t threads[THREADS];
+        struct recorder recorders[THREADS];
+        for (uintmax_t i = 0; i < THREADS; i++) {
+            recorders[i] = (struct recorder) {&object, i * 50};
+            assert_int_equal(pthread_create(&threads[i], NULL, record,
+                                            &recorders[i]), 0);
+        }
+        for (uintmax_t i = 0; i < THREADS; i++) {
+            assert_int_equal(pthread_join(threads[i], NULL), 0);
+        }
+        struct seagrass_histogram_snapshot snapshot;
+        assert_int_equal(seagrass_histogram_snapshot(&object, &snapshot), 0);
+        assert_int_equal(snapshot.count, THREADS * RECORDS);
+        /* values below 256 have a bucket each */
+        for (uintmax_t i = 0; i < THREADS * 50; i++) {
+            assert_int_equal(snapshot.counts[i], RECORDS / 50);
+        }
+        assert_int_equal(seagrass_histogram_snapshot_invalidate(&snapshot),
+                         0);
+        assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+    }
+}
+
+struct crowd {
+    struct seagrass_histogram *histogram;
+    pthread_barrier_t *barrier;
+};
+
+static void *record_in_crowd(void *const argument) {
+    struct crowd *const crowd = argument;
+    /* every thread holds its identity before any of them records more */
+    seagrass_required_true(!seagrass_histogram_record(crowd->histogram, 1));
+    pthread_barrier_wait(crowd->barrier);
+    for (uintmax_t i = 0; i < 1000; i++) {
+        seagrass_required_true(!seagrass_histogram_record(crowd->histogram,
+                                                          1));
+    }
+    return NULL;
+}
+
+static void check_histogram_record_with_more_threads_than_identities(
+        void **state) {
+    /* the threads past the last identity share the shared shard even
+     * though there are shards enough for them */
+    const uintmax_t count = SEAGRASS_THREAD_IDENTITY_MAXIMUM + THREADS;
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 2, count + 1), 0);
+    pthread_barrier_t barrier;
+    assert_int_equal(pthread_barrier_init(&barrier, NULL, count), 0);
+    struct crowd crowd = {&object, &barrier};
+    pthread_attr_t attributes;
+    assert_int_equal(pthread_attr_init(&attributes), 0);
+    assert_int_equal(pthread_attr_setstacksize(&attributes, 1 << 16), 0);
+    pthread_t *const threads = malloc(count * sizeof(pthread_t));
+    assert_non_null(threads);
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_int_equal(pthread_create(&threads[i], &attributes,
+                                        record_in_crowd, &crowd), 0);
+    }
+    for (uintmax_t i = 0; i < count; i++) {
+        assert_int_equal(pthread_join(threads[i], NULL), 0);
+    }
+    free(threads);
+    assert_int_equal(pthread_attr_destroy(&attributes), 0);
+    assert_int_equal(pthread_barrier_destroy(&barrier), 0);
+    uintmax_t shared = 0;
+    for (uintmax_t i = 0; i < object.buckets; i++) {
+        shared += atomic_load(&object.counts[object.shards * object.stride
+                                             + i]);
+    }
+    assert_true(shared && !(shared % 1001));
+    struct seagrass_histogram_snapshot snapshot;
+    assert_int_equal(seagrass_histogram_snapshot(&object, &snapshot), 0);
+    assert_int_equal(snapshot.count, count * 1001);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&snapshot), 0);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+}
+
+static void check_histogram_merge(void **state) {
+    struct seagrass_histogram object, other, different;
+    assert_int_equal(seagrass_histogram_init(&object, 4, 2), 0);
+    assert_int_equal(seagrass_histogram_init(&other, 4, 4), 0);
+    assert_int_equal(seagrass_histogram_init(&different, 5, 1), 0);
+    assert_int_equal(seagrass_histogram_merge(NULL, &other),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_histogram_merge(&object, NULL),
+                     SEAGRASS_HISTOGRAM_ERROR_OTHER_IS_NULL);
+    assert_int_equal(seagrass_histogram_merge(&object, &different),
+                     SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID);
+    assert_int_equal(seagrass_histogram_record(&object, 3), 0);
+    assert_int_equal(seagrass_histogram_record(&other, 3), 0);
+    assert_int_equal(seagrass_histogram_record(&other, 1000), 0);
+    /* counts in another shard of other */
+    atomic_store(&other.counts[3 * other.stride + 3], 5);
+    assert_int_equal(seagrass_histogram_merge(&object, &other), 0);
+    struct seagrass_histogram_snapshot snapshot;
+    assert_int_equal(seagrass_histogram_snapshot(&object, &snapshot), 0);
+    assert_int_equal(snapshot.count, 8);
+    assert_int_equal(snapshot.counts[3], 7);
+    uintmax_t out;
+    assert_int_equal(seagrass_histogram_snapshot_percentile(&snapshot, 100,
+                                                            &out), 0);
+    assert_true(out >= 1000 && out - 1000 <= 1000 / 8);
+    uintmax_t last = 0;
+    for (uintmax_t i = 0; i < object.buckets; i++) {
+        if (snapshot.counts[i]) {
+            last = i;
+        }
+    }
+    assert_true(last > 3);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&snapshot), 0);
+    atomic_store(&other.counts[3], UINTMAX_MAX);
+    assert_int_equal(seagrass_histogram_merge(&object, &other),
+                     SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT);
+    /* the bucket of 1000 in object overflows after that of 3 is merged */
+    atomic_store(&other.counts[3], 1);
+    atomic_store(&object.counts[object.stride + last], UINTMAX_MAX);
+    assert_int_equal(seagrass_histogram_merge(&object, &other),
+                     SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT);
+    atomic_store(&object.counts[object.stride + last], 0);
+    assert_int_equal(seagrass_histogram_snapshot(&object, &snapshot), 0);
+    assert_int_equal(snapshot.count, 8);
+    assert_int_equal(snapshot.counts[3], 7);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&snapshot), 0);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+    assert_int_equal(seagrass_histogram_invalidate(&other), 0);
+    assert_int_equal(seagrass_histogram_invalidate(&different), 0);
+}
+
+static void check_histogram_snapshot_merge(void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 4, 1), 0);
+    assert_int_equal(seagrass_histogram_record(&object, 2), 0);
+    assert_int_equal(seagrass_histogram_record(&object, 100), 0);
+    struct seagrass_histogram_snapshot a, b, c;
+    assert_int_equal(seagrass_histogram_snapshot(&object, &a), 0);
+    assert_int_equal(seagrass_histogram_snapshot(&object, &b), 0);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+    assert_int_equal(seagrass_histogram_init(&object, 5, 1), 0);
+    assert_int_equal(seagrass_histogram_snapshot(&object, &c), 0);
+    assert_int_equal(seagrass_histogram_snapshot_merge(NULL, &b),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_merge(&a, NULL),
+                     SEAGRASS_HISTOGRAM_ERROR_OTHER_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_merge(&a, &c),
+                     SEAGRASS_HISTOGRAM_ERROR_PRECISION_IS_INVALID);
+    assert_int_equal(seagrass_histogram_snapshot_merge(&a, &b), 0);
+    assert_int_equal(a.count, 4);
+    assert_int_equal(a.counts[2], 2);
+    /* overflow leaves the snapshot unchanged */
+    b.count = UINTMAX_MAX;
+    assert_int_equal(seagrass_histogram_snapshot_merge(&a, &b),
+                     SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(a.count, 4);
+    assert_int_equal(a.counts[2], 2);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&a), 0);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&b), 0);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&c), 0);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+}
+
+static void check_histogram_snapshot_serialize(void **state) {
+    struct seagrass_histogram object;
+    assert_int_equal(seagrass_histogram_init(&object, 8, 1), 0);
+    const uintmax_t values[] = {0, 0, 5, 300, 300, 70000, UINTMAX_MAX};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        assert_int_equal(seagrass_histogram_record(&object, values[i]), 0);
+    }
+    struct seagrass_histogram_snapshot snapshot, copy;
+    assert_int_equal(seagrass_histogram_snapshot(&object, &snapshot), 0);
+    uintmax_t size;
+    assert_int_equal(seagrass_histogram_snapshot_serialized_size(NULL, &size),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_serialized_size(&snapshot,
+                                                                 NULL),
+                     SEAGRASS_HISTOGRAM_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_serialized_size(&snapshot,
+                                                                 &size), 0);
+    /* precision, then skipped and count for each of the five buckets */
+    assert_true(size <= 1 + 5 * (2 + 1));
+    unsigned char data[64];
+    assert_int_equal(seagrass_histogram_snapshot_serialize(NULL, data, size),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_serialize(&snapshot, NULL,
+                                                           size),
+                     SEAGRASS_HISTOGRAM_ERROR_DATA_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_serialize(&snapshot, data,
+                                                           size - 1),
+                     SEAGRASS_HISTOGRAM_ERROR_SIZE_IS_TOO_SMALL);
+    assert_int_equal(seagrass_histogram_snapshot_serialize(&snapshot, data,
+                                                           size), 0);
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(&copy, data,
+                                                             size), 0);
+    assert_int_equal(copy.precision, snapshot.precision);
+    assert_int_equal(copy.count, snapshot.count);
+    assert_memory_equal(copy.counts, snapshot.counts,
+                        object.buckets * sizeof(uintmax_t));
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&copy), 0);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&snapshot), 0);
+    assert_int_equal(seagrass_histogram_invalidate(&object), 0);
+}
+
+static void check_histogram_snapshot_deserialize_errors(void **state) {
+    struct seagrass_histogram_snapshot out;
+    const unsigned char empty[] = {8};
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(NULL, empty, 1),
+                     SEAGRASS_HISTOGRAM_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(&out, NULL, 1),
+                     SEAGRASS_HISTOGRAM_ERROR_DATA_IS_NULL);
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(&out, empty, 0),
+                     SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID);
+    const unsigned char precision[] = {17};
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(&out, precision,
+                                                             1),
+                     SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID);
+    const unsigned char truncated[] = {8, 0};
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(&out, truncated,
+                                                             2),
+                     SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID);
+    const unsigned char zero[] = {8, 0, 0};
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(&out, zero, 3),
+                     SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID);
+    /* 7424 buckets, so skipping 7424 lands past the last one */
+    const unsigned char beyond[] = {8, 0x80, 0x3a, 1};
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(&out, beyond, 4),
+                     SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID);
+    const unsigned char last[] = {8, 0xff, 0x39, 1};
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(&out, last, 4),
+                     0);
+    assert_int_equal(out.counts[7423], 1);
+    assert_int_equal(seagrass_histogram_snapshot_invalidate(&out), 0);
+    /* does not fit a uintmax_t */
+    const unsigned char large[] = {
+            8, 0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02
+    };
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(
+                             &out, large, sizeof(large)),
+                     SEAGRASS_HISTOGRAM_ERROR_DATA_IS_INVALID);
+    const unsigned char overflow[] = {
+            8, 0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+            0, 1
+    };
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(
+                             &out, overflow, sizeof(overflow)),
+                     SEAGRASS_HISTOGRAM_ERROR_RESULT_IS_INCONSISTENT);
+    calloc_is_overridden = true;
+    assert_int_equal(seagrass_histogram_snapshot_deserialize(&out, empty, 1),
+                     SEAGRASS_HISTOGRAM_ERROR_MEMORY_ALLOCATION_FAILED);
+    calloc_is_overridden = false;
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_histogram_init_error_on_object_is_null),
+            cmocka_unit_test(
+                    check_histogram_init_error_on_precision_is_invalid),
+            cmocka_unit_test(check_histogram_init_error_on_shards_is_zero),
+            cmocka_unit_test(
+                    check_histogram_init_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_histogram_init_invalidate),
+            cmocka_unit_test(
+                    check_histogram_invalidate_error_on_object_is_null),
+            cmocka_unit_test(check_histogram_record_error_on_object_is_null),
+            cmocka_unit_test(check_histogram_snapshot_error_on_object_is_null),
+            cmocka_unit_test(check_histogram_snapshot_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_histogram_snapshot_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_histogram_snapshot_error_on_overflow),
+            cmocka_unit_test(check_histogram_record),
+            cmocka_unit_test(check_histogram_snapshot_percentile),
+            cmocka_unit_test(
+                    check_histogram_snapshot_percentile_error_on_object_is_null),
+            cmocka_unit_test(check_histogram_snapshot_percentile_errors),
+            cmocka_unit_test(check_histogram_record_concurrently),
+            cmocka_unit_test(
+                    check_histogram_record_with_more_threads_than_identities),
+            cmocka_unit_test(check_histogram_merge),
+            cmocka_unit_test(check_histogram_snapshot_merge),
+            cmocka_unit_test(check_histogram_snapshot_serialize),
+            cmocka_unit_test(check_histogram_snapshot_deserialize_errors),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
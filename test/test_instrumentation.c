@@ -0,0 +1,316 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+static void check_is_enabled_error_on_out_is_null(void **state) {
+    assert_int_equal(seagrass_instrumentation_is_enabled(NULL),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL);
+}
+
+static void check_is_enabled(void **state) {
+    bool out;
+    assert_int_equal(seagrass_instrumentation_is_enabled(&out), 0);
+#ifdef SEAGRASS_INSTRUMENTATION
+    assert_true(out);
+#else
+    assert_false(out);
+#endif
+}
+
+static void check_function_name_error_on_function_is_invalid(void **state) {
+    const char *out;
+    assert_int_equal(seagrass_instrumentation_function_name(
+                             SEAGRASS_INSTRUMENTATION_FUNCTIONS, &out),
+                     SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID);
+}
+
+static void check_function_name_error_on_out_is_null(void **state) {
+    assert_int_equal(seagrass_instrumentation_function_name(
+                             SEAGRASS_INSTRUMENTATION_FLOAT_ADD, NULL),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL);
+}
+
+static void check_function_name(void **state) {
+    const char *out;
+    assert_int_equal(seagrass_instrumentation_function_name(
+                             SEAGRASS_INSTRUMENTATION_INT32_T_ADD, &out), 0);
+    assert_string_equal(out, "seagrass_int32_t_add");
+    assert_int_equal(seagrass_instrumentation_function_name(
+                             SEAGRASS_INSTRUMENTATION_FLOAT_ADD, &out), 0);
+    assert_string_equal(out, "seagrass_float_add");
+    assert_int_equal(seagrass_instrumentation_function_name(
+                             SEAGRASS_INSTRUMENTATION_UINTMAX_T_MULTIPLY,
+                             &out), 0);
+    assert_string_equal(out, "seagrass_uintmax_t_multiply");
+    assert_int_equal(seagrass_instrumentation_function_name(
+                             SEAGRASS_INSTRUMENTATION_DOUBLE_DIVIDE, &out), 0);
+    assert_string_equal(out, "seagrass_double_divide");
+}
+
+static void check_snapshot_error_on_out_is_null(void **state) {
+    assert_int_equal(seagrass_instrumentation_snapshot(NULL),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL);
+}
+
+static void check_snapshot_merge_error_on_object_is_null(void **state) {
+    struct seagrass_instrumentation_snapshot other = {0};
+    assert_int_equal(seagrass_instrumentation_snapshot_merge(NULL, &other),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_snapshot_merge_error_on_other_is_null(void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    assert_int_equal(seagrass_instrumentation_snapshot_merge(&object, NULL),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OTHER_IS_NULL);
+}
+
+static void check_snapshot_merge_error_on_result_is_inconsistent(
+        void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    struct seagrass_instrumentation_snapshot other = {0};
+    object.counts[SEAGRASS_INSTRUMENTATION_INT32_T_ADD]
+                 [SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS] = 3;
+    object.counts[SEAGRASS_INSTRUMENTATION_DOUBLE_DIVIDE]
+                 [SEAGRASS_INSTRUMENTATION_OUTCOME_OTHER] = UINTMAX_MAX;
+    other.counts[SEAGRASS_INSTRUMENTATION_INT32_T_ADD]
+                [SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS] = 4;
+    other.counts[SEAGRASS_INSTRUMENTATION_DOUBLE_DIVIDE]
+                [SEAGRASS_INSTRUMENTATION_OUTCOME_OTHER] = 1;
+    assert_int_equal(seagrass_instrumentation_snapshot_merge(&object, &other),
+                     SEAGRASS_INSTRUMENTATION_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(object.counts[SEAGRASS_INSTRUMENTATION_INT32_T_ADD]
+                                  [SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS],
+                     3);
+}
+
+static void check_snapshot_merge(void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    struct seagrass_instrumentation_snapshot other = {0};
+    object.counts[SEAGRASS_INSTRUMENTATION_INT32_T_ADD]
+                 [SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS] = 3;
+    other.counts[SEAGRASS_INSTRUMENTATION_INT32_T_ADD]
+                [SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS] = 4;
+    other.counts[SEAGRASS_INSTRUMENTATION_DOUBLE_DIVIDE]
+                [SEAGRASS_INSTRUMENTATION_OUTCOME_DIVIDE_BY_ZERO] = 5;
+    assert_int_equal(seagrass_instrumentation_snapshot_merge(&object, &other),
+                     0);
+    uintmax_t out;
+    assert_int_equal(seagrass_instrumentation_snapshot_count(
+                             &object,
+                             SEAGRASS_INSTRUMENTATION_INT32_T_ADD,
+                             SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS,
+                             &out), 0);
+    assert_int_equal(out, 7);
+    assert_int_equal(seagrass_instrumentation_snapshot_count(
+                             &object,
+                             SEAGRASS_INSTRUMENTATION_DOUBLE_DIVIDE,
+                             SEAGRASS_INSTRUMENTATION_OUTCOME_DIVIDE_BY_ZERO,
+                             &out), 0);
+    assert_int_equal(out, 5);
+}
+
+static void check_snapshot_count_error_on_object_is_null(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_instrumentation_snapshot_count(
+                             NULL,
+                             SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+                             SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS,
+                             &out),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_snapshot_count_error_on_function_is_invalid(void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    uintmax_t out;
+    assert_int_equal(seagrass_instrumentation_snapshot_count(
+                             &object,
+                             SEAGRASS_INSTRUMENTATION_FUNCTIONS,
+                             SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS,
+                             &out),
+                     SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID);
+}
+
+static void check_snapshot_count_error_on_outcome_is_invalid(void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    uintmax_t out;
+    assert_int_equal(seagrass_instrumentation_snapshot_count(
+                             &object,
+                             SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+                             SEAGRASS_INSTRUMENTATION_OUTCOMES,
+                             &out),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OUTCOME_IS_INVALID);
+}
+
+static void check_snapshot_count_error_on_out_is_null(void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    assert_int_equal(seagrass_instrumentation_snapshot_count(
+                             &object,
+                             SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+                             SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS,
+                             NULL),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL);
+}
+
+static void check_snapshot_calls_error_on_object_is_null(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_instrumentation_snapshot_calls(
+                             NULL, SEAGRASS_INSTRUMENTATION_FLOAT_ADD, &out),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_snapshot_calls_error_on_function_is_invalid(void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    uintmax_t out;
+    assert_int_equal(seagrass_instrumentation_snapshot_calls(
+                             &object, SEAGRASS_INSTRUMENTATION_FUNCTIONS,
+                             &out),
+                     SEAGRASS_INSTRUMENTATION_ERROR_FUNCTION_IS_INVALID);
+}
+
+static void check_snapshot_calls_error_on_out_is_null(void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    assert_int_equal(seagrass_instrumentation_snapshot_calls(
+                             &object, SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+                             NULL),
+                     SEAGRASS_INSTRUMENTATION_ERROR_OUT_IS_NULL);
+}
+
+static void check_snapshot_calls_error_on_result_is_inconsistent(
+        void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    object.counts[SEAGRASS_INSTRUMENTATION_FLOAT_ADD]
+                 [SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS] = UINTMAX_MAX;
+    object.counts[SEAGRASS_INSTRUMENTATION_FLOAT_ADD]
+                 [SEAGRASS_INSTRUMENTATION_OUTCOME_OTHER] = 1;
+    uintmax_t out;
+    assert_int_equal(seagrass_instrumentation_snapshot_calls(
+                             &object, SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+                             &out),
+                     SEAGRASS_INSTRUMENTATION_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_snapshot_calls(void **state) {
+    struct seagrass_instrumentation_snapshot object = {0};
+    object.counts[SEAGRASS_INSTRUMENTATION_FLOAT_ADD]
+                 [SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS] = 2;
+    object.counts[SEAGRASS_INSTRUMENTATION_FLOAT_ADD]
+                 [SEAGRASS_INSTRUMENTATION_OUTCOME_RESULT_IS_UNCHANGED] = 3;
+    object.counts[SEAGRASS_INSTRUMENTATION_FLOAT_ADD]
+                 [SEAGRASS_INSTRUMENTATION_OUTCOME_ARGUMENT_IS_NULL] = 5;
+    uintmax_t out;
+    assert_int_equal(seagrass_instrumentation_snapshot_calls(
+                             &object, SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+                             &out), 0);
+    assert_int_equal(out, 10);
+}
+
+static uintmax_t count(const struct seagrass_instrumentation_snapshot *a,
+                       const struct seagrass_instrumentation_snapshot *b,
+                       const enum seagrass_instrumentation_function function,
+                       const enum seagrass_instrumentation_outcome outcome) {
+    uintmax_t before;
+    uintmax_t after;
+    assert_int_equal(seagrass_instrumentation_snapshot_count(
+                             a, function, outcome, &before), 0);
+    assert_int_equal(seagrass_instrumentation_snapshot_count(
+                             b, function, outcome, &after), 0);
+    return after - before;
+}
+
+static void *multiply(void *const arg) {
+    uintmax_t out;
+    for (uintmax_t i = 0; i < 10; i++) {
+        assert_int_equal(seagrass_uintmax_t_multiply(UINTMAX_MAX, 2, &out),
+                         SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT);
+    }
+    return NULL;
+}
+
+static void check_snapshot(void **state) {
+    struct seagrass_instrumentation_snapshot before;
+    assert_int_equal(seagrass_instrumentation_snapshot(&before), 0);
+    float f;
+    assert_int_equal(seagrass_float_add(1.0f, 1e-10f, &f),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED);
+    assert_int_equal(seagrass_float_add(1.0f, 1e-10f, &f),
+                     SEAGRASS_FLOAT_ERROR_RESULT_IS_UNCHANGED);
+    assert_int_equal(seagrass_float_add(1.0f, 2.0f, &f), 0);
+    assert_int_equal(seagrass_float_add(1.0f, 2.0f, NULL),
+                     SEAGRASS_FLOAT_ERROR_OUT_IS_NULL);
+    int32_t q;
+    assert_int_equal(seagrass_int32_t_divide(1, 0, &q, NULL),
+                     SEAGRASS_INT32_T_ERROR_DIVIDE_BY_ZERO);
+    /* counts of a thread are kept after it exits */
+    pthread_t thread;
+    assert_int_equal(pthread_create(&thread, NULL, multiply, NULL), 0);
+    assert_int_equal(pthread_join(thread, NULL), 0);
+    struct seagrass_instrumentation_snapshot after;
+    assert_int_equal(seagrass_instrumentation_snapshot(&after), 0);
+#ifdef SEAGRASS_INSTRUMENTATION
+    const uintmax_t calls[] = {2, 1, 1, 1, 10};
+#else
+    const uintmax_t calls[] = {0, 0, 0, 0, 0};
+#endif
+    assert_int_equal(
+            count(&before, &after, SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+                  SEAGRASS_INSTRUMENTATION_OUTCOME_RESULT_IS_UNCHANGED),
+            calls[0]);
+    assert_int_equal(
+            count(&before, &after, SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+                  SEAGRASS_INSTRUMENTATION_OUTCOME_SUCCESS),
+            calls[1]);
+    assert_int_equal(
+            count(&before, &after, SEAGRASS_INSTRUMENTATION_FLOAT_ADD,
+                  SEAGRASS_INSTRUMENTATION_OUTCOME_ARGUMENT_IS_NULL),
+            calls[2]);
+    assert_int_equal(
+            count(&before, &after, SEAGRASS_INSTRUMENTATION_INT32_T_DIVIDE,
+                  SEAGRASS_INSTRUMENTATION_OUTCOME_DIVIDE_BY_ZERO),
+            calls[3]);
+    assert_int_equal(
+            count(&before, &after,
+                  SEAGRASS_INSTRUMENTATION_UINTMAX_T_MULTIPLY,
+                  SEAGRASS_INSTRUMENTATION_OUTCOME_RESULT_IS_INCONSISTENT),
+            calls[4]);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_is_enabled_error_on_out_is_null),
+            cmocka_unit_test(check_is_enabled),
+            cmocka_unit_test(
+                    check_function_name_error_on_function_is_invalid),
+            cmocka_unit_test(check_function_name_error_on_out_is_null),
+            cmocka_unit_test(check_function_name),
+            cmocka_unit_test(check_snapshot_error_on_out_is_null),
+            cmocka_unit_test(check_snapshot_merge_error_on_object_is_null),
+            cmocka_unit_test(check_snapshot_merge_error_on_other_is_null),
+            cmocka_unit_test(
+                    check_snapshot_merge_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_snapshot_merge),
+            cmocka_unit_test(check_snapshot_count_error_on_object_is_null),
+            cmocka_unit_test(
+                    check_snapshot_count_error_on_function_is_invalid),
+            cmocka_unit_test(
+                    check_snapshot_count_error_on_outcome_is_invalid),
+            cmocka_unit_test(check_snapshot_count_error_on_out_is_null),
+            cmocka_unit_test(check_snapshot_calls_error_on_object_is_null),
+            cmocka_unit_test(
+                    check_snapshot_calls_error_on_function_is_invalid),
+            cmocka_unit_test(check_snapshot_calls_error_on_out_is_null),
+            cmocka_unit_test(
+                    check_snapshot_calls_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_snapshot_calls),
+            cmocka_unit_test(check_snapshot),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
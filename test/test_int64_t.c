@@ -0,0 +1,230 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+static void check_int64_t_ptr_compare(void **state) {
+    const int64_t q[] = {
+            -1,
+            1
+    };
+    const int64_t *i[] = {
+            &q[0],
+            &q[1]
+    };
+    assert_int_equal((-1), seagrass_int64_t_ptr_compare(i[0], i[1]));
+    assert_int_equal((-1), seagrass_int64_t_ptr_compare(i[1], NULL));
+    assert_int_equal((-1), seagrass_int64_t_ptr_compare(i[0], NULL));
+    assert_int_equal(0, seagrass_int64_t_ptr_compare(i[0], i[0]));
+    assert_int_equal(0, seagrass_int64_t_ptr_compare(i[1], i[1]));
+    assert_int_equal(1, seagrass_int64_t_ptr_compare(i[1], i[0]));
+    assert_int_equal(1, seagrass_int64_t_ptr_compare(NULL, i[0]));
+    assert_int_equal(1, seagrass_int64_t_ptr_compare(NULL, i[1]));
+
+    abort_is_overridden = true;
+    expect_function_call(cmocka_test_abort);
+    seagrass_int64_t_ptr_compare(NULL, NULL);
+    abort_is_overridden = false;
+}
+
+static void check_int64_t_compare(void **state) {
+    const int64_t i[] = {
+            INT64_MIN,
+            0,
+            INT64_MAX
+    };
+    assert_int_equal((-1), seagrass_int64_t_compare(i[0], i[1]));
+    assert_int_equal((-1), seagrass_int64_t_compare(i[1], i[2]));
+    assert_int_equal(0, seagrass_int64_t_compare(i[0], i[0]));
+    assert_int_equal(0, seagrass_int64_t_compare(i[2], i[2]));
+    assert_int_equal(1, seagrass_int64_t_compare(i[2], i[0]));
+    assert_int_equal(1, seagrass_int64_t_compare(i[1], i[0]));
+}
+
+static void check_int64_t_minimum_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_int64_t_minimum(1, 1, NULL),
+            SEAGRASS_INT64_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_int64_t_minimum(void **state) {
+    int64_t result;
+    assert_int_equal(
+            seagrass_int64_t_minimum(-1, INT64_MAX, &result), 0);
+    assert_true(-1 == result);
+    assert_int_equal(
+            seagrass_int64_t_minimum(INT64_MAX, INT64_MIN, &result), 0);
+    assert_true(INT64_MIN == result);
+}
+
+static void check_int64_t_maximum_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_int64_t_maximum(1, 1, NULL),
+            SEAGRASS_INT64_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_int64_t_maximum(void **state) {
+    int64_t result;
+    assert_int_equal(
+            seagrass_int64_t_maximum(-32, 121, &result), 0);
+    assert_true(121 == result);
+    assert_int_equal(
+            seagrass_int64_t_maximum(INT64_MIN, -21, &result), 0);
+    assert_true(-21 == result);
+}
+
+static void check_int64_t_add_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_int64_t_add(0, 1, NULL),
+            SEAGRASS_INT64_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_int64_t_add_error_on_result_is_inconsistent(void **state) {
+    int64_t result;
+    assert_int_equal(
+            seagrass_int64_t_add(INT64_MAX, 1, &result),
+            SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_int64_t_add(INT64_MIN, -1, &result),
+            SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_int64_t_add(void **state) {
+    int64_t result;
+    assert_int_equal(
+            seagrass_int64_t_add(0, 1, &result), 0);
+    assert_true(1 == result);
+    assert_int_equal(
+            seagrass_int64_t_add(INT64_MAX, INT64_MIN, &result), 0);
+    assert_true(-1 == result);
+}
+
+static void check_int64_t_subtract_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_int64_t_subtract(1, 1, NULL),
+            SEAGRASS_INT64_T_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_int64_t_subtract_error_on_result_is_inconsistent(void **state) {
+    assert_int_equal(
+            seagrass_int64_t_subtract(INT64_MIN, 1, (void *) 1),
+            SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_int64_t_subtract(0, INT64_MIN, (void *) 1),
+            SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_int64_t_subtract(void **state) {
+    int64_t result;
+    assert_int_equal(
+            seagrass_int64_t_subtract(0, 1, &result), 0);
+    assert_true(-1 == result);
+    assert_int_equal(
+            seagrass_int64_t_subtract(-1, INT64_MAX, &result), 0);
+    assert_true(INT64_MIN == result);
+}
+
+static void check_int64_t_multiply_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_int64_t_multiply(1, 3, NULL),
+            SEAGRASS_INT64_T_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_int64_t_multiply_error_on_result_is_inconsistent(void **state) {
+    int64_t result;
+    assert_int_equal(
+            seagrass_int64_t_multiply(2, INT64_MAX, &result),
+            SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_int64_t_multiply(-2, INT64_MAX, &result),
+            SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_int64_t_multiply(-1, INT64_MIN, &result),
+            SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_int64_t_multiply(INT64_MIN, -1, &result),
+            SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_int64_t_multiply(void **state) {
+    int64_t result;
+    assert_int_equal(
+            seagrass_int64_t_multiply(0, INT64_MIN, &result), 0);
+    assert_true(0 == result);
+    assert_int_equal(
+            seagrass_int64_t_multiply(-2, -2, &result), 0);
+    assert_true(4 == result);
+    assert_int_equal(
+            seagrass_int64_t_multiply(-1, INT64_MAX, &result), 0);
+    assert_true(-INT64_MAX == result);
+    assert_int_equal(
+            seagrass_int64_t_multiply(1, INT64_MIN, &result), 0);
+    assert_true(INT64_MIN == result);
+}
+
+static void check_int64_t_divide_error_on_quotient_is_null(void **state) {
+    assert_int_equal(
+            seagrass_int64_t_divide(1, 1, NULL, (void *) 1),
+            SEAGRASS_INT64_T_ERROR_QUOTIENT_IS_NULL);
+}
+
+static void check_int64_t_divide_error_on_divide_by_zero(void **state) {
+    assert_int_equal(
+            seagrass_int64_t_divide(1, 0, (void *) 1, (void *) 1),
+            SEAGRASS_INT64_T_ERROR_DIVIDE_BY_ZERO);
+}
+
+static void
+check_int64_t_divide_error_on_result_is_inconsistent(void **state) {
+    int64_t quotient;
+    assert_int_equal(
+            seagrass_int64_t_divide(INT64_MIN, -1, &quotient, NULL),
+            SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_int64_t_divide(void **state) {
+    int64_t quotient, remainder;
+    assert_int_equal(
+            seagrass_int64_t_divide(0, 1, &quotient, NULL), 0);
+    assert_true(0 == quotient);
+    assert_int_equal(
+            seagrass_int64_t_divide(INT64_MIN, 1, &quotient, NULL), 0);
+    assert_true(INT64_MIN == quotient);
+    assert_int_equal(
+            seagrass_int64_t_divide(-22, 5, &quotient, &remainder), 0);
+    assert_true(-4 == quotient);
+    assert_true(-2 == remainder);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_int64_t_ptr_compare),
+            cmocka_unit_test(check_int64_t_compare),
+            cmocka_unit_test(check_int64_t_minimum_error_on_out_is_null),
+            cmocka_unit_test(check_int64_t_minimum),
+            cmocka_unit_test(check_int64_t_maximum_error_on_out_is_null),
+            cmocka_unit_test(check_int64_t_maximum),
+            cmocka_unit_test(check_int64_t_add_error_on_out_is_null),
+            cmocka_unit_test(check_int64_t_add_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_int64_t_add),
+            cmocka_unit_test(check_int64_t_subtract_error_on_out_is_null),
+            cmocka_unit_test(check_int64_t_subtract_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_int64_t_subtract),
+            cmocka_unit_test(check_int64_t_multiply_error_on_out_is_null),
+            cmocka_unit_test(check_int64_t_multiply_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_int64_t_multiply),
+            cmocka_unit_test(check_int64_t_divide_error_on_quotient_is_null),
+            cmocka_unit_test(check_int64_t_divide_error_on_divide_by_zero),
+            cmocka_unit_test(check_int64_t_divide_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_int64_t_divide),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
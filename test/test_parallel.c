@@ -0,0 +1,339 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include "thread_pool.h"
+
+#include <test/cmocka.h>
+
+#define COUNT 200003
+
+static const unsigned int concurrencies[] = {1, 2, 3, 8};
+
+#define CONCURRENCIES (sizeof(concurrencies) / sizeof(concurrencies[0]))
+
+static void visit(void *const context, const uintmax_t index) {
+    unsigned char *const visits = context;
+    __atomic_fetch_add(&visits[index], 1, __ATOMIC_RELAXED);
+}
+
+static void check_thread_pool_for(void **state) {
+    unsigned char *visits = malloc(COUNT);
+    assert_non_null(visits);
+    for (size_t c = 0; c < CONCURRENCIES; c++) {
+        seagrass_thread_pool_set_concurrency(concurrencies[c]);
+        memset(visits, 0, COUNT);
+        seagrass_thread_pool_for(COUNT, visit, visits);
+        for (uintmax_t i = 0; i < COUNT; i++) {
+            assert_int_equal(visits[i], 1);
+        }
+    }
+    seagrass_thread_pool_set_concurrency(0);
+    free(visits);
+}
+
+static void check_thread_pool_for_error_on_task_is_null(void **state) {
+    abort_is_overridden = true;
+    expect_function_call(cmocka_test_abort);
+    seagrass_thread_pool_for(0, NULL, NULL);
+    abort_is_overridden = false;
+}
+
+static void check_parallel_error_on_values_is_null(void **state) {
+    uintmax_t u;
+    float f;
+    assert_int_equal(seagrass_parallel_uintmax_t_sum(NULL, 1, &u),
+                     SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_parallel_uintmax_t_product(NULL, 1, &u),
+                     SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_parallel_uintmax_t_minimum(NULL, 1, &u),
+                     SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_parallel_uintmax_t_maximum(NULL, 1, &u),
+                     SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_parallel_float_sum(
+                             NULL, 1, SEAGRASS_FLOAT_SUMMATION_PAIRWISE,
+                             &f, NULL),
+                     SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_parallel_float_product(NULL, 1, &f),
+                     SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_parallel_float_minimum(NULL, 1, &f),
+                     SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_parallel_float_maximum(NULL, 1, &f),
+                     SEAGRASS_PARALLEL_ERROR_VALUES_IS_NULL);
+}
+
+static void check_parallel_error_on_out_is_null(void **state) {
+    const uintmax_t u = 1;
+    const float f = 1;
+    assert_int_equal(seagrass_parallel_uintmax_t_sum(&u, 1, NULL),
+                     SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_parallel_uintmax_t_product(&u, 1, NULL),
+                     SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_parallel_uintmax_t_minimum(&u, 1, NULL),
+                     SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_parallel_uintmax_t_maximum(&u, 1, NULL),
+                     SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_parallel_float_sum(
+                             &f, 1, SEAGRASS_FLOAT_SUMMATION_PAIRWISE,
+                             NULL, NULL),
+                     SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_parallel_float_product(&f, 1, NULL),
+                     SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_parallel_float_minimum(&f, 1, NULL),
+                     SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_parallel_float_maximum(&f, 1, NULL),
+                     SEAGRASS_PARALLEL_ERROR_OUT_IS_NULL);
+}
+
+static void check_parallel_error_on_count_is_zero(void **state) {
+    const uintmax_t u = 1;
+    const float f = 1;
+    uintmax_t a;
+    float b;
+    assert_int_equal(seagrass_parallel_uintmax_t_minimum(&u, 0, &a),
+                     SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_parallel_uintmax_t_maximum(&u, 0, &a),
+                     SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_parallel_float_minimum(&f, 0, &b),
+                     SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_parallel_float_maximum(&f, 0, &b),
+                     SEAGRASS_PARALLEL_ERROR_COUNT_IS_ZERO);
+}
+
+static void check_parallel_error_on_summation_is_invalid(void **state) {
+    const float f = 1;
+    float out;
+    assert_int_equal(seagrass_parallel_float_sum(&f, 1, 3, &out, NULL),
+                     SEAGRASS_PARALLEL_ERROR_SUMMATION_IS_INVALID);
+}
+
+static void
+check_parallel_error_on_memory_allocation_failed(void **state) {
+    uintmax_t *values = calloc(COUNT, sizeof(*values));
+    assert_non_null(values);
+    uintmax_t out;
+    malloc_is_overridden = true;
+    assert_int_equal(seagrass_parallel_uintmax_t_sum(values, COUNT, &out),
+                     SEAGRASS_PARALLEL_ERROR_MEMORY_ALLOCATION_FAILED);
+    malloc_is_overridden = false;
+    free(values);
+}
+
+static void check_parallel_uintmax_t(void **state) {
+    uintmax_t *values = malloc(COUNT * sizeof(*values));
+    assert_non_null(values);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = (i * 2654435761u) % 1000003 + 1;
+    }
+    values[77777] = 0;
+    values[4242] = 2000000;
+    uintmax_t sum = 0;
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        sum += values[i];
+    }
+    for (size_t c = 0; c < CONCURRENCIES; c++) {
+        seagrass_thread_pool_set_concurrency(concurrencies[c]);
+        uintmax_t out;
+        assert_int_equal(seagrass_parallel_uintmax_t_sum(values, COUNT, &out),
+                         0);
+        assert_int_equal(out, sum);
+        assert_int_equal(seagrass_parallel_uintmax_t_minimum(
+                values, COUNT, &out), 0);
+        assert_int_equal(out, 0);
+        assert_int_equal(seagrass_parallel_uintmax_t_maximum(
+                values, COUNT, &out), 0);
+        assert_int_equal(out, 2000000);
+        /* the product overflows long before the zero */
+        assert_int_equal(seagrass_parallel_uintmax_t_product(
+                values, COUNT, &out),
+                         SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT);
+    }
+    seagrass_thread_pool_set_concurrency(0);
+    free(values);
+}
+
+static void check_parallel_uintmax_t_sum_overflow(void **state) {
+    uintmax_t *values = calloc(COUNT, sizeof(*values));
+    assert_non_null(values);
+    values[1] = UINTMAX_MAX;
+    values[COUNT - 1] = 1;
+    for (size_t c = 0; c < CONCURRENCIES; c++) {
+        seagrass_thread_pool_set_concurrency(concurrencies[c]);
+        uintmax_t out;
+        assert_int_equal(seagrass_parallel_uintmax_t_sum(values, COUNT, &out),
+                         SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT);
+    }
+    seagrass_thread_pool_set_concurrency(0);
+    free(values);
+}
+
+static void check_parallel_uintmax_t_product(void **state) {
+    uintmax_t *values = malloc(COUNT * sizeof(*values));
+    assert_non_null(values);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = 1;
+    }
+    values[3] = 3;
+    values[COUNT - 2] = 5;
+    for (size_t c = 0; c < CONCURRENCIES; c++) {
+        seagrass_thread_pool_set_concurrency(concurrencies[c]);
+        uintmax_t out;
+        assert_int_equal(seagrass_parallel_uintmax_t_product(
+                values, COUNT, &out), 0);
+        assert_int_equal(out, 15);
+        /* a zero before the overflow wins */
+        values[50000] = 0;
+        values[60000] = UINTMAX_MAX;
+        assert_int_equal(seagrass_parallel_uintmax_t_product(
+                values, COUNT, &out), 0);
+        assert_int_equal(out, 0);
+        /* while an overflow before the zero is reported */
+        values[40000] = UINTMAX_MAX;
+        assert_int_equal(seagrass_parallel_uintmax_t_product(
+                values, COUNT, &out),
+                         SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT);
+        values[40000] = 1;
+        values[50000] = 1;
+        values[60000] = 1;
+    }
+    seagrass_thread_pool_set_concurrency(0);
+    free(values);
+}
+
+static void check_parallel_float_sum(void **state) {
+    float *values = malloc(COUNT * sizeof(*values));
+    assert_non_null(values);
+    double exact = 0;
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = (float) ((i % 1000) + 0.1 * (i % 7)) - 400.0f;
+        exact += values[i];
+    }
+    const enum seagrass_float_summation summations[] = {
+            SEAGRASS_FLOAT_SUMMATION_COMPENSATED,
+            SEAGRASS_FLOAT_SUMMATION_PAIRWISE,
+            SEAGRASS_FLOAT_SUMMATION_DOUBLE
+    };
+    for (size_t s = 0; s < 3; s++) {
+        float expected;
+        float bound;
+        for (size_t c = 0; c < CONCURRENCIES; c++) {
+            seagrass_thread_pool_set_concurrency(concurrencies[c]);
+            float out, error;
+            assert_int_equal(seagrass_parallel_float_sum(
+                    values, COUNT, summations[s], &out, &error), 0);
+            assert_true(fabs(out - exact) <= error);
+            if (!c) {
+                expected = out;
+                bound = error;
+            } else {
+                /* identical regardless of the number of threads */
+                assert_memory_equal(&out, &expected, sizeof(out));
+                assert_memory_equal(&error, &bound, sizeof(error));
+            }
+        }
+    }
+    values[COUNT - 1] = NAN;
+    float out;
+    assert_int_equal(seagrass_parallel_float_sum(
+            values, COUNT, SEAGRASS_FLOAT_SUMMATION_PAIRWISE, &out, NULL),
+                     SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT);
+    seagrass_thread_pool_set_concurrency(0);
+    free(values);
+}
+
+static void check_parallel_float_sum_fast_denormals(void **state) {
+    float *values = malloc(COUNT * sizeof(*values));
+    assert_non_null(values);
+    double exact = 0;
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = i % 100 ? FLT_MIN / (float) (2 + i % 5) : 1.0f;
+        exact += values[i];
+    }
+    bool supported;
+    assert_int_equal(seagrass_float_fast_denormals_is_supported(&supported),
+                     0);
+    for (size_t c = 0; c < CONCURRENCIES; c++) {
+        seagrass_thread_pool_set_concurrency(concurrencies[c]);
+        float out, error;
+        assert_int_equal(seagrass_parallel_float_sum(
+                values, COUNT, SEAGRASS_FLOAT_SUMMATION_PAIRWISE
+                               | SEAGRASS_FLOAT_SUMMATION_FAST_DENORMALS,
+                &out, &error), 0);
+        assert_true(fabs(out - exact) <= error);
+        if (supported) {
+            /* every worker flushed the subnormal values */
+            assert_true((float) ((COUNT + 99) / 100) == out);
+        }
+    }
+    seagrass_thread_pool_set_concurrency(0);
+    free(values);
+}
+
+static void check_parallel_float(void **state) {
+    float *values = malloc(COUNT * sizeof(*values));
+    assert_non_null(values);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = 1.0f + (float) (i % 11) * 0x1p-20f;
+    }
+    values[12345] = -3.5f;
+    values[99999] = 7.25f;
+    float expected;
+    for (size_t c = 0; c < CONCURRENCIES; c++) {
+        seagrass_thread_pool_set_concurrency(concurrencies[c]);
+        float out;
+        assert_int_equal(seagrass_parallel_float_minimum(
+                values, COUNT, &out), 0);
+        assert_true(out == -3.5f);
+        assert_int_equal(seagrass_parallel_float_maximum(
+                values, COUNT, &out), 0);
+        assert_true(out == 7.25f);
+        assert_int_equal(seagrass_parallel_float_product(
+                values, COUNT, &out), 0);
+        if (!c) {
+            expected = out;
+        } else {
+            assert_memory_equal(&out, &expected, sizeof(out));
+        }
+    }
+    values[COUNT - 1] = NAN;
+    float out;
+    assert_int_equal(seagrass_parallel_float_minimum(values, COUNT, &out),
+                     SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_parallel_float_maximum(values, COUNT, &out),
+                     SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_parallel_float_product(values, COUNT, &out),
+                     SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT);
+    values[COUNT - 1] = 1e30f;
+    values[COUNT - 2] = 1e30f;
+    assert_int_equal(seagrass_parallel_float_product(values, COUNT, &out),
+                     SEAGRASS_PARALLEL_ERROR_RESULT_IS_INCONSISTENT);
+    seagrass_thread_pool_set_concurrency(0);
+    free(values);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_thread_pool_for),
+            cmocka_unit_test(check_thread_pool_for_error_on_task_is_null),
+            cmocka_unit_test(check_parallel_error_on_values_is_null),
+            cmocka_unit_test(check_parallel_error_on_out_is_null),
+            cmocka_unit_test(check_parallel_error_on_count_is_zero),
+            cmocka_unit_test(check_parallel_error_on_summation_is_invalid),
+            cmocka_unit_test(check_parallel_error_on_memory_allocation_failed),
+            cmocka_unit_test(check_parallel_uintmax_t),
+            cmocka_unit_test(check_parallel_uintmax_t_sum_overflow),
+            cmocka_unit_test(check_parallel_uintmax_t_product),
+            cmocka_unit_test(check_parallel_float_sum),
+            cmocka_unit_test(check_parallel_float_sum_fast_denormals),
+            cmocka_unit_test(check_parallel_float),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
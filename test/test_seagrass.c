@@ -24,6 +24,50 @@ static void check_required_true(void **state) {
     abort_is_overridden = false;
 }
 
+static void check_required_function(void **state) {
+    abort_is_overridden = true;
+    (seagrass_required)((void *)1);
+    expect_function_call(cmocka_test_abort);
+    (seagrass_required)(NULL);
+    abort_is_overridden = false;
+}
+
+static void check_required_true_function(void **state) {
+    abort_is_overridden = true;
+    (seagrass_required_true)(true);
+    expect_function_call(cmocka_test_abort);
+    (seagrass_required_true)(false);
+    abort_is_overridden = false;
+}
+
+static const char *failed_file;
+static int failed_line;
+static const char *failed_expression;
+
+static void on_failure(const char *file, int line, const char *expression) {
+    failed_file = file;
+    failed_line = line;
+    failed_expression = expression;
+}
+
+static void check_required_set_handler(void **state) {
+    assert_null(seagrass_required_set_handler(on_failure));
+    abort_is_overridden = true;
+    const int line = __LINE__ + 2;
+    expect_function_call(cmocka_test_abort);
+    seagrass_required_true(1 == 2);
+    assert_string_equal(failed_file, __FILE__);
+    assert_int_equal(failed_line, line);
+    assert_string_equal(failed_expression, "1 == 2");
+    expect_function_call(cmocka_test_abort);
+    (seagrass_required_true)(false);
+    assert_null(failed_file);
+    assert_int_equal(failed_line, 0);
+    abort_is_overridden = false;
+    assert_ptr_equal(seagrass_required_set_handler(NULL), on_failure);
+    assert_null(seagrass_required_set_handler(NULL));
+}
+
 static void check_void_ptr_compare(void **state) {
     const void* i[] = {
             NULL,
@@ -35,11 +79,129 @@ static void check_void_ptr_compare(void **state) {
     assert_int_equal(1, seagrass_void_ptr_compare(i[1], i[0]));
 }
 
+static void check_generic_compare(void **state) {
+    assert_int_equal((-1), seagrass_compare((uint32_t) 1, (uint32_t) 2));
+    assert_int_equal((-1), seagrass_compare((int32_t) -1, (int32_t) 0));
+    assert_int_equal(1, seagrass_compare((int64_t) 1, (int64_t) -1));
+    assert_int_equal(0, seagrass_compare(UINTMAX_MAX, UINTMAX_MAX));
+    assert_int_equal((-1), seagrass_compare((size_t) 0, SIZE_MAX));
+    assert_int_equal(1, seagrass_compare(2.0f, 1.0f));
+    assert_int_equal(0, seagrass_compare(1.0, 1.0));
+}
+
+static void check_generic_fits(void **state) {
+    uint32_t u;
+    assert_true(SEAGRASS_GENERIC_FITS((uint32_t) 1, u));
+    assert_true(SEAGRASS_GENERIC_FITS(1, u));
+    assert_true(SEAGRASS_GENERIC_FITS((char) 1, u));
+    assert_false(SEAGRASS_GENERIC_FITS((uintmax_t) 1 << 40, u));
+    assert_false(SEAGRASS_GENERIC_FITS(1.0f, u));
+    assert_false(SEAGRASS_GENERIC_FITS((void *) 0, u));
+    float f;
+    assert_true(SEAGRASS_GENERIC_FITS(2.0f, f));
+    assert_true(SEAGRASS_GENERIC_FITS(2, f));
+    assert_false(SEAGRASS_GENERIC_FITS(2.0, f));
+    double d;
+    assert_true(SEAGRASS_GENERIC_FITS(1.0f, d));
+    assert_true(SEAGRASS_GENERIC_FITS(1.0, d));
+    assert_false(SEAGRASS_GENERIC_FITS(1.0L, d));
+}
+
+static void check_generic_operands(void **state) {
+    uintmax_t o = 41;
+    assert_int_equal(seagrass_add(o, 1, &o), 0);
+    assert_int_equal(42, o);
+    const int k = 3;
+    float f = 1.5f;
+    assert_int_equal(seagrass_multiply(f, 2.0f * k, &f), 0);
+    assert_true(9.0f == f);
+    double d;
+    assert_int_equal(seagrass_add(0.5f, 1, &d), 0);
+    assert_true(1.5 == d);
+    int64_t i;
+    assert_int_equal(seagrass_subtract((int32_t) -1, 1, &i), 0);
+    assert_int_equal(-2, i);
+}
+
+static void check_generic_size_t(void **state) {
+    size_t s;
+    assert_int_equal(seagrass_add((size_t) 1, 2, &s), 0);
+    assert_int_equal(3, s);
+    assert_int_equal(seagrass_subtract((size_t) 0, 1, &s),
+                     SEAGRASS_SIZE_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_multiply(SIZE_MAX, 2, &s),
+                     SEAGRASS_SIZE_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_maximum((size_t) 4, 5, &s), 0);
+    assert_int_equal(5, s);
+    assert_int_equal((-1), seagrass_compare((size_t) 1, (size_t) 2));
+}
+
+static void check_generic_minimum_maximum(void **state) {
+    int32_t i;
+    assert_int_equal(seagrass_minimum(-1, 1, &i), 0);
+    assert_int_equal(-1, i);
+    assert_int_equal(seagrass_maximum(-1, 1, &i), 0);
+    assert_int_equal(1, i);
+    double d;
+    assert_int_equal(seagrass_minimum(-1.5, 1.5, &d), 0);
+    assert_true(-1.5 == d);
+    assert_int_equal(seagrass_maximum(-1.5, 1.5, &d), 0);
+    assert_true(1.5 == d);
+}
+
+static void check_generic_add(void **state) {
+    uint32_t u;
+    assert_int_equal(seagrass_add(UINT32_MAX, (uint32_t) 1, &u),
+                     SEAGRASS_UINT32_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_add(UINT32_MAX - 1, (uint32_t) 1, &u), 0);
+    assert_int_equal(UINT32_MAX, u);
+    int64_t i;
+    assert_int_equal(seagrass_add(INT64_MIN, (int64_t) -1, &i),
+                     SEAGRASS_INT64_T_ERROR_RESULT_IS_INCONSISTENT);
+    size_t s;
+    assert_int_equal(seagrass_add(SIZE_MAX, (size_t) 1, &s),
+                     SEAGRASS_SIZE_T_ERROR_RESULT_IS_INCONSISTENT);
+    float f;
+    assert_int_equal(seagrass_add(1.0f, 2.0f, &f), 0);
+    assert_true(3.0f == f);
+}
+
+static void check_generic_subtract(void **state) {
+    uintmax_t u;
+    assert_int_equal(seagrass_subtract((uintmax_t) 0, (uintmax_t) 1, &u),
+                     SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT);
+    int32_t i;
+    assert_int_equal(seagrass_subtract(0, 1, &i), 0);
+    assert_int_equal(-1, i);
+}
+
+static void check_generic_multiply(void **state) {
+    int32_t i;
+    assert_int_equal(seagrass_multiply(INT32_MIN, -1, &i),
+                     SEAGRASS_INT32_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_multiply(-3, 7, &i), 0);
+    assert_int_equal(-21, i);
+    double d;
+    assert_int_equal(seagrass_multiply(1.5, 2.0, &d), 0);
+    assert_true(3.0 == d);
+}
+
 int main(int argc, char *argv[]) {
     const struct CMUnitTest tests[] = {
             cmocka_unit_test(check_required),
             cmocka_unit_test(check_required_true),
+            cmocka_unit_test(check_required_function),
+            cmocka_unit_test(check_required_true_function),
+            cmocka_unit_test(check_required_set_handler),
             cmocka_unit_test(check_void_ptr_compare),
+            cmocka_unit_test(check_generic_compare),
+            cmocka_unit_test(check_generic_fits),
+            cmocka_unit_test(check_generic_operands),
+            cmocka_unit_test(check_generic_size_t),
+            cmocka_unit_test(check_generic_minimum_maximum),
+            cmocka_unit_test(check_generic_add),
+            cmocka_unit_test(check_generic_subtract),
+            cmocka_unit_test(check_generic_multiply),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
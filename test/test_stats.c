@@ -0,0 +1,315 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+/* spans several blocks and a partial one */
+#define COUNT 10007
+
+static void check_stats_init_error_on_object_is_null(void **state) {
+    assert_int_equal(seagrass_stats_init(NULL),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_stats_init(void **state) {
+    struct seagrass_stats object;
+    memset(&object, 0xff, sizeof(object));
+    assert_int_equal(seagrass_stats_init(&object), 0);
+    uintmax_t count;
+    assert_int_equal(seagrass_stats_count(&object, &count), 0);
+    assert_int_equal(count, 0);
+}
+
+static void check_stats_add_error_on_object_is_null(void **state) {
+    const float values[] = {1};
+    const uintmax_t integers[] = {1};
+    assert_int_equal(seagrass_stats_add_uintmax_t(NULL, 1),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_stats_add_uintmax_t_n(NULL, integers, 1),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_stats_add_float(NULL, 1),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_stats_add_float_n(NULL, values, 1),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_stats_add_n_error_on_values_is_null(void **state) {
+    struct seagrass_stats object;
+    assert_int_equal(seagrass_stats_init(&object), 0);
+    assert_int_equal(seagrass_stats_add_uintmax_t_n(&object, NULL, 1),
+                     SEAGRASS_STATS_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_stats_add_float_n(&object, NULL, 1),
+                     SEAGRASS_STATS_ERROR_VALUES_IS_NULL);
+    /* nothing to add */
+    assert_int_equal(seagrass_stats_add_uintmax_t_n(&object, NULL, 0), 0);
+    assert_int_equal(seagrass_stats_add_float_n(&object, NULL, 0), 0);
+    uintmax_t count;
+    assert_int_equal(seagrass_stats_count(&object, &count), 0);
+    assert_int_equal(count, 0);
+}
+
+static void check_stats_merge_error_on_object_is_null(void **state) {
+    struct seagrass_stats other;
+    assert_int_equal(seagrass_stats_init(&other), 0);
+    assert_int_equal(seagrass_stats_merge(NULL, &other),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_stats_merge_error_on_other_is_null(void **state) {
+    struct seagrass_stats object;
+    assert_int_equal(seagrass_stats_init(&object), 0);
+    assert_int_equal(seagrass_stats_merge(&object, NULL),
+                     SEAGRASS_STATS_ERROR_OTHER_IS_NULL);
+}
+
+static void check_stats_getters_error_on_object_is_null(void **state) {
+    uintmax_t count;
+    double out;
+    assert_int_equal(seagrass_stats_count(NULL, &count),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_stats_mean(NULL, &out),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_stats_variance(NULL, &out),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_stats_sample_variance(NULL, &out),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_stats_minimum(NULL, &out),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_stats_maximum(NULL, &out),
+                     SEAGRASS_STATS_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_stats_getters_error_on_out_is_null(void **state) {
+    struct seagrass_stats object;
+    assert_int_equal(seagrass_stats_init(&object), 0);
+    assert_int_equal(seagrass_stats_add_float(&object, 1), 0);
+    assert_int_equal(seagrass_stats_count(&object, NULL),
+                     SEAGRASS_STATS_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_stats_mean(&object, NULL),
+                     SEAGRASS_STATS_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_stats_variance(&object, NULL),
+                     SEAGRASS_STATS_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_stats_sample_variance(&object, NULL),
+                     SEAGRASS_STATS_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_stats_minimum(&object, NULL),
+                     SEAGRASS_STATS_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_stats_maximum(&object, NULL),
+                     SEAGRASS_STATS_ERROR_OUT_IS_NULL);
+}
+
+static void check_stats_getters_error_on_count_is_zero(void **state) {
+    struct seagrass_stats object;
+    assert_int_equal(seagrass_stats_init(&object), 0);
+    double out;
+    assert_int_equal(seagrass_stats_mean(&object, &out),
+                     SEAGRASS_STATS_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_stats_variance(&object, &out),
+                     SEAGRASS_STATS_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_stats_sample_variance(&object, &out),
+                     SEAGRASS_STATS_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_stats_minimum(&object, &out),
+                     SEAGRASS_STATS_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_stats_maximum(&object, &out),
+                     SEAGRASS_STATS_ERROR_COUNT_IS_ZERO);
+    /* the sample variance needs two samples */
+    assert_int_equal(seagrass_stats_add_uintmax_t(&object, 7), 0);
+    assert_int_equal(seagrass_stats_sample_variance(&object, &out),
+                     SEAGRASS_STATS_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_stats_variance(&object, &out), 0);
+    assert_true(0 == out);
+}
+
+static void check_stats_add_uintmax_t(void **state) {
+    struct seagrass_stats object;
+    assert_int_equal(seagrass_stats_init(&object), 0);
+    const uintmax_t values[] = {2, 4, 4, 4, 5, 5, 7, 9};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        assert_int_equal(seagrass_stats_add_uintmax_t(&object, values[i]), 0);
+    }
+    uintmax_t count;
+    double out;
+    assert_int_equal(seagrass_stats_count(&object, &count), 0);
+    assert_int_equal(count, 8);
+    assert_int_equal(seagrass_stats_mean(&object, &out), 0);
+    assert_true(5 == out);
+    assert_int_equal(seagrass_stats_variance(&object, &out), 0);
+    assert_true(4 == out);
+    assert_int_equal(seagrass_stats_sample_variance(&object, &out), 0);
+    assert_true(fabs(out - 32.0 / 7) < 1e-12);
+    assert_int_equal(seagrass_stats_minimum(&object, &out), 0);
+    assert_true(2 == out);
+    assert_int_equal(seagrass_stats_maximum(&object, &out), 0);
+    assert_true(9 == out);
+}
+
+static void check_stats_add_uintmax_t_n(void **state) {
+    uintmax_t *values = malloc(COUNT * sizeof(*values));
+    assert_non_null(values);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = (i * 2654435761u) % 1000003;
+    }
+    struct seagrass_stats scalar, batched;
+    assert_int_equal(seagrass_stats_init(&scalar), 0);
+    assert_int_equal(seagrass_stats_init(&batched), 0);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        assert_int_equal(seagrass_stats_add_uintmax_t(&scalar, values[i]), 0);
+    }
+    assert_int_equal(seagrass_stats_add_uintmax_t_n(&batched, values, COUNT),
+                     0);
+    assert_int_equal(batched.count, COUNT);
+    assert_true(fabs(batched.mean - scalar.mean) <= 1e-9 * scalar.mean);
+    assert_true(fabs(batched.m2 - scalar.m2) <= 1e-9 * scalar.m2);
+    assert_true(batched.minimum == scalar.minimum);
+    assert_true(batched.maximum == scalar.maximum);
+    free(values);
+}
+
+static void check_stats_add_float_n(void **state) {
+    float *values = malloc(COUNT * sizeof(*values));
+    assert_non_null(values);
+    /* a large offset against a small spread, which the sum of squares
+     * would have lost */
+    double sum = 0;
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = 1e6f + (float) ((i * 7919) % 101) / 16;
+        sum += values[i];
+    }
+    const double mean = sum / COUNT;
+    double m2 = 0;
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        m2 += (values[i] - mean) * (values[i] - mean);
+    }
+    struct seagrass_stats scalar, batched;
+    assert_int_equal(seagrass_stats_init(&scalar), 0);
+    assert_int_equal(seagrass_stats_init(&batched), 0);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        assert_int_equal(seagrass_stats_add_float(&scalar, values[i]), 0);
+    }
+    assert_int_equal(seagrass_stats_add_float_n(&batched, values, COUNT), 0);
+    double out;
+    assert_int_equal(seagrass_stats_mean(&scalar, &out), 0);
+    assert_true(fabs(out - mean) <= 1e-12 * mean);
+    assert_int_equal(seagrass_stats_mean(&batched, &out), 0);
+    assert_true(fabs(out - mean) <= 1e-12 * mean);
+    assert_true(fabs(scalar.m2 - m2) <= 1e-9 * m2);
+    assert_true(fabs(batched.m2 - m2) <= 1e-9 * m2);
+    assert_int_equal(seagrass_stats_minimum(&batched, &out), 0);
+    assert_true(1e6 == out);
+    assert_int_equal(seagrass_stats_maximum(&batched, &out), 0);
+    assert_true(1e6 + 100.0 / 16 == out);
+    free(values);
+}
+
+static void check_stats_merge(void **state) {
+    float *values = malloc(COUNT * sizeof(*values));
+    assert_non_null(values);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = (float) ((i * 7919) % 1009) - 300;
+    }
+    struct seagrass_stats whole, parts[3], merged;
+    assert_int_equal(seagrass_stats_init(&whole), 0);
+    assert_int_equal(seagrass_stats_add_float_n(&whole, values, COUNT), 0);
+    const uintmax_t bounds[] = {0, 17, 6000, COUNT};
+    assert_int_equal(seagrass_stats_init(&merged), 0);
+    for (size_t i = 0; i < 3; i++) {
+        assert_int_equal(seagrass_stats_init(&parts[i]), 0);
+        assert_int_equal(
+                seagrass_stats_add_float_n(&parts[i], values + bounds[i],
+                                           bounds[i + 1] - bounds[i]),
+                0);
+        assert_int_equal(seagrass_stats_merge(&merged, &parts[i]), 0);
+    }
+    /* merging an empty accumulator changes nothing */
+    struct seagrass_stats empty;
+    assert_int_equal(seagrass_stats_init(&empty), 0);
+    assert_int_equal(seagrass_stats_merge(&merged, &empty), 0);
+    assert_int_equal(merged.count, COUNT);
+    assert_true(fabs(merged.mean - whole.mean) <= 1e-9 * fabs(whole.mean));
+    assert_true(fabs(merged.m2 - whole.m2) <= 1e-9 * whole.m2);
+    assert_true(merged.minimum == whole.minimum);
+    assert_true(merged.maximum == whole.maximum);
+    assert_true(-300 == whole.minimum);
+    assert_true(708 == whole.maximum);
+    free(values);
+}
+
+static void check_stats_add_float_error_on_not_finite(void **state) {
+    struct seagrass_stats object;
+    assert_int_equal(seagrass_stats_init(&object), 0);
+    float values[] = {1, 2, 3, 4};
+    assert_int_equal(seagrass_stats_add_float_n(&object, values, 4), 0);
+    const struct seagrass_stats before = object;
+    assert_int_equal(seagrass_stats_add_float(&object, NAN),
+                     SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_stats_add_float(&object, -INFINITY),
+                     SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT);
+    assert_memory_equal(&object, &before, sizeof(object));
+    float *large = malloc(COUNT * sizeof(*large));
+    assert_non_null(large);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        large[i] = (float) i;
+    }
+    /* found in a later block after earlier ones have been summarized */
+    large[COUNT - 1] = NAN;
+    assert_int_equal(seagrass_stats_add_float_n(&object, large, COUNT),
+                     SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT);
+    assert_memory_equal(&object, &before, sizeof(object));
+    large[COUNT - 1] = INFINITY;
+    assert_int_equal(seagrass_stats_add_float_n(&object, large, COUNT),
+                     SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT);
+    assert_memory_equal(&object, &before, sizeof(object));
+    free(large);
+}
+
+static void check_stats_error_on_count_overflow(void **state) {
+    struct seagrass_stats object;
+    assert_int_equal(seagrass_stats_init(&object), 0);
+    assert_int_equal(seagrass_stats_add_uintmax_t(&object, 1), 0);
+    object.count = UINTMAX_MAX;
+    const struct seagrass_stats before = object;
+    const float values[] = {1, 2};
+    const uintmax_t integers[] = {1, 2};
+    assert_int_equal(seagrass_stats_add_uintmax_t(&object, 1),
+                     SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_stats_add_uintmax_t_n(&object, integers, 2),
+                     SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_stats_add_float(&object, 1),
+                     SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(seagrass_stats_add_float_n(&object, values, 2),
+                     SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT);
+    struct seagrass_stats other;
+    assert_int_equal(seagrass_stats_init(&other), 0);
+    assert_int_equal(seagrass_stats_add_float(&other, 1), 0);
+    assert_int_equal(seagrass_stats_merge(&object, &other),
+                     SEAGRASS_STATS_ERROR_RESULT_IS_INCONSISTENT);
+    assert_memory_equal(&object, &before, sizeof(object));
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_stats_init_error_on_object_is_null),
+            cmocka_unit_test(check_stats_init),
+            cmocka_unit_test(check_stats_add_error_on_object_is_null),
+            cmocka_unit_test(check_stats_add_n_error_on_values_is_null),
+            cmocka_unit_test(check_stats_merge_error_on_object_is_null),
+            cmocka_unit_test(check_stats_merge_error_on_other_is_null),
+            cmocka_unit_test(check_stats_getters_error_on_object_is_null),
+            cmocka_unit_test(check_stats_getters_error_on_out_is_null),
+            cmocka_unit_test(check_stats_getters_error_on_count_is_zero),
+            cmocka_unit_test(check_stats_add_uintmax_t),
+            cmocka_unit_test(check_stats_add_uintmax_t_n),
+            cmocka_unit_test(check_stats_add_float_n),
+            cmocka_unit_test(check_stats_merge),
+            cmocka_unit_test(check_stats_add_float_error_on_not_finite),
+            cmocka_unit_test(check_stats_error_on_count_overflow),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
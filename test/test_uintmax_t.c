@@ -213,6 +213,206 @@ static void check_uintmax_t_times_and_a_half_even(void **state) {
                 seagrass_uintmax_t_times_and_a_half_even(p.in, &out), 0);
         assert_int_equal(p.out, out);
     }
+    uintmax_t out;
+    assert_int_equal(
+            seagrass_uintmax_t_times_and_a_half_even(UINTMAX_MAX, &out), 0);
+    assert_int_equal(UINTMAX_MAX, out);
+}
+
+static void check_uintmax_t_const(void **state) {
+    /* usable wherever an integer constant expression is required */
+    static char buffer[SEAGRASS_UINTMAX_T_CONST_MUL(16, 4)];
+    _Static_assert(SEAGRASS_UINTMAX_T_CONST_ADD(UINTMAX_MAX - 1, 1)
+                   == UINTMAX_MAX, "add");
+    _Static_assert(SEAGRASS_UINTMAX_T_CONST_SUB(3, 3) == 0, "subtract");
+    _Static_assert(SEAGRASS_UINTMAX_T_CONST_MUL(UINTMAX_MAX, 1)
+                   == UINTMAX_MAX, "multiply");
+    _Static_assert(SEAGRASS_UINTMAX_T_CONST_MUL(UINTMAX_MAX, 0) == 0,
+                   "multiply");
+    _Static_assert(SEAGRASS_UINTMAX_T_CONST_DIV(22, 5) == 4, "divide");
+    assert_int_equal(64, sizeof(buffer));
+    enum {
+        SIZE = SEAGRASS_UINTMAX_T_CONST_ADD(60, 4)
+    };
+    assert_int_equal(SIZE, sizeof(buffer));
+}
+
+static void check_uintmax_t_extremes_n_error_on_values_is_null(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_minimum_n(NULL, 1, &out, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_uintmax_t_maximum_n(NULL, 1, &out, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL);
+    assert_int_equal(seagrass_uintmax_t_minmax_n(NULL, 1, &out, NULL,
+                                                 &out, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL);
+}
+
+static void check_uintmax_t_extremes_n_error_on_count_is_zero(void **state) {
+    const uintmax_t values[] = {1};
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_minimum_n(values, 0, &out, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_uintmax_t_maximum_n(values, 0, &out, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO);
+    assert_int_equal(seagrass_uintmax_t_minmax_n(values, 0, &out, NULL,
+                                                 &out, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_COUNT_IS_ZERO);
+}
+
+static void check_uintmax_t_extremes_n_error_on_out_is_null(void **state) {
+    const uintmax_t values[] = {1};
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_minimum_n(values, 1, NULL, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_uintmax_t_maximum_n(values, 1, NULL, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_uintmax_t_minmax_n(values, 1, NULL, NULL,
+                                                 &out, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+    assert_int_equal(seagrass_uintmax_t_minmax_n(values, 1, &out, NULL,
+                                                 NULL, NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_extremes_n(void **state) {
+    enum {
+        COUNT = 2500
+    };
+    static uintmax_t values[COUNT];
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        values[i] = (i * 2654435761u) % 1000003 + 2;
+    }
+    /* repeated extremes in different blocks and lanes */
+    values[1500] = values[2100] = 1;
+    values[1700] = values[2400] = UINTMAX_MAX;
+    for (uintmax_t count = 1; count <= COUNT; count += 37) {
+        uintmax_t low = 0, high = 0;
+        for (uintmax_t i = 1; i < count; i++) {
+            low = values[i] < values[low] ? i : low;
+            high = values[i] > values[high] ? i : high;
+        }
+        uintmax_t out, index;
+        assert_int_equal(
+                seagrass_uintmax_t_minimum_n(values, count, &out, &index), 0);
+        assert_int_equal(out, values[low]);
+        assert_int_equal(index, low);
+        assert_int_equal(
+                seagrass_uintmax_t_maximum_n(values, count, &out, &index), 0);
+        assert_int_equal(out, values[high]);
+        assert_int_equal(index, high);
+        uintmax_t minimum, minimum_index, maximum, maximum_index;
+        assert_int_equal(
+                seagrass_uintmax_t_minmax_n(values, count,
+                                            &minimum, &minimum_index,
+                                            &maximum, &maximum_index), 0);
+        assert_int_equal(minimum, values[low]);
+        assert_int_equal(minimum_index, low);
+        assert_int_equal(maximum, values[high]);
+        assert_int_equal(maximum_index, high);
+    }
+}
+
+static void check_uintmax_t_find_out_of_range_n_error_on_values_is_null(
+        void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_find_out_of_range_n(NULL, 1, 0, 1,
+                                                            &out),
+                     SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL);
+}
+
+static void check_uintmax_t_find_out_of_range_n_error_on_out_is_null(
+        void **state) {
+    const uintmax_t values[] = {1};
+    assert_int_equal(seagrass_uintmax_t_find_out_of_range_n(values, 1, 0, 1,
+                                                            NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_find_out_of_range_n_error_on_range_is_invalid(
+        void **state) {
+    const uintmax_t values[] = {1};
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_find_out_of_range_n(values, 1, 2, 1,
+                                                            &out),
+                     SEAGRASS_UINTMAX_T_ERROR_RANGE_IS_INVALID);
+}
+
+static void check_uintmax_t_find_out_of_range_n(void **state) {
+    const uintmax_t count = 3000;
+    uintmax_t *values = malloc(count * sizeof(*values));
+    assert_non_null(values);
+    for (uintmax_t i = 0; i < count; i++) {
+        values[i] = 10 + i % 90;
+    }
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_find_out_of_range_n(
+            values, count, 10, 99, &out), 0);
+    assert_int_equal(out, count);
+    assert_int_equal(seagrass_uintmax_t_find_out_of_range_n(
+            values, count, 10, 98, &out), 0);
+    assert_int_equal(out, 89);
+    for (uintmax_t i = 1020; i < 1060; i++) {
+        const uintmax_t value = values[i];
+        values[i] = i & 1 ? 9 : UINTMAX_MAX;
+        values[i + 1500] = 0;
+        assert_int_equal(seagrass_uintmax_t_find_out_of_range_n(
+                values, count, 10, 99, &out), 0);
+        assert_int_equal(out, i);
+        values[i] = value;
+        values[i + 1500] = value;
+    }
+    assert_int_equal(seagrass_uintmax_t_find_out_of_range_n(
+            values, count, 0, UINTMAX_MAX, &out), 0);
+    assert_int_equal(out, count);
+    assert_int_equal(seagrass_uintmax_t_find_out_of_range_n(
+            NULL, 0, 0, 0, &out), 0);
+    assert_int_equal(out, 0);
+    free(values);
+}
+
+static void check_uintmax_t_out_of_range_mask_n_error_on_values_is_null(
+        void **state) {
+    uint64_t out;
+    assert_int_equal(seagrass_uintmax_t_out_of_range_mask_n(NULL, 1, 0, 1,
+                                                            &out),
+                     SEAGRASS_UINTMAX_T_ERROR_VALUES_IS_NULL);
+}
+
+static void check_uintmax_t_out_of_range_mask_n_error_on_out_is_null(
+        void **state) {
+    const uintmax_t values[] = {1};
+    assert_int_equal(seagrass_uintmax_t_out_of_range_mask_n(values, 1, 0, 1,
+                                                            NULL),
+                     SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_out_of_range_mask_n_error_on_range_is_invalid(
+        void **state) {
+    const uintmax_t values[] = {1};
+    uint64_t out;
+    assert_int_equal(seagrass_uintmax_t_out_of_range_mask_n(values, 1, 2, 1,
+                                                            &out),
+                     SEAGRASS_UINTMAX_T_ERROR_RANGE_IS_INVALID);
+}
+
+static void check_uintmax_t_out_of_range_mask_n(void **state) {
+    uintmax_t values[70];
+    for (uintmax_t i = 0; i < 70; i++) {
+        values[i] = i;
+    }
+    values[68] = UINTMAX_MAX;
+    uint64_t out[2];
+    assert_int_equal(seagrass_uintmax_t_out_of_range_mask_n(
+            values, 70, 3, 65, out), 0);
+    assert_true(UINT64_C(7) == out[0]);
+    assert_true(UINT64_C(0x3c) == out[1]);
+    assert_int_equal(seagrass_uintmax_t_out_of_range_mask_n(
+            values, 70, 0, UINTMAX_MAX, out), 0);
+    assert_true(0 == out[0]);
+    assert_true(0 == out[1]);
+    assert_int_equal(seagrass_uintmax_t_out_of_range_mask_n(
+            NULL, 0, 0, 0, NULL), 0);
 }
 
 int main(int argc, char *argv[]) {
@@ -237,6 +437,19 @@ int main(int argc, char *argv[]) {
             cmocka_unit_test(check_uintmax_t_divide),
             cmocka_unit_test(check_uintmax_t_times_and_a_half_even_error_on_out_is_null),
             cmocka_unit_test(check_uintmax_t_times_and_a_half_even),
+            cmocka_unit_test(check_uintmax_t_const),
+            cmocka_unit_test(check_uintmax_t_extremes_n_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_extremes_n_error_on_count_is_zero),
+            cmocka_unit_test(check_uintmax_t_extremes_n_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_extremes_n),
+            cmocka_unit_test(check_uintmax_t_find_out_of_range_n_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_find_out_of_range_n_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_find_out_of_range_n_error_on_range_is_invalid),
+            cmocka_unit_test(check_uintmax_t_find_out_of_range_n),
+            cmocka_unit_test(check_uintmax_t_out_of_range_mask_n_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_out_of_range_mask_n_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_out_of_range_mask_n_error_on_range_is_invalid),
+            cmocka_unit_test(check_uintmax_t_out_of_range_mask_n),
     };
     //cmocka_set_message_output(CM_OUTPUT_XML);
     return cmocka_run_group_tests(tests, NULL, NULL);
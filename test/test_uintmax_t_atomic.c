@@ -0,0 +1,179 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+#define THREADS 4
+#define COUNT 100000
+
+static void check_uintmax_t_atomic_error_on_object_is_null(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_atomic_add(NULL, 1, &out),
+                     SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_uintmax_t_atomic_subtract(NULL, 1, &out),
+                     SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL);
+    assert_int_equal(seagrass_uintmax_t_atomic_multiply(NULL, 2, &out),
+                     SEAGRASS_UINTMAX_T_ATOMIC_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_uintmax_t_atomic_add(void **state) {
+    atomic_uintmax_t object = 5;
+    uintmax_t out = 0;
+    assert_int_equal(seagrass_uintmax_t_atomic_add(&object, 3, &out), 0);
+    assert_int_equal(out, 8);
+    assert_int_equal(seagrass_uintmax_t_atomic_add(&object, 0, &out), 0);
+    assert_int_equal(out, 8);
+    assert_int_equal(seagrass_uintmax_t_atomic_add(&object, 2, NULL), 0);
+    assert_int_equal(atomic_load(&object), 10);
+    assert_int_equal(
+            seagrass_uintmax_t_atomic_add(&object, UINTMAX_MAX - 10, &out), 0);
+    assert_int_equal(out, UINTMAX_MAX);
+}
+
+static void check_uintmax_t_atomic_add_error_on_overflow(void **state) {
+    atomic_uintmax_t object = UINTMAX_MAX - 1;
+    uintmax_t out = 7;
+    assert_int_equal(seagrass_uintmax_t_atomic_add(&object, 2, &out),
+                     SEAGRASS_UINTMAX_T_ATOMIC_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(atomic_load(&object), UINTMAX_MAX - 1);
+    assert_int_equal(out, 7);
+}
+
+static void check_uintmax_t_atomic_subtract(void **state) {
+    atomic_uintmax_t object = 10;
+    uintmax_t out = 0;
+    assert_int_equal(seagrass_uintmax_t_atomic_subtract(&object, 3, &out), 0);
+    assert_int_equal(out, 7);
+    assert_int_equal(seagrass_uintmax_t_atomic_subtract(&object, 0, &out), 0);
+    assert_int_equal(out, 7);
+    assert_int_equal(seagrass_uintmax_t_atomic_subtract(&object, 7, NULL), 0);
+    assert_int_equal(atomic_load(&object), 0);
+}
+
+static void check_uintmax_t_atomic_subtract_error_on_underflow(void **state) {
+    atomic_uintmax_t object = 3;
+    uintmax_t out = 7;
+    assert_int_equal(seagrass_uintmax_t_atomic_subtract(&object, 4, &out),
+                     SEAGRASS_UINTMAX_T_ATOMIC_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(atomic_load(&object), 3);
+    assert_int_equal(out, 7);
+}
+
+static void check_uintmax_t_atomic_multiply(void **state) {
+    atomic_uintmax_t object = 3;
+    uintmax_t out = 0;
+    assert_int_equal(seagrass_uintmax_t_atomic_multiply(&object, 5, &out), 0);
+    assert_int_equal(out, 15);
+    assert_int_equal(seagrass_uintmax_t_atomic_multiply(&object, 1, &out), 0);
+    assert_int_equal(out, 15);
+    assert_int_equal(seagrass_uintmax_t_atomic_multiply(&object, 0, &out), 0);
+    assert_int_equal(out, 0);
+    assert_int_equal(atomic_load(&object), 0);
+    /* zero times anything is zero */
+    assert_int_equal(
+            seagrass_uintmax_t_atomic_multiply(&object, UINTMAX_MAX, NULL),
+            0);
+    assert_int_equal(atomic_load(&object), 0);
+}
+
+static void check_uintmax_t_atomic_multiply_error_on_overflow(void **state) {
+    atomic_uintmax_t object = UINTMAX_MAX / 2 + 1;
+    uintmax_t out = 7;
+    assert_int_equal(seagrass_uintmax_t_atomic_multiply(&object, 2, &out),
+                     SEAGRASS_UINTMAX_T_ATOMIC_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(atomic_load(&object), UINTMAX_MAX / 2 + 1);
+    assert_int_equal(out, 7);
+}
+
+static void *add(void *const argument) {
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        seagrass_required_true(
+                !seagrass_uintmax_t_atomic_add(argument, 1, NULL));
+    }
+    return NULL;
+}
+
+struct spender {
+    atomic_uintmax_t *budget;
+    uintmax_t spent;
+};
+
+/* Take from the budget until it is exhausted. */
+static void *spend(void *const argument) {
+    struct spender *const spender = argument;
+    while (!seagrass_uintmax_t_atomic_subtract(spender->budget, 1, NULL)) {
+        spender->spent++;
+    }
+    return NULL;
+}
+
+static void *double_up(void *const argument) {
+    struct spender *const spender = argument;
+    while (!seagrass_uintmax_t_atomic_multiply(spender->budget, 2, NULL)) {
+        spender->spent++;
+    }
+    return NULL;
+}
+
+static void check_uintmax_t_atomic_concurrently(void **state) {
+    pthread_t threads[THREADS];
+    atomic_uintmax_t object = 0;
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        assert_int_equal(pthread_create(&threads[i], NULL, add, &object), 0);
+    }
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        assert_int_equal(pthread_join(threads[i], NULL), 0);
+    }
+    assert_int_equal(atomic_load(&object), THREADS * COUNT);
+    /* the budget is handed out exactly once */
+    struct spender spenders[THREADS];
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        spenders[i] = (struct spender) {&object, 0};
+        assert_int_equal(pthread_create(&threads[i], NULL, spend,
+                                        &spenders[i]), 0);
+    }
+    uintmax_t spent = 0;
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        assert_int_equal(pthread_join(threads[i], NULL), 0);
+        spent += spenders[i].spent;
+    }
+    assert_int_equal(spent, THREADS * COUNT);
+    assert_int_equal(atomic_load(&object), 0);
+    /* doubling stops right before the product overflows */
+    atomic_store(&object, 1);
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        spenders[i] = (struct spender) {&object, 0};
+        assert_int_equal(pthread_create(&threads[i], NULL, double_up,
+                                        &spenders[i]), 0);
+    }
+    spent = 0;
+    for (uintmax_t i = 0; i < THREADS; i++) {
+        assert_int_equal(pthread_join(threads[i], NULL), 0);
+        spent += spenders[i].spent;
+    }
+    assert_int_equal(spent, sizeof(uintmax_t) * 8 - 1);
+    assert_int_equal(atomic_load(&object), UINTMAX_MAX / 2 + 1);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_uintmax_t_atomic_error_on_object_is_null),
+            cmocka_unit_test(check_uintmax_t_atomic_add),
+            cmocka_unit_test(check_uintmax_t_atomic_add_error_on_overflow),
+            cmocka_unit_test(check_uintmax_t_atomic_subtract),
+            cmocka_unit_test(
+                    check_uintmax_t_atomic_subtract_error_on_underflow),
+            cmocka_unit_test(check_uintmax_t_atomic_multiply),
+            cmocka_unit_test(
+                    check_uintmax_t_atomic_multiply_error_on_overflow),
+            cmocka_unit_test(check_uintmax_t_atomic_concurrently),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,301 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+#include <limits.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+#define WIDTH (sizeof(uintmax_t) * CHAR_BIT)
+#define TOP ((UINTMAX_MAX >> 1) + 1)
+
+static void check_uintmax_t_is_power_of_two_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_is_power_of_two(1, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_is_power_of_two(void **state) {
+    bool result;
+    assert_int_equal(seagrass_uintmax_t_is_power_of_two(0, &result), 0);
+    assert_false(result);
+    assert_int_equal(seagrass_uintmax_t_is_power_of_two(1, &result), 0);
+    assert_true(result);
+    assert_int_equal(seagrass_uintmax_t_is_power_of_two(6, &result), 0);
+    assert_false(result);
+    assert_int_equal(seagrass_uintmax_t_is_power_of_two(TOP, &result), 0);
+    assert_true(result);
+}
+
+static void
+check_uintmax_t_next_power_of_two_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_next_power_of_two(1, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_uintmax_t_next_power_of_two_error_on_result_is_inconsistent(
+        void **state) {
+    uintmax_t out;
+    assert_int_equal(
+            seagrass_uintmax_t_next_power_of_two(TOP + 1, &out),
+            SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_uintmax_t_next_power_of_two(UINTMAX_MAX, &out),
+            SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_uintmax_t_next_power_of_two(void **state) {
+    const uintmax_t pairs[][2] = {
+            {0, 1}, {1, 1}, {2, 2}, {3, 4}, {5, 8}, {8, 8}, {1000, 1024},
+            {TOP - 1, TOP}, {TOP, TOP}
+    };
+    for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+        uintmax_t out;
+        assert_int_equal(
+                seagrass_uintmax_t_next_power_of_two(pairs[i][0], &out), 0);
+        assert_int_equal(pairs[i][1], out);
+    }
+}
+
+static void check_uintmax_t_floor_log2_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_floor_log2(1, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_floor_log2_error_on_value_is_invalid(void **state) {
+    uintmax_t out;
+    assert_int_equal(
+            seagrass_uintmax_t_floor_log2(0, &out),
+            SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID);
+}
+
+static void check_uintmax_t_floor_log2(void **state) {
+    const uintmax_t pairs[][2] = {
+            {1, 0}, {2, 1}, {3, 1}, {4, 2}, {1023, 9}, {1024, 10},
+            {UINTMAX_MAX, WIDTH - 1}
+    };
+    for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+        uintmax_t out;
+        assert_int_equal(seagrass_uintmax_t_floor_log2(pairs[i][0], &out), 0);
+        assert_int_equal(pairs[i][1], out);
+    }
+}
+
+static void check_uintmax_t_ceil_log2_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_ceil_log2(1, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_ceil_log2_error_on_value_is_invalid(void **state) {
+    uintmax_t out;
+    assert_int_equal(
+            seagrass_uintmax_t_ceil_log2(0, &out),
+            SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID);
+}
+
+static void check_uintmax_t_ceil_log2(void **state) {
+    const uintmax_t pairs[][2] = {
+            {1, 0}, {2, 1}, {3, 2}, {4, 2}, {1023, 10}, {1024, 10},
+            {1025, 11}, {TOP, WIDTH - 1}, {UINTMAX_MAX, WIDTH}
+    };
+    for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+        uintmax_t out;
+        assert_int_equal(seagrass_uintmax_t_ceil_log2(pairs[i][0], &out), 0);
+        assert_int_equal(pairs[i][1], out);
+    }
+}
+
+static void check_uintmax_t_popcount_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_popcount(1, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_popcount(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_popcount(0, &out), 0);
+    assert_int_equal(0, out);
+    assert_int_equal(seagrass_uintmax_t_popcount(0xF0F0, &out), 0);
+    assert_int_equal(8, out);
+    assert_int_equal(seagrass_uintmax_t_popcount(UINTMAX_MAX, &out), 0);
+    assert_int_equal(WIDTH, out);
+}
+
+static void
+check_uintmax_t_count_leading_zeros_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_count_leading_zeros(1, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_count_leading_zeros(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_count_leading_zeros(0, &out), 0);
+    assert_int_equal(WIDTH, out);
+    assert_int_equal(seagrass_uintmax_t_count_leading_zeros(1, &out), 0);
+    assert_int_equal(WIDTH - 1, out);
+    assert_int_equal(seagrass_uintmax_t_count_leading_zeros(TOP, &out), 0);
+    assert_int_equal(0, out);
+}
+
+static void
+check_uintmax_t_count_trailing_zeros_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_count_trailing_zeros(1, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_count_trailing_zeros(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_count_trailing_zeros(0, &out), 0);
+    assert_int_equal(WIDTH, out);
+    assert_int_equal(seagrass_uintmax_t_count_trailing_zeros(1, &out), 0);
+    assert_int_equal(0, out);
+    assert_int_equal(seagrass_uintmax_t_count_trailing_zeros(96, &out), 0);
+    assert_int_equal(5, out);
+    assert_int_equal(seagrass_uintmax_t_count_trailing_zeros(TOP, &out), 0);
+    assert_int_equal(WIDTH - 1, out);
+}
+
+static void check_uintmax_t_align_up_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_align_up(1, 8, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_align_up_error_on_value_is_invalid(void **state) {
+    uintmax_t out;
+    assert_int_equal(
+            seagrass_uintmax_t_align_up(1, 0, &out),
+            SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID);
+    assert_int_equal(
+            seagrass_uintmax_t_align_up(1, 12, &out),
+            SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID);
+}
+
+static void
+check_uintmax_t_align_up_error_on_result_is_inconsistent(void **state) {
+    uintmax_t out;
+    assert_int_equal(
+            seagrass_uintmax_t_align_up(UINTMAX_MAX - 6, 8, &out),
+            SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_uintmax_t_align_up(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_align_up(0, 8, &out), 0);
+    assert_int_equal(0, out);
+    assert_int_equal(seagrass_uintmax_t_align_up(1, 8, &out), 0);
+    assert_int_equal(8, out);
+    assert_int_equal(seagrass_uintmax_t_align_up(8, 8, &out), 0);
+    assert_int_equal(8, out);
+    assert_int_equal(seagrass_uintmax_t_align_up(UINTMAX_MAX - 7, 8, &out),
+                     0);
+    assert_int_equal(UINTMAX_MAX - 7, out);
+    assert_int_equal(seagrass_uintmax_t_align_up(UINTMAX_MAX, 1, &out), 0);
+    assert_int_equal(UINTMAX_MAX, out);
+}
+
+static void check_uintmax_t_align_down_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_align_down(1, 8, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_uintmax_t_align_down_error_on_value_is_invalid(void **state) {
+    uintmax_t out;
+    assert_int_equal(
+            seagrass_uintmax_t_align_down(1, 3, &out),
+            SEAGRASS_UINTMAX_T_ERROR_VALUE_IS_INVALID);
+}
+
+static void check_uintmax_t_align_down(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_align_down(7, 8, &out), 0);
+    assert_int_equal(0, out);
+    assert_int_equal(seagrass_uintmax_t_align_down(17, 8, &out), 0);
+    assert_int_equal(16, out);
+    assert_int_equal(seagrass_uintmax_t_align_down(UINTMAX_MAX, TOP, &out),
+                     0);
+    assert_int_equal(TOP, out);
+}
+
+static void check_uintmax_t_power_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_power(2, 2, NULL),
+            SEAGRASS_UINTMAX_T_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_uintmax_t_power_error_on_result_is_inconsistent(void **state) {
+    uintmax_t out;
+    assert_int_equal(
+            seagrass_uintmax_t_power(2, WIDTH, &out),
+            SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_uintmax_t_power(3, WIDTH, &out),
+            SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_uintmax_t_power(UINTMAX_MAX, 2, &out),
+            SEAGRASS_UINTMAX_T_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_uintmax_t_power(void **state) {
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_power(0, 0, &out), 0);
+    assert_int_equal(1, out);
+    assert_int_equal(seagrass_uintmax_t_power(0, 5, &out), 0);
+    assert_int_equal(0, out);
+    assert_int_equal(seagrass_uintmax_t_power(1, UINTMAX_MAX, &out), 0);
+    assert_int_equal(1, out);
+    assert_int_equal(seagrass_uintmax_t_power(3, 4, &out), 0);
+    assert_int_equal(81, out);
+    assert_int_equal(seagrass_uintmax_t_power(10, 9, &out), 0);
+    assert_int_equal(1000000000, out);
+    assert_int_equal(seagrass_uintmax_t_power(2, WIDTH - 1, &out), 0);
+    assert_int_equal(TOP, out);
+    assert_int_equal(seagrass_uintmax_t_power(UINTMAX_MAX, 1, &out), 0);
+    assert_int_equal(UINTMAX_MAX, out);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_uintmax_t_is_power_of_two_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_is_power_of_two),
+            cmocka_unit_test(check_uintmax_t_next_power_of_two_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_next_power_of_two_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_uintmax_t_next_power_of_two),
+            cmocka_unit_test(check_uintmax_t_floor_log2_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_floor_log2_error_on_value_is_invalid),
+            cmocka_unit_test(check_uintmax_t_floor_log2),
+            cmocka_unit_test(check_uintmax_t_ceil_log2_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_ceil_log2_error_on_value_is_invalid),
+            cmocka_unit_test(check_uintmax_t_ceil_log2),
+            cmocka_unit_test(check_uintmax_t_popcount_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_popcount),
+            cmocka_unit_test(check_uintmax_t_count_leading_zeros_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_count_leading_zeros),
+            cmocka_unit_test(check_uintmax_t_count_trailing_zeros_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_count_trailing_zeros),
+            cmocka_unit_test(check_uintmax_t_align_up_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_align_up_error_on_value_is_invalid),
+            cmocka_unit_test(check_uintmax_t_align_up_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_uintmax_t_align_up),
+            cmocka_unit_test(check_uintmax_t_align_down_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_align_down_error_on_value_is_invalid),
+            cmocka_unit_test(check_uintmax_t_align_down),
+            cmocka_unit_test(check_uintmax_t_power_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_power_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_uintmax_t_power),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
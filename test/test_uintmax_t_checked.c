@@ -0,0 +1,204 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+static void check_uintmax_t_checked_init(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 42);
+    assert_int_equal(42, object.value);
+    assert_false(object.overflow);
+}
+
+static void check_uintmax_t_checked_add(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 1);
+    seagrass_uintmax_t_checked_add(&object, 2);
+    assert_int_equal(3, object.value);
+    assert_false(object.overflow);
+    seagrass_uintmax_t_checked_add(&object, UINTMAX_MAX);
+    assert_true(object.overflow);
+    /* sticky */
+    seagrass_uintmax_t_checked_subtract(&object, 2);
+    assert_true(object.overflow);
+}
+
+static void check_uintmax_t_checked_subtract(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 10);
+    seagrass_uintmax_t_checked_subtract(&object, 10);
+    assert_int_equal(0, object.value);
+    assert_false(object.overflow);
+    seagrass_uintmax_t_checked_subtract(&object, 1);
+    assert_true(object.overflow);
+}
+
+static void check_uintmax_t_checked_multiply(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 3);
+    seagrass_uintmax_t_checked_multiply(&object, 7);
+    assert_int_equal(21, object.value);
+    assert_false(object.overflow);
+    seagrass_uintmax_t_checked_multiply(&object, UINTMAX_MAX);
+    assert_true(object.overflow);
+    /* sticky */
+    seagrass_uintmax_t_checked_multiply(&object, 0);
+    assert_true(object.overflow);
+}
+
+static void check_uintmax_t_checked_merge(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    struct seagrass_uintmax_t_checked other;
+    seagrass_uintmax_t_checked_init(&object, 3);
+    seagrass_uintmax_t_checked_init(&other, 4);
+    seagrass_uintmax_t_checked_merge(&object, &other);
+    assert_int_equal(7, object.value);
+    assert_false(object.overflow);
+    other.overflow = true;
+    seagrass_uintmax_t_checked_merge(&object, &other);
+    assert_true(object.overflow);
+}
+
+static void check_uintmax_t_checked_get_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_checked_get(NULL, (void *) 1),
+            SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_uintmax_t_checked_get_error_on_out_is_null(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 0);
+    assert_int_equal(
+            seagrass_uintmax_t_checked_get(&object, NULL),
+            SEAGRASS_UINTMAX_T_CHECKED_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_uintmax_t_checked_get_error_on_result_is_inconsistent(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, UINTMAX_MAX);
+    seagrass_uintmax_t_checked_add(&object, 1);
+    uintmax_t out;
+    assert_int_equal(
+            seagrass_uintmax_t_checked_get(&object, &out),
+            SEAGRASS_UINTMAX_T_CHECKED_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_uintmax_t_checked_get(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 12);
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_checked_get(&object, &out), 0);
+    assert_int_equal(12, out);
+}
+
+static void check_uintmax_t_checked_sum_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_checked_sum(NULL, (void *) 1, 1),
+            SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_uintmax_t_checked_sum_error_on_values_is_null(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 0);
+    assert_int_equal(
+            seagrass_uintmax_t_checked_sum(&object, NULL, 1),
+            SEAGRASS_UINTMAX_T_CHECKED_ERROR_VALUES_IS_NULL);
+}
+
+static void check_uintmax_t_checked_sum(void **state) {
+    uintmax_t values[37];
+    uintmax_t expected = 5;
+    for (uintmax_t i = 0; i < 37; i++) {
+        values[i] = i * 3;
+        expected += values[i];
+    }
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 5);
+    assert_int_equal(seagrass_uintmax_t_checked_sum(&object, values, 37), 0);
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_checked_get(&object, &out), 0);
+    assert_int_equal(expected, out);
+    assert_int_equal(seagrass_uintmax_t_checked_sum(&object, NULL, 0), 0);
+    assert_int_equal(seagrass_uintmax_t_checked_get(&object, &out), 0);
+    assert_int_equal(expected, out);
+}
+
+static void check_uintmax_t_checked_sum_overflow(void **state) {
+    uintmax_t values[16] = {0};
+    values[3] = UINTMAX_MAX / 2;
+    values[11] = UINTMAX_MAX / 2;
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 1);
+    assert_int_equal(seagrass_uintmax_t_checked_sum(&object, values, 16), 0);
+    assert_false(object.overflow);
+    assert_int_equal(UINTMAX_MAX, object.value);
+    seagrass_uintmax_t_checked_init(&object, 2);
+    assert_int_equal(seagrass_uintmax_t_checked_sum(&object, values, 16), 0);
+    assert_true(object.overflow);
+    values[3] = UINTMAX_MAX;
+    values[11] = UINTMAX_MAX;
+    seagrass_uintmax_t_checked_init(&object, 0);
+    assert_int_equal(seagrass_uintmax_t_checked_sum(&object, values, 16), 0);
+    assert_true(object.overflow);
+}
+
+static void
+check_uintmax_t_checked_product_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_checked_product(NULL, (void *) 1, 1),
+            SEAGRASS_UINTMAX_T_CHECKED_ERROR_OBJECT_IS_NULL);
+}
+
+static void
+check_uintmax_t_checked_product_error_on_values_is_null(void **state) {
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 1);
+    assert_int_equal(
+            seagrass_uintmax_t_checked_product(&object, NULL, 1),
+            SEAGRASS_UINTMAX_T_CHECKED_ERROR_VALUES_IS_NULL);
+}
+
+static void check_uintmax_t_checked_product(void **state) {
+    const uintmax_t values[] = {2, 3, 5, 7};
+    struct seagrass_uintmax_t_checked object;
+    seagrass_uintmax_t_checked_init(&object, 1);
+    assert_int_equal(seagrass_uintmax_t_checked_product(&object, values, 4), 0);
+    uintmax_t out;
+    assert_int_equal(seagrass_uintmax_t_checked_get(&object, &out), 0);
+    assert_int_equal(210, out);
+    const uintmax_t overflow[] = {UINTMAX_MAX, 2, 0};
+    assert_int_equal(
+            seagrass_uintmax_t_checked_product(&object, overflow, 3), 0);
+    assert_int_equal(
+            seagrass_uintmax_t_checked_get(&object, &out),
+            SEAGRASS_UINTMAX_T_CHECKED_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_uintmax_t_checked_init),
+            cmocka_unit_test(check_uintmax_t_checked_add),
+            cmocka_unit_test(check_uintmax_t_checked_subtract),
+            cmocka_unit_test(check_uintmax_t_checked_multiply),
+            cmocka_unit_test(check_uintmax_t_checked_merge),
+            cmocka_unit_test(check_uintmax_t_checked_get_error_on_object_is_null),
+            cmocka_unit_test(check_uintmax_t_checked_get_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_checked_get_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_uintmax_t_checked_get),
+            cmocka_unit_test(check_uintmax_t_checked_sum_error_on_object_is_null),
+            cmocka_unit_test(check_uintmax_t_checked_sum_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_checked_sum),
+            cmocka_unit_test(check_uintmax_t_checked_sum_overflow),
+            cmocka_unit_test(check_uintmax_t_checked_product_error_on_object_is_null),
+            cmocka_unit_test(check_uintmax_t_checked_product_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_checked_product),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
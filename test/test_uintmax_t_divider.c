@@ -0,0 +1,178 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+static const uintmax_t divisors[] = {
+        1, 2, 3, 5, 6, 7, 10, 64, 100, 641, 1000, 4096, 1000000007,
+        UINTMAX_MAX / 3, (UINTMAX_MAX >> 1) + 1, UINTMAX_MAX - 1, UINTMAX_MAX
+};
+
+static const uintmax_t values[] = {
+        0, 1, 2, 3, 7, 63, 64, 65, 99, 100, 101, 999, 1000, 12345678901,
+        UINTMAX_MAX / 3, UINTMAX_MAX / 2, (UINTMAX_MAX >> 1) + 1,
+        UINTMAX_MAX - 2, UINTMAX_MAX - 1, UINTMAX_MAX
+};
+
+#define COUNT(x) (sizeof(x) / sizeof((x)[0]))
+
+static void check_uintmax_t_divider_init_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_divider_init(NULL, 1),
+            SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL);
+}
+
+static void
+check_uintmax_t_divider_init_error_on_divide_by_zero(void **state) {
+    struct seagrass_uintmax_t_divider object;
+    assert_int_equal(
+            seagrass_uintmax_t_divider_init(&object, 0),
+            SEAGRASS_UINTMAX_T_DIVIDER_ERROR_DIVIDE_BY_ZERO);
+}
+
+static void
+check_uintmax_t_divider_divide_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_divider_divide(NULL, 1, (void *) 1, NULL),
+            SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL);
+}
+
+static void
+check_uintmax_t_divider_divide_error_on_quotient_is_null(void **state) {
+    struct seagrass_uintmax_t_divider object;
+    assert_int_equal(seagrass_uintmax_t_divider_init(&object, 3), 0);
+    assert_int_equal(
+            seagrass_uintmax_t_divider_divide(&object, 1, NULL, (void *) 1),
+            SEAGRASS_UINTMAX_T_DIVIDER_ERROR_QUOTIENT_IS_NULL);
+}
+
+static void check_uintmax_t_divider_divide(void **state) {
+    for (uintmax_t i = 0; i < COUNT(divisors); i++) {
+        struct seagrass_uintmax_t_divider object;
+        assert_int_equal(
+                seagrass_uintmax_t_divider_init(&object, divisors[i]), 0);
+        for (uintmax_t j = 0; j < COUNT(values); j++) {
+            uintmax_t quotient, remainder;
+            assert_int_equal(
+                    seagrass_uintmax_t_divider_divide(&object, values[j],
+                                                      &quotient, &remainder),
+                    0);
+            assert_int_equal(values[j] / divisors[i], quotient);
+            assert_int_equal(values[j] % divisors[i], remainder);
+            assert_int_equal(
+                    seagrass_uintmax_t_divider_divide(&object, values[j],
+                                                      &quotient, NULL),
+                    0);
+            assert_int_equal(values[j] / divisors[i], quotient);
+        }
+    }
+}
+
+static void
+check_uintmax_t_divider_modulo_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_divider_modulo(NULL, 1, (void *) 1),
+            SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL);
+}
+
+static void check_uintmax_t_divider_modulo_error_on_out_is_null(void **state) {
+    struct seagrass_uintmax_t_divider object;
+    assert_int_equal(seagrass_uintmax_t_divider_init(&object, 3), 0);
+    assert_int_equal(
+            seagrass_uintmax_t_divider_modulo(&object, 1, NULL),
+            SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_divider_modulo(void **state) {
+    for (uintmax_t i = 0; i < COUNT(divisors); i++) {
+        struct seagrass_uintmax_t_divider object;
+        assert_int_equal(
+                seagrass_uintmax_t_divider_init(&object, divisors[i]), 0);
+        for (uintmax_t j = 0; j < COUNT(values); j++) {
+            uintmax_t out;
+            assert_int_equal(
+                    seagrass_uintmax_t_divider_modulo(&object, values[j],
+                                                      &out), 0);
+            assert_int_equal(values[j] % divisors[i], out);
+        }
+    }
+}
+
+static void
+check_uintmax_t_divider_divide_n_error_on_object_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_divider_divide_n(NULL, (void *) 1, 1,
+                                                (void *) 1, NULL),
+            SEAGRASS_UINTMAX_T_DIVIDER_ERROR_OBJECT_IS_NULL);
+}
+
+static void
+check_uintmax_t_divider_divide_n_error_on_values_is_null(void **state) {
+    struct seagrass_uintmax_t_divider object;
+    assert_int_equal(seagrass_uintmax_t_divider_init(&object, 3), 0);
+    assert_int_equal(
+            seagrass_uintmax_t_divider_divide_n(&object, NULL, 1,
+                                                (void *) 1, NULL),
+            SEAGRASS_UINTMAX_T_DIVIDER_ERROR_VALUES_IS_NULL);
+}
+
+static void
+check_uintmax_t_divider_divide_n_error_on_quotient_is_null(void **state) {
+    struct seagrass_uintmax_t_divider object;
+    assert_int_equal(seagrass_uintmax_t_divider_init(&object, 3), 0);
+    assert_int_equal(
+            seagrass_uintmax_t_divider_divide_n(&object, (void *) 1, 1,
+                                                NULL, NULL),
+            SEAGRASS_UINTMAX_T_DIVIDER_ERROR_QUOTIENT_IS_NULL);
+}
+
+static void check_uintmax_t_divider_divide_n(void **state) {
+    for (uintmax_t i = 0; i < COUNT(divisors); i++) {
+        struct seagrass_uintmax_t_divider object;
+        assert_int_equal(
+                seagrass_uintmax_t_divider_init(&object, divisors[i]), 0);
+        uintmax_t quotients[COUNT(values)];
+        uintmax_t remainders[COUNT(values)];
+        assert_int_equal(
+                seagrass_uintmax_t_divider_divide_n(&object, values,
+                                                    COUNT(values), quotients,
+                                                    remainders), 0);
+        for (uintmax_t j = 0; j < COUNT(values); j++) {
+            assert_int_equal(values[j] / divisors[i], quotients[j]);
+            assert_int_equal(values[j] % divisors[i], remainders[j]);
+        }
+        /* in place */
+        memcpy(quotients, values, sizeof(values));
+        assert_int_equal(
+                seagrass_uintmax_t_divider_divide_n(&object, quotients,
+                                                    COUNT(values), quotients,
+                                                    NULL), 0);
+        for (uintmax_t j = 0; j < COUNT(values); j++) {
+            assert_int_equal(values[j] / divisors[i], quotients[j]);
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_uintmax_t_divider_init_error_on_object_is_null),
+            cmocka_unit_test(check_uintmax_t_divider_init_error_on_divide_by_zero),
+            cmocka_unit_test(check_uintmax_t_divider_divide_error_on_object_is_null),
+            cmocka_unit_test(check_uintmax_t_divider_divide_error_on_quotient_is_null),
+            cmocka_unit_test(check_uintmax_t_divider_divide),
+            cmocka_unit_test(check_uintmax_t_divider_modulo_error_on_object_is_null),
+            cmocka_unit_test(check_uintmax_t_divider_modulo_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_divider_modulo),
+            cmocka_unit_test(check_uintmax_t_divider_divide_n_error_on_object_is_null),
+            cmocka_unit_test(check_uintmax_t_divider_divide_n_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_divider_divide_n_error_on_quotient_is_null),
+            cmocka_unit_test(check_uintmax_t_divider_divide_n),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
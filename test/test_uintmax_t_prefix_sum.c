@@ -0,0 +1,234 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdlib.h>
+#include <string.h>
+#include <seagrass.h>
+
+#include "thread_pool.h"
+
+#include <test/cmocka.h>
+
+static const uintmax_t values[] = {
+        3, 0, 1, 4, 1, 5, 9, 2, 6, 5, 3
+};
+
+#define COUNT (sizeof(values) / sizeof(values[0]))
+
+/* large enough to be scanned in parallel */
+#define LARGE 200003
+
+static const unsigned int concurrencies[] = {1, 2, 3, 8};
+
+#define CONCURRENCIES (sizeof(concurrencies) / sizeof(concurrencies[0]))
+
+static void check_uintmax_t_prefix_sum_error_on_values_is_null(void **state) {
+    uintmax_t out[1];
+    assert_int_equal(
+            seagrass_uintmax_t_prefix_sum(
+                    NULL, 1, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE, out,
+                    NULL),
+            SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_VALUES_IS_NULL);
+}
+
+static void check_uintmax_t_prefix_sum_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_prefix_sum(
+                    values, COUNT, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE,
+                    NULL, NULL),
+            SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_prefix_sum_error_on_mode_is_invalid(void **state) {
+    uintmax_t out[COUNT];
+    assert_int_equal(
+            seagrass_uintmax_t_prefix_sum(values, COUNT, 2, out, NULL),
+            SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_MODE_IS_INVALID);
+}
+
+static void check_uintmax_t_prefix_sum_count_is_zero(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_prefix_sum(
+                    NULL, 0, SEAGRASS_UINTMAX_T_PREFIX_SUM_EXCLUSIVE, NULL,
+                    NULL),
+            0);
+}
+
+static void check_uintmax_t_prefix_sum_inclusive(void **state) {
+    const uintmax_t expected[] = {
+            3, 3, 4, 8, 9, 14, 23, 25, 31, 36, 39
+    };
+    uintmax_t out[COUNT];
+    assert_int_equal(
+            seagrass_uintmax_t_prefix_sum(
+                    values, COUNT, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE,
+                    out, NULL),
+            0);
+    assert_memory_equal(out, expected, sizeof(expected));
+    /* in place */
+    memcpy(out, values, sizeof(values));
+    assert_int_equal(
+            seagrass_uintmax_t_prefix_sum(
+                    out, COUNT, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE,
+                    out, NULL),
+            0);
+    assert_memory_equal(out, expected, sizeof(expected));
+}
+
+static void check_uintmax_t_prefix_sum_exclusive(void **state) {
+    const uintmax_t expected[] = {
+            0, 3, 3, 4, 8, 9, 14, 23, 25, 31, 36
+    };
+    uintmax_t out[COUNT];
+    assert_int_equal(
+            seagrass_uintmax_t_prefix_sum(
+                    values, COUNT, SEAGRASS_UINTMAX_T_PREFIX_SUM_EXCLUSIVE,
+                    out, NULL),
+            0);
+    assert_memory_equal(out, expected, sizeof(expected));
+    /* in place */
+    memcpy(out, values, sizeof(values));
+    assert_int_equal(
+            seagrass_uintmax_t_prefix_sum(
+                    out, COUNT, SEAGRASS_UINTMAX_T_PREFIX_SUM_EXCLUSIVE,
+                    out, NULL),
+            0);
+    assert_memory_equal(out, expected, sizeof(expected));
+}
+
+static void check_uintmax_t_prefix_sum_overflow(void **state) {
+    uintmax_t input[COUNT];
+    uintmax_t out[COUNT];
+    for (uintmax_t at = 0; at < COUNT; at++) {
+        memcpy(input, values, sizeof(values));
+        input[at] = UINTMAX_MAX - 2;
+        uintmax_t first = 0;
+        for (uintmax_t sum = 0; first < COUNT; first++) {
+            if (seagrass_uintmax_t_add(sum, input[first], &sum)) {
+                break;
+            }
+        }
+        if (first == COUNT) {
+            continue;
+        }
+        uintmax_t index = 0;
+        assert_int_equal(
+                seagrass_uintmax_t_prefix_sum(
+                        input, COUNT, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE,
+                        out, &index),
+                SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_RESULT_IS_INCONSISTENT);
+        assert_int_equal(index, first);
+        index = 0;
+        const int error = seagrass_uintmax_t_prefix_sum(
+                input, COUNT, SEAGRASS_UINTMAX_T_PREFIX_SUM_EXCLUSIVE,
+                out, &index);
+        if (first + 1 < COUNT) {
+            assert_int_equal(
+                    error,
+                    SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_RESULT_IS_INCONSISTENT);
+            assert_int_equal(index, first + 1);
+        } else {
+            /* only the sum of all the values overflows */
+            assert_int_equal(error, 0);
+        }
+    }
+}
+
+static void check_uintmax_t_prefix_sum_large(void **state) {
+    uintmax_t *input = malloc(LARGE * sizeof(*input));
+    assert_non_null(input);
+    uintmax_t *expected = malloc(LARGE * sizeof(*expected));
+    assert_non_null(expected);
+    uintmax_t *out = malloc(LARGE * sizeof(*out));
+    assert_non_null(out);
+    uintmax_t sum = 0;
+    for (uintmax_t i = 0; i < LARGE; i++) {
+        input[i] = (i * 2654435761u) % 1000003;
+        sum += input[i];
+        expected[i] = sum;
+    }
+    for (size_t c = 0; c < CONCURRENCIES; c++) {
+        seagrass_thread_pool_set_concurrency(concurrencies[c]);
+        assert_int_equal(
+                seagrass_uintmax_t_prefix_sum(
+                        input, LARGE, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE,
+                        out, NULL),
+                0);
+        assert_memory_equal(out, expected, LARGE * sizeof(*out));
+        assert_int_equal(
+                seagrass_uintmax_t_prefix_sum(
+                        input, LARGE, SEAGRASS_UINTMAX_T_PREFIX_SUM_EXCLUSIVE,
+                        out, NULL),
+                0);
+        assert_int_equal(out[0], 0);
+        assert_memory_equal(out + 1, expected, (LARGE - 1) * sizeof(*out));
+        /* in place */
+        memcpy(out, input, LARGE * sizeof(*out));
+        assert_int_equal(
+                seagrass_uintmax_t_prefix_sum(
+                        out, LARGE, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE,
+                        out, NULL),
+                0);
+        assert_memory_equal(out, expected, LARGE * sizeof(*out));
+    }
+    seagrass_thread_pool_set_concurrency(0);
+    free(input);
+    free(expected);
+    free(out);
+}
+
+static void check_uintmax_t_prefix_sum_large_overflow(void **state) {
+    uintmax_t *input = malloc(LARGE * sizeof(*input));
+    assert_non_null(input);
+    uintmax_t *out = malloc(LARGE * sizeof(*out));
+    assert_non_null(out);
+    for (uintmax_t i = 0; i < LARGE; i++) {
+        input[i] = 1;
+    }
+    /* overflows at 123457 while 150000 overflows on its own block sum */
+    input[123456] = UINTMAX_MAX - 123456;
+    input[150000] = UINTMAX_MAX;
+    for (size_t c = 0; c < CONCURRENCIES; c++) {
+        seagrass_thread_pool_set_concurrency(concurrencies[c]);
+        uintmax_t index = 0;
+        assert_int_equal(
+                seagrass_uintmax_t_prefix_sum(
+                        input, LARGE, SEAGRASS_UINTMAX_T_PREFIX_SUM_INCLUSIVE,
+                        out, &index),
+                SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_RESULT_IS_INCONSISTENT);
+        assert_int_equal(index, 123457);
+        for (uintmax_t i = 0; i < 123456; i++) {
+            assert_int_equal(out[i], i + 1);
+        }
+        assert_int_equal(out[123456], UINTMAX_MAX);
+        index = 0;
+        assert_int_equal(
+                seagrass_uintmax_t_prefix_sum(
+                        input, LARGE, SEAGRASS_UINTMAX_T_PREFIX_SUM_EXCLUSIVE,
+                        out, &index),
+                SEAGRASS_UINTMAX_T_PREFIX_SUM_ERROR_RESULT_IS_INCONSISTENT);
+        assert_int_equal(index, 123458);
+        assert_int_equal(out[123457], UINTMAX_MAX);
+    }
+    seagrass_thread_pool_set_concurrency(0);
+    free(input);
+    free(out);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_uintmax_t_prefix_sum_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_prefix_sum_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_prefix_sum_error_on_mode_is_invalid),
+            cmocka_unit_test(check_uintmax_t_prefix_sum_count_is_zero),
+            cmocka_unit_test(check_uintmax_t_prefix_sum_inclusive),
+            cmocka_unit_test(check_uintmax_t_prefix_sum_exclusive),
+            cmocka_unit_test(check_uintmax_t_prefix_sum_overflow),
+            cmocka_unit_test(check_uintmax_t_prefix_sum_large),
+            cmocka_unit_test(check_uintmax_t_prefix_sum_large_overflow),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,154 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+static const uintmax_t a[] = {
+        0, 1, 2, UINTMAX_MAX - 1, UINTMAX_MAX, UINTMAX_MAX / 2, 3
+};
+
+static const uintmax_t b[] = {
+        0, UINTMAX_MAX, 3, 1, 1, 3, 2
+};
+
+#define COUNT (sizeof(a) / sizeof(a[0]))
+
+static void check_uintmax_t_saturating_add(void **state) {
+    assert_int_equal(3, seagrass_uintmax_t_saturating_add(1, 2));
+    assert_int_equal(UINTMAX_MAX,
+                     seagrass_uintmax_t_saturating_add(UINTMAX_MAX - 1, 1));
+    assert_int_equal(UINTMAX_MAX,
+                     seagrass_uintmax_t_saturating_add(UINTMAX_MAX, 1));
+    assert_int_equal(UINTMAX_MAX,
+                     seagrass_uintmax_t_saturating_add(UINTMAX_MAX,
+                                                       UINTMAX_MAX));
+}
+
+static void check_uintmax_t_saturating_subtract(void **state) {
+    assert_int_equal(1, seagrass_uintmax_t_saturating_subtract(3, 2));
+    assert_int_equal(0, seagrass_uintmax_t_saturating_subtract(2, 2));
+    assert_int_equal(0, seagrass_uintmax_t_saturating_subtract(2, 3));
+    assert_int_equal(0, seagrass_uintmax_t_saturating_subtract(0,
+                                                               UINTMAX_MAX));
+}
+
+static void check_uintmax_t_saturating_multiply(void **state) {
+    assert_int_equal(6, seagrass_uintmax_t_saturating_multiply(2, 3));
+    assert_int_equal(0, seagrass_uintmax_t_saturating_multiply(0,
+                                                               UINTMAX_MAX));
+    assert_int_equal(UINTMAX_MAX,
+                     seagrass_uintmax_t_saturating_multiply(UINTMAX_MAX, 1));
+    assert_int_equal(UINTMAX_MAX,
+                     seagrass_uintmax_t_saturating_multiply(UINTMAX_MAX, 2));
+    assert_int_equal(UINTMAX_MAX,
+                     seagrass_uintmax_t_saturating_multiply(
+                             (UINTMAX_MAX >> 1) + 1, 2));
+}
+
+static void
+check_uintmax_t_saturating_add_n_error_on_values_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_add_n(NULL, b, 1, (void *) 1),
+            SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL);
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_add_n(a, NULL, 1, (void *) 1),
+            SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL);
+}
+
+static void check_uintmax_t_saturating_add_n_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_add_n(a, b, 1, NULL),
+            SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_saturating_add_n(void **state) {
+    uintmax_t out[COUNT];
+    assert_int_equal(seagrass_uintmax_t_saturating_add_n(a, b, COUNT, out),
+                     0);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        assert_int_equal(seagrass_uintmax_t_saturating_add(a[i], b[i]),
+                         out[i]);
+    }
+    assert_int_equal(seagrass_uintmax_t_saturating_add_n(NULL, NULL, 0,
+                                                         NULL), 0);
+}
+
+static void
+check_uintmax_t_saturating_subtract_n_error_on_values_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_subtract_n(NULL, b, 1, (void *) 1),
+            SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL);
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_subtract_n(a, NULL, 1, (void *) 1),
+            SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL);
+}
+
+static void
+check_uintmax_t_saturating_subtract_n_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_subtract_n(a, b, 1, NULL),
+            SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_saturating_subtract_n(void **state) {
+    uintmax_t out[COUNT];
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_subtract_n(a, b, COUNT, out), 0);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        assert_int_equal(seagrass_uintmax_t_saturating_subtract(a[i], b[i]),
+                         out[i]);
+    }
+}
+
+static void
+check_uintmax_t_saturating_multiply_n_error_on_values_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_multiply_n(NULL, b, 1, (void *) 1),
+            SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL);
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_multiply_n(a, NULL, 1, (void *) 1),
+            SEAGRASS_UINTMAX_T_SATURATING_ERROR_VALUES_IS_NULL);
+}
+
+static void
+check_uintmax_t_saturating_multiply_n_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_multiply_n(a, b, 1, NULL),
+            SEAGRASS_UINTMAX_T_SATURATING_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_saturating_multiply_n(void **state) {
+    uintmax_t out[COUNT];
+    memcpy(out, a, sizeof(a));
+    /* in place */
+    assert_int_equal(
+            seagrass_uintmax_t_saturating_multiply_n(out, b, COUNT, out), 0);
+    for (uintmax_t i = 0; i < COUNT; i++) {
+        assert_int_equal(seagrass_uintmax_t_saturating_multiply(a[i], b[i]),
+                         out[i]);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_uintmax_t_saturating_add),
+            cmocka_unit_test(check_uintmax_t_saturating_subtract),
+            cmocka_unit_test(check_uintmax_t_saturating_multiply),
+            cmocka_unit_test(check_uintmax_t_saturating_add_n_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_saturating_add_n_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_saturating_add_n),
+            cmocka_unit_test(check_uintmax_t_saturating_subtract_n_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_saturating_subtract_n_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_saturating_subtract_n),
+            cmocka_unit_test(check_uintmax_t_saturating_multiply_n_error_on_values_is_null),
+            cmocka_unit_test(check_uintmax_t_saturating_multiply_n_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_saturating_multiply_n),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}
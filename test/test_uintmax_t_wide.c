@@ -0,0 +1,168 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <cmocka.h>
+#include <string.h>
+#include <seagrass.h>
+
+#include <test/cmocka.h>
+
+static void check_uintmax_t_multiply_wide_error_on_out_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_multiply_wide(1, 1, NULL),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL);
+}
+
+static void check_uintmax_t_multiply_wide(void **state) {
+    struct seagrass_uintmax_t_wide out;
+    assert_int_equal(seagrass_uintmax_t_multiply_wide(6, 7, &out), 0);
+    assert_int_equal(0, out.hi);
+    assert_int_equal(42, out.lo);
+    assert_int_equal(
+            seagrass_uintmax_t_multiply_wide(UINTMAX_MAX, UINTMAX_MAX, &out),
+            0);
+    assert_int_equal(UINTMAX_MAX - 1, out.hi);
+    assert_int_equal(1, out.lo);
+    assert_int_equal(seagrass_uintmax_t_multiply_wide(UINTMAX_MAX, 2, &out),
+                     0);
+    assert_int_equal(1, out.hi);
+    assert_int_equal(UINTMAX_MAX - 1, out.lo);
+}
+
+static void check_uintmax_t_muldiv_error_on_quotient_is_null(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_muldiv(1, 1, 1, NULL, (void *) 1),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_QUOTIENT_IS_NULL);
+}
+
+static void check_uintmax_t_muldiv_error_on_divide_by_zero(void **state) {
+    assert_int_equal(
+            seagrass_uintmax_t_muldiv(1, 1, 0, (void *) 1, (void *) 1),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_DIVIDE_BY_ZERO);
+}
+
+static void
+check_uintmax_t_muldiv_error_on_result_is_inconsistent(void **state) {
+    uintmax_t quotient;
+    assert_int_equal(
+            seagrass_uintmax_t_muldiv(UINTMAX_MAX, 2, 1, &quotient, NULL),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_uintmax_t_muldiv(UINTMAX_MAX, UINTMAX_MAX, UINTMAX_MAX - 1,
+                                      &quotient, NULL),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_uintmax_t_muldiv(void **state) {
+    uintmax_t quotient, remainder;
+    assert_int_equal(
+            seagrass_uintmax_t_muldiv(22, 1, 5, &quotient, &remainder), 0);
+    assert_int_equal(4, quotient);
+    assert_int_equal(2, remainder);
+    assert_int_equal(
+            seagrass_uintmax_t_muldiv(UINTMAX_MAX, UINTMAX_MAX, UINTMAX_MAX,
+                                      &quotient, &remainder), 0);
+    assert_int_equal(UINTMAX_MAX, quotient);
+    assert_int_equal(0, remainder);
+    /* (2^w - 1) * 3 / 4 = 3 * 2^(w-2) - 1 remainder 1 */
+    assert_int_equal(
+            seagrass_uintmax_t_muldiv(UINTMAX_MAX, 3, 4,
+                                      &quotient, &remainder), 0);
+    assert_int_equal(3 * ((UINTMAX_MAX >> 2) + 1) - 1, quotient);
+    assert_int_equal(1, remainder);
+    assert_int_equal(
+            seagrass_uintmax_t_muldiv(UINTMAX_MAX - 2, UINTMAX_MAX - 4,
+                                      UINTMAX_MAX - 1, &quotient, &remainder),
+            0);
+    /* (m - 2)(m - 4) = (m - 1)(m - 5) + 3 where m = 2^w - 1 */
+    assert_int_equal(UINTMAX_MAX - 5, quotient);
+    assert_int_equal(3, remainder);
+}
+
+static void check_uintmax_t_wide_compare(void **state) {
+    const struct seagrass_uintmax_t_wide i[] = {
+            {0, UINTMAX_MAX},
+            {1, 0},
+    };
+    assert_int_equal((-1), seagrass_uintmax_t_wide_compare(i[0], i[1]));
+    assert_int_equal(0, seagrass_uintmax_t_wide_compare(i[0], i[0]));
+    assert_int_equal(0, seagrass_uintmax_t_wide_compare(i[1], i[1]));
+    assert_int_equal(1, seagrass_uintmax_t_wide_compare(i[1], i[0]));
+}
+
+static void check_uintmax_t_wide_add_error_on_out_is_null(void **state) {
+    const struct seagrass_uintmax_t_wide a = {0, 1};
+    assert_int_equal(
+            seagrass_uintmax_t_wide_add(a, a, NULL),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_uintmax_t_wide_add_error_on_result_is_inconsistent(void **state) {
+    const struct seagrass_uintmax_t_wide a = {UINTMAX_MAX, UINTMAX_MAX};
+    const struct seagrass_uintmax_t_wide b = {0, 1};
+    const struct seagrass_uintmax_t_wide c = {1, 0};
+    struct seagrass_uintmax_t_wide out;
+    assert_int_equal(
+            seagrass_uintmax_t_wide_add(a, b, &out),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT);
+    assert_int_equal(
+            seagrass_uintmax_t_wide_add(a, c, &out),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_uintmax_t_wide_add(void **state) {
+    const struct seagrass_uintmax_t_wide a = {0, UINTMAX_MAX};
+    const struct seagrass_uintmax_t_wide b = {2, 1};
+    struct seagrass_uintmax_t_wide out;
+    assert_int_equal(seagrass_uintmax_t_wide_add(a, b, &out), 0);
+    assert_int_equal(3, out.hi);
+    assert_int_equal(0, out.lo);
+}
+
+static void check_uintmax_t_wide_subtract_error_on_out_is_null(void **state) {
+    const struct seagrass_uintmax_t_wide a = {0, 1};
+    assert_int_equal(
+            seagrass_uintmax_t_wide_subtract(a, a, NULL),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_OUT_IS_NULL);
+}
+
+static void
+check_uintmax_t_wide_subtract_error_on_result_is_inconsistent(void **state) {
+    const struct seagrass_uintmax_t_wide a = {0, UINTMAX_MAX};
+    const struct seagrass_uintmax_t_wide b = {1, 0};
+    struct seagrass_uintmax_t_wide out;
+    assert_int_equal(
+            seagrass_uintmax_t_wide_subtract(a, b, &out),
+            SEAGRASS_UINTMAX_T_WIDE_ERROR_RESULT_IS_INCONSISTENT);
+}
+
+static void check_uintmax_t_wide_subtract(void **state) {
+    const struct seagrass_uintmax_t_wide a = {3, 0};
+    const struct seagrass_uintmax_t_wide b = {0, 1};
+    struct seagrass_uintmax_t_wide out;
+    assert_int_equal(seagrass_uintmax_t_wide_subtract(a, b, &out), 0);
+    assert_int_equal(2, out.hi);
+    assert_int_equal(UINTMAX_MAX, out.lo);
+}
+
+int main(int argc, char *argv[]) {
+    const struct CMUnitTest tests[] = {
+            cmocka_unit_test(check_uintmax_t_multiply_wide_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_multiply_wide),
+            cmocka_unit_test(check_uintmax_t_muldiv_error_on_quotient_is_null),
+            cmocka_unit_test(check_uintmax_t_muldiv_error_on_divide_by_zero),
+            cmocka_unit_test(check_uintmax_t_muldiv_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_uintmax_t_muldiv),
+            cmocka_unit_test(check_uintmax_t_wide_compare),
+            cmocka_unit_test(check_uintmax_t_wide_add_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_wide_add_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_uintmax_t_wide_add),
+            cmocka_unit_test(check_uintmax_t_wide_subtract_error_on_out_is_null),
+            cmocka_unit_test(check_uintmax_t_wide_subtract_error_on_result_is_inconsistent),
+            cmocka_unit_test(check_uintmax_t_wide_subtract),
+    };
+    //cmocka_set_message_output(CM_OUTPUT_XML);
+    return cmocka_run_group_tests(tests, NULL, NULL);
+}